@@ -0,0 +1,50 @@
+#ifndef strong_type_aligned_ptr_h
+#define strong_type_aligned_ptr_h
+
+#include <cstddef>
+#include <type_traits>
+
+#include "strong_type.h"
+
+namespace strong
+{
+// Tag of pointers to Align-aligned objects: wraps Tag so that pointers with
+// the same Tag and different alignments are different types.
+template <typename Tag, std::size_t Align>
+struct aligned_tag
+{
+    static_assert(Align > 0 && (Align & (Align - 1)) == 0,
+                  "Alignment must be a power of two.");
+    static constexpr std::size_t alignment = Align;
+};
+
+namespace details
+{
+template <typename Tag, typename Pointer, std::size_t Align>
+using aligned_pointer_type =
+    strong_type<aligned_tag<Tag, Align>, Pointer, indirection, subscription,
+                pointer_plus_value, pointer_minus_value,
+                pointer_plus_assignment, pointer_minus_assignment,
+                pointer_minus_pointer, comparisons>;
+}  // namespace details
+
+// Pointer to T known to be Align-aligned, e.g. to the beginning of a buffer
+// allocated with aligned_alloc. Dereference, subscript and pointer
+// arithmetic pass the alignment to the optimizer with
+// __builtin_assume_aligned, so loops over p[i] use aligned vector loads
+// without a peeled prologue. Debug builds assert the alignment on every
+// access: advance only by multiples of Align / sizeof(T) elements.
+template <typename Tag, typename T, std::size_t Align>
+using aligned_ptr = details::aligned_pointer_type<Tag, T*, Align>;
+
+// aligned_ptr that also promises that the object is reached only through
+// this pointer while it is in scope, like a restrict-qualified parameter.
+// The promise is made where restrict_ptr is a function parameter, so pass
+// it by value: kernels taking restrict_ptr arguments are vectorized without
+// run-time overlap checks. Align defaults to the natural alignment of T.
+template <typename Tag, typename T, std::size_t Align = alignof(T)>
+using restrict_ptr =
+    details::aligned_pointer_type<Tag, T* STRONG_TYPE_RESTRICT, Align>;
+}  // namespace strong
+
+#endif /* strong_type_aligned_ptr_h */
@@ -0,0 +1,139 @@
+#ifndef strong_type_atomic_h
+#define strong_type_atomic_h
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "strong_type.h"
+
+#ifndef STRONG_TYPE_CACHE_LINE_SIZE
+#if defined(__APPLE__) && defined(__aarch64__)
+#define STRONG_TYPE_CACHE_LINE_SIZE 128
+#else
+#define STRONG_TYPE_CACHE_LINE_SIZE 64
+#endif
+#endif
+
+namespace strong
+{
+// Distance that keeps two objects from false sharing. Unlike
+// std::hardware_destructive_interference_size it does not change with
+// compiler flags, so it is safe to use in layouts shared between TUs.
+inline constexpr std::size_t cache_line_size = STRONG_TYPE_CACHE_LINE_SIZE;
+
+// std::atomic over the underlying value of StrongT. Read-modify-write
+// operations are available only if StrongT has the matching mixin:
+// fetch_add - plus, fetch_sub - minus, fetch_and - bitwise_and,
+// fetch_or - bitwise_or, fetch_xor - bitwise_xor, compare_exchange_* -
+// comparisons. Every operation takes explicit memory order.
+template <typename StrongT>
+class atomic
+{
+    static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+    using T = underlying_type<StrongT>;
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "std::atomic requires trivially copyable T.");
+
+    template <typename S, template <typename> typename Op, typename R>
+    using if_has_op_t = std::enable_if_t<has_op_v<S, Op>, R>;
+
+   public:
+    using value_type = StrongT;
+
+    static constexpr bool is_always_lock_free =
+        std::atomic<T>::is_always_lock_free;
+
+    constexpr atomic() noexcept : value_{} {}
+    constexpr explicit atomic(StrongT aValue) noexcept : value_(aValue.get())
+    {
+    }
+
+    atomic(const atomic&) = delete;
+    atomic& operator=(const atomic&) = delete;
+
+    bool is_lock_free() const noexcept { return value_.is_lock_free(); }
+
+    StrongT load(std::memory_order aOrder) const noexcept
+    {
+        return StrongT(value_.load(aOrder));
+    }
+
+    void store(StrongT aValue, std::memory_order aOrder) noexcept
+    {
+        value_.store(aValue.get(), aOrder);
+    }
+
+    StrongT exchange(StrongT aValue, std::memory_order aOrder) noexcept
+    {
+        return StrongT(value_.exchange(aValue.get(), aOrder));
+    }
+
+    template <typename S = StrongT>
+    if_has_op_t<S, comparisons, bool> compare_exchange_weak(
+        StrongT& aExpected, StrongT aDesired, std::memory_order aSuccess,
+        std::memory_order aFailure) noexcept
+    {
+        return value_.compare_exchange_weak(aExpected.get(), aDesired.get(),
+                                            aSuccess, aFailure);
+    }
+
+    template <typename S = StrongT>
+    if_has_op_t<S, comparisons, bool> compare_exchange_strong(
+        StrongT& aExpected, StrongT aDesired, std::memory_order aSuccess,
+        std::memory_order aFailure) noexcept
+    {
+        return value_.compare_exchange_strong(aExpected.get(), aDesired.get(),
+                                              aSuccess, aFailure);
+    }
+
+    template <typename S = StrongT>
+    if_has_op_t<S, plus, StrongT> fetch_add(
+        StrongT aValue, std::memory_order aOrder) noexcept
+    {
+        return StrongT(value_.fetch_add(aValue.get(), aOrder));
+    }
+
+    template <typename S = StrongT>
+    if_has_op_t<S, minus, StrongT> fetch_sub(
+        StrongT aValue, std::memory_order aOrder) noexcept
+    {
+        return StrongT(value_.fetch_sub(aValue.get(), aOrder));
+    }
+
+    template <typename S = StrongT>
+    if_has_op_t<S, bitwise_and, StrongT> fetch_and(
+        StrongT aValue, std::memory_order aOrder) noexcept
+    {
+        return StrongT(value_.fetch_and(aValue.get(), aOrder));
+    }
+
+    template <typename S = StrongT>
+    if_has_op_t<S, bitwise_or, StrongT> fetch_or(
+        StrongT aValue, std::memory_order aOrder) noexcept
+    {
+        return StrongT(value_.fetch_or(aValue.get(), aOrder));
+    }
+
+    template <typename S = StrongT>
+    if_has_op_t<S, bitwise_xor, StrongT> fetch_xor(
+        StrongT aValue, std::memory_order aOrder) noexcept
+    {
+        return StrongT(value_.fetch_xor(aValue.get(), aOrder));
+    }
+
+   private:
+    std::atomic<T> value_;
+};
+
+// atomic that occupies whole cache lines, for counters updated by different
+// threads side by side (e.g. an array of per-core counters).
+template <typename StrongT>
+class alignas(cache_line_size) padded_atomic : public atomic<StrongT>
+{
+   public:
+    using atomic<StrongT>::atomic;
+};
+}  // namespace strong
+
+#endif /* strong_type_atomic_h */
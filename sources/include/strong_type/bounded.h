@@ -0,0 +1,431 @@
+#ifndef strong_type_bounded_h
+#define strong_type_bounded_h
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#include "strong_type.h"
+
+namespace strong
+{
+// Tag of values of T in [Min, Max]: wraps Tag so that bounded types with the
+// same Tag and different ranges are different types, and declares the range
+// for the checks of strong_type.
+template <typename Tag, typename T, T Min, T Max>
+struct bounded_tag
+{
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                  "Bounded types need an integral underlying type.");
+    static_assert(Min <= Max, "Invalid bounds.");
+    static constexpr T min = Min;
+    static constexpr T max = Max;
+};
+
+// Integral value of T known to be in [Min, Max]: a port, a percentage, the
+// index of one of N shards. Construction checks the range: out of range
+// values terminate the program or, in constant expressions, do not compile.
+// Every read tells the optimizer the range, so checks and branches that it
+// makes redundant, e.g. shard % N for a shard in [0, N), compile to nothing.
+// Bounded types whose range does not contain T{} have no default
+// constructor.
+template <typename Tag, typename T, T Min, T Max,
+          template <typename> typename... Ops>
+using bounded = strong_type<bounded_tag<Tag, T, Min, Max>, T, Ops...>;
+
+// Compile-time operand of bounded arithmetic, e.g. shard % constant<16u>.
+template <auto Value>
+inline constexpr std::integral_constant<decltype(Value), Value> constant{};
+
+namespace details
+{
+template <typename T>
+struct bounded_traits
+{
+    static constexpr bool value = false;
+};
+
+template <typename Tag, typename T, T Min, T Max,
+          template <typename> typename... Ops>
+struct bounded_traits<strong_type<bounded_tag<Tag, T, Min, Max>, T, Ops...>>
+{
+    static constexpr bool value = true;
+    using tag = Tag;
+
+    // The same bounded type with other bounds.
+    template <T NewMin, T NewMax>
+    using rebind = strong_type<bounded_tag<Tag, T, NewMin, NewMax>, T, Ops...>;
+};
+
+template <typename T, typename V>
+constexpr bool is_representable(V aValue) noexcept
+{
+    const T value = static_cast<T>(aValue);
+    if (static_cast<V>(value) != aValue)
+    {
+        return false;
+    }
+    if constexpr (std::is_signed_v<V> && !std::is_signed_v<T>)
+    {
+        return aValue >= 0;
+    }
+    else if constexpr (!std::is_signed_v<V> && std::is_signed_v<T>)
+    {
+        return value >= 0;
+    }
+    return true;
+}
+
+template <typename T>
+struct value_bounds
+{
+    T min;
+    T max;
+    // The exact result may not fit in T: it is computed with an overflow
+    // check, and the bounds are clamped to the limits of T.
+    bool checked = false;
+};
+
+// Bounds of an operand of bounded arithmetic on StrongT: a bounded value
+// with the same Tag or a constant that fits in its underlying type.
+template <typename StrongT, typename U, typename = void>
+struct operand_bounds
+{
+};
+
+template <typename StrongT, typename U>
+struct operand_bounds<
+    StrongT, U,
+    std::enable_if_t<bounded_traits<U>::value &&
+                     std::is_same_v<typename bounded_traits<U>::tag,
+                                    typename bounded_traits<StrongT>::tag> &&
+                     std::is_same_v<underlying_type<U>,
+                                    underlying_type<StrongT>>>>
+{
+    using type = underlying_type<StrongT>;
+    static constexpr value_bounds<type> value{tag_type<U>::min,
+                                              tag_type<U>::max};
+
+    static constexpr type get(const U& aOperand) noexcept
+    {
+        return aOperand.get();
+    }
+};
+
+template <typename StrongT, typename V, V Value>
+struct operand_bounds<
+    StrongT, std::integral_constant<V, Value>,
+    std::enable_if_t<std::is_integral_v<V> &&
+                     is_representable<underlying_type<StrongT>>(Value)>>
+{
+    using type = underlying_type<StrongT>;
+    static constexpr value_bounds<type> value{static_cast<type>(Value),
+                                              static_cast<type>(Value)};
+
+    static constexpr type get(std::integral_constant<V, Value>) noexcept
+    {
+        return static_cast<type>(Value);
+    }
+};
+
+template <typename StrongT, typename U, typename = void>
+inline constexpr bool is_bounded_operand_v = false;
+
+template <typename StrongT, typename U>
+inline constexpr bool is_bounded_operand_v<
+    StrongT, U, std::void_t<decltype(operand_bounds<StrongT, U>::value)>> =
+    true;
+
+template <typename T>
+constexpr T min_of(T aLhs, T aRhs) noexcept
+{
+    return aRhs < aLhs ? aRhs : aLhs;
+}
+
+template <typename T>
+constexpr T max_of(T aLhs, T aRhs) noexcept
+{
+    return aLhs < aRhs ? aRhs : aLhs;
+}
+
+// Operations of bounded arithmetic: bounds() computes the bounds of the
+// result from the bounds of the operands, apply() computes the result with
+// the instructions that the bounds of the operands allow. Bounds are
+// constants, so the choice is made at compile time.
+struct bounded_add
+{
+    template <typename T>
+    static constexpr value_bounds<T> bounds(value_bounds<T> aLhs,
+                                            value_bounds<T> aRhs) noexcept
+    {
+        T sum{};
+        const bool checked = add_overflow(aLhs.min, aRhs.min, sum) ||
+                             add_overflow(aLhs.max, aRhs.max, sum);
+        return {saturating_add(aLhs.min, aRhs.min),
+                saturating_add(aLhs.max, aRhs.max), checked};
+    }
+
+    // Checks for overflow only if it is possible.
+    template <typename T>
+    static constexpr T apply(value_bounds<T> aLhsBounds,
+                             value_bounds<T> aRhsBounds, T aLhs,
+                             T aRhs) noexcept
+    {
+        return bounds(aLhsBounds, aRhsBounds).checked
+                   ? checked_add(aLhs, aRhs)
+                   : wrapping_add(aLhs, aRhs);
+    }
+};
+
+struct bounded_sub
+{
+    template <typename T>
+    static constexpr value_bounds<T> bounds(value_bounds<T> aLhs,
+                                            value_bounds<T> aRhs) noexcept
+    {
+        T difference{};
+        const bool checked = sub_overflow(aLhs.min, aRhs.max, difference) ||
+                             sub_overflow(aLhs.max, aRhs.min, difference);
+        return {saturating_sub(aLhs.min, aRhs.max),
+                saturating_sub(aLhs.max, aRhs.min), checked};
+    }
+
+    template <typename T>
+    static constexpr T apply(value_bounds<T> aLhsBounds,
+                             value_bounds<T> aRhsBounds, T aLhs,
+                             T aRhs) noexcept
+    {
+        return bounds(aLhsBounds, aRhsBounds).checked
+                   ? checked_sub(aLhs, aRhs)
+                   : wrapping_sub(aLhs, aRhs);
+    }
+};
+
+struct bounded_mul
+{
+    template <typename T>
+    static constexpr value_bounds<T> bounds(value_bounds<T> aLhs,
+                                            value_bounds<T> aRhs) noexcept
+    {
+        // Extremes of a product are products of bounds.
+        const T products[] = {saturating_mul(aLhs.min, aRhs.min),
+                              saturating_mul(aLhs.min, aRhs.max),
+                              saturating_mul(aLhs.max, aRhs.min),
+                              saturating_mul(aLhs.max, aRhs.max)};
+        T product{};
+        const bool checked = mul_overflow(aLhs.min, aRhs.min, product) ||
+                             mul_overflow(aLhs.min, aRhs.max, product) ||
+                             mul_overflow(aLhs.max, aRhs.min, product) ||
+                             mul_overflow(aLhs.max, aRhs.max, product);
+        value_bounds<T> result{products[0], products[0], checked};
+        for (const T value: products)
+        {
+            result.min = min_of(result.min, value);
+            result.max = max_of(result.max, value);
+        }
+        return result;
+    }
+
+    template <typename T>
+    static constexpr T apply(value_bounds<T> aLhsBounds,
+                             value_bounds<T> aRhsBounds, T aLhs,
+                             T aRhs) noexcept
+    {
+        return bounds(aLhsBounds, aRhsBounds).checked
+                   ? checked_mul(aLhs, aRhs)
+                   : wrapping_mul(aLhs, aRhs);
+    }
+};
+
+// Division and remainder take positive divisors only, so they never
+// overflow.
+struct bounded_div
+{
+    template <typename T>
+    static constexpr value_bounds<T> bounds(value_bounds<T> aLhs,
+                                            value_bounds<T> aRhs) noexcept
+    {
+        // Divisors that give the smallest and the largest quotient.
+        const T minDivisor = aLhs.min < 0 ? aRhs.min : aRhs.max;
+        const T maxDivisor = aLhs.max < 0 ? aRhs.max : aRhs.min;
+        return {static_cast<T>(aLhs.min / minDivisor),
+                static_cast<T>(aLhs.max / maxDivisor)};
+    }
+
+    // Division of non-negative values is done without the rounding
+    // correction of signed division.
+    template <typename T>
+    static constexpr T apply(value_bounds<T> aLhsBounds, value_bounds<T>,
+                             T aLhs, T aRhs) noexcept
+    {
+        using unsigned_type = std::make_unsigned_t<T>;
+        return !(aLhsBounds.min < 0)
+                   ? static_cast<T>(static_cast<unsigned_type>(aLhs) /
+                                    static_cast<unsigned_type>(aRhs))
+                   : static_cast<T>(aLhs / aRhs);
+    }
+};
+
+struct bounded_mod
+{
+    template <typename T>
+    static constexpr value_bounds<T> bounds(value_bounds<T> aLhs,
+                                            value_bounds<T> aRhs) noexcept
+    {
+        // The remainder has the sign of the dividend, is smaller than the
+        // divisor in magnitude and not larger than the dividend.
+        const T largest = static_cast<T>(aRhs.max - 1);
+        if (!(aLhs.min < 0))
+        {
+            return aLhs.max < aRhs.min
+                       ? aLhs
+                       : value_bounds<T>{T{0}, min_of(aLhs.max, largest)};
+        }
+        if constexpr (std::is_signed_v<T>)
+        {
+            const T smallest = static_cast<T>(-largest);
+            if (!(0 < aLhs.max))
+            {
+                return -aRhs.min < aLhs.min
+                           ? aLhs
+                           : value_bounds<T>{max_of(aLhs.min, smallest),
+                                             T{0}};
+            }
+            return {max_of(aLhs.min, smallest), min_of(aLhs.max, largest)};
+        }
+        return aLhs;
+    }
+
+    // The remainder of a non-negative value smaller than every divisor is
+    // the value itself.
+    template <typename T>
+    static constexpr T apply(value_bounds<T> aLhsBounds,
+                             value_bounds<T> aRhsBounds, T aLhs,
+                             T aRhs) noexcept
+    {
+        using unsigned_type = std::make_unsigned_t<T>;
+        if (aLhsBounds.min < 0)
+        {
+            return static_cast<T>(aLhs % aRhs);
+        }
+        return aLhsBounds.max < aRhsBounds.min
+                   ? aLhs
+                   : static_cast<T>(static_cast<unsigned_type>(aLhs) %
+                                    static_cast<unsigned_type>(aRhs));
+    }
+};
+
+template <typename Operation, typename StrongT, typename U>
+constexpr auto bounded_apply(const StrongT& aLhs, const U& aRhs) noexcept
+{
+    using type = underlying_type<StrongT>;
+    using rhs_bounds = operand_bounds<StrongT, U>;
+    constexpr value_bounds<type> kLhs{tag_type<StrongT>::min,
+                                      tag_type<StrongT>::max};
+    constexpr value_bounds<type> kRhs = rhs_bounds::value;
+    if constexpr (std::is_same_v<Operation, bounded_div> ||
+                  std::is_same_v<Operation, bounded_mod>)
+    {
+        static_assert(0 < kRhs.min, "Divisor must be positive.");
+    }
+    constexpr value_bounds<type> kResult = Operation::bounds(kLhs, kRhs);
+    using result_type = typename bounded_traits<StrongT>::template rebind<
+        kResult.min, kResult.max>;
+
+    // The result is within kResult by construction: it is not checked.
+    return result_type(unchecked,
+                       Operation::apply(kLhs, kRhs, aLhs.get(),
+                                        rhs_bounds::get(aRhs)));
+}
+}  // namespace details
+
+template <typename T>
+inline constexpr bool is_bounded_v = details::bounded_traits<T>::value;
+
+// Arithmetic of bounded types whose results have the bounds of every
+// possible result: Percent{0..100} + Percent{0..100} is a bounded value in
+// [0, 200] with the same Tag. Operands are bounded values with the same Tag
+// and compile-time constants; divisors of / and % must be positive. The
+// operation checks for overflow only if the bounds of the result do not fit
+// in the underlying type; otherwise it is a plain instruction.
+template <typename StrongT>
+struct bounded_arithmetic
+{
+    template <typename U, typename = std::enable_if_t<
+                              details::is_bounded_operand_v<StrongT, U>>>
+    friend constexpr auto operator+(const StrongT& aLhs, const U& aRhs) noexcept
+    {
+        return details::bounded_apply<details::bounded_add>(aLhs, aRhs);
+    }
+
+    template <typename U, typename = std::enable_if_t<
+                              details::is_bounded_operand_v<StrongT, U>>>
+    friend constexpr auto operator-(const StrongT& aLhs, const U& aRhs) noexcept
+    {
+        return details::bounded_apply<details::bounded_sub>(aLhs, aRhs);
+    }
+
+    template <typename U, typename = std::enable_if_t<
+                              details::is_bounded_operand_v<StrongT, U>>>
+    friend constexpr auto operator*(const StrongT& aLhs, const U& aRhs) noexcept
+    {
+        return details::bounded_apply<details::bounded_mul>(aLhs, aRhs);
+    }
+
+    template <typename U, typename = std::enable_if_t<
+                              details::is_bounded_operand_v<StrongT, U>>>
+    friend constexpr auto operator/(const StrongT& aLhs, const U& aRhs) noexcept
+    {
+        return details::bounded_apply<details::bounded_div>(aLhs, aRhs);
+    }
+
+    template <typename U, typename = std::enable_if_t<
+                              details::is_bounded_operand_v<StrongT, U>>>
+    friend constexpr auto operator%(const StrongT& aLhs, const U& aRhs) noexcept
+    {
+        return details::bounded_apply<details::bounded_mod>(aLhs, aRhs);
+    }
+};
+
+// Converts aValue to the bounded type Target with the same Tag. Widening
+// conversions are free; conversions to a narrower range check the value
+// like construction does.
+template <typename Target, typename Source>
+constexpr Target bounded_cast(const Source& aValue) noexcept
+{
+    static_assert(is_bounded_v<Target> && is_bounded_v<Source>,
+                  "Invalid bounded types.");
+    static_assert(
+        std::is_same_v<typename details::bounded_traits<Target>::tag,
+                       typename details::bounded_traits<Source>::tag> &&
+            std::is_same_v<underlying_type<Target>, underlying_type<Source>>,
+        "Bounded types must have the same Tag and underlying type.");
+    if constexpr (!(tag_type<Source>::min < tag_type<Target>::min) &&
+                  !(tag_type<Target>::max < tag_type<Source>::max))
+    {
+        return Target(details::unchecked, aValue.get());
+    }
+    else
+    {
+        return Target(aValue.get());
+    }
+}
+
+// Converts aValue to the bounded type Target with the same Tag, clamping it
+// to the bounds of Target.
+template <typename Target, typename Source>
+constexpr Target bounded_clamp(const Source& aValue) noexcept
+{
+    static_assert(is_bounded_v<Target> && is_bounded_v<Source>,
+                  "Invalid bounded types.");
+    static_assert(
+        std::is_same_v<typename details::bounded_traits<Target>::tag,
+                       typename details::bounded_traits<Source>::tag> &&
+            std::is_same_v<underlying_type<Target>, underlying_type<Source>>,
+        "Bounded types must have the same Tag and underlying type.");
+    using tag = tag_type<Target>;
+    return Target(std::clamp(aValue.get(), tag::min, tag::max));
+}
+}  // namespace strong
+
+#endif /* strong_type_bounded_h */
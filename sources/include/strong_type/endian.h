@@ -0,0 +1,341 @@
+#ifndef strong_type_endian_h
+#define strong_type_endian_h
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "simd.h"
+#include "span.h"
+#include "strong_type.h"
+
+namespace strong
+{
+// Byte order, a copy of C++20 std::endian.
+enum class endian
+{
+    little,
+    big,
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    native = big
+#else
+    native = little
+#endif
+};
+
+namespace details
+{
+// Reverses bytes of aValue. Builtins compile to a single bswap (rev on ARM);
+// other compilers recognize the portable shifts.
+template <typename U>
+constexpr U byte_swap(U aValue) noexcept
+{
+    static_assert(std::is_unsigned_v<U>, "Invalid U.");
+    if constexpr (sizeof(U) == 1)
+    {
+        return aValue;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    else if constexpr (sizeof(U) == 2)
+    {
+        return __builtin_bswap16(aValue);
+    }
+    else if constexpr (sizeof(U) == 4)
+    {
+        return __builtin_bswap32(aValue);
+    }
+    else
+    {
+        return __builtin_bswap64(aValue);
+    }
+#else
+    else
+    {
+        U result = 0;
+        for (std::size_t i = 0; i < sizeof(U); ++i)
+        {
+            result = static_cast<U>((result << 8) | (aValue & 0xFFu));
+            aValue = static_cast<U>(aValue >> 8);
+        }
+        return result;
+    }
+#endif
+}
+}  // namespace details
+
+// Value of StrongT stored in byte order Order with alignment 1, so that
+// records of such fields can be laid over packed wire and file buffers.
+// Fields are never accessed as integers in place: load() and store() copy
+// bytes and swap them if Order is not native; both paths are chosen at
+// compile time and compile to a plain or a byte-swapping move.
+template <typename StrongT, endian Order>
+class endian_value
+{
+    static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+    using T = underlying_type<StrongT>;
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Underlying type must be trivially copyable.");
+    using U = details::unsigned_of_size_t<sizeof(T)>;
+
+   public:
+    using value_type = StrongT;
+    static constexpr endian order = Order;
+
+    endian_value() = default;
+    explicit endian_value(StrongT aValue) noexcept { store(aValue); }
+
+    StrongT load() const noexcept
+    {
+        U bits;
+        std::memcpy(&bits, bytes_, sizeof(bits));
+        if constexpr (Order != endian::native)
+        {
+            bits = details::byte_swap(bits);
+        }
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return StrongT(value);
+    }
+
+    void store(StrongT aValue) noexcept
+    {
+        U bits;
+        std::memcpy(&bits, &aValue.get(), sizeof(bits));
+        if constexpr (Order != endian::native)
+        {
+            bits = details::byte_swap(bits);
+        }
+        std::memcpy(bytes_, &bits, sizeof(bits));
+    }
+
+    explicit operator StrongT() const noexcept { return load(); }
+
+   private:
+    unsigned char bytes_[sizeof(T)];
+};
+
+template <typename StrongT>
+using big_endian = endian_value<StrongT, endian::big>;
+
+template <typename StrongT>
+using little_endian = endian_value<StrongT, endian::little>;
+
+template <typename T>
+struct is_endian_value : std::false_type
+{
+};
+
+template <typename StrongT, endian Order>
+struct is_endian_value<endian_value<StrongT, Order>> : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool is_endian_value_v = is_endian_value<T>::value;
+
+namespace simd::details
+{
+// Copies aCount values swapping bytes of every Size-byte element.
+template <std::size_t Size>
+void swap_bytes_scalar(const unsigned char* aIn, unsigned char* aOut,
+                       std::size_t aCount) noexcept
+{
+    using U = strong::details::unsigned_of_size_t<Size>;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        U bits;
+        std::memcpy(&bits, aIn + i * Size, Size);
+        bits = strong::details::byte_swap(bits);
+        std::memcpy(aOut + i * Size, &bits, Size);
+    }
+}
+
+#if STRONG_TYPE_SIMD_X86
+// pshufb control that reverses every Size-byte element, as wide as a
+// 512-bit register (narrower registers load its beginning).
+template <std::size_t Size>
+struct byte_swap_mask
+{
+    static constexpr auto make() noexcept
+    {
+        struct bytes
+        {
+            char value[64];
+        } mask{};
+        for (std::size_t i = 0; i < 64; ++i)
+        {
+            mask.value[i] =
+                static_cast<char>(i % 16 / Size * Size + Size - 1 - i % Size);
+        }
+        return mask;
+    }
+
+    static constexpr auto kMask = make();
+};
+
+// SSE2 has no byte shuffle: bytes of 16-bit words are swapped with shifts
+// and words of wider elements are reversed with pshuflw/pshufhw.
+template <std::size_t Size>
+STRONG_TYPE_SIMD_INLINE __m128i swap_lanes_sse2(__m128i aValue) noexcept
+{
+    __m128i value =
+        _mm_or_si128(_mm_slli_epi16(aValue, 8), _mm_srli_epi16(aValue, 8));
+    if constexpr (Size == 4)
+    {
+        value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+        value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    else if constexpr (Size == 8)
+    {
+        value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+        value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+    }
+    return value;
+}
+
+template <std::size_t Size>
+void swap_bytes_sse2(const unsigned char* aIn, unsigned char* aOut,
+                     std::size_t aCount) noexcept
+{
+    constexpr std::size_t kLanes = sizeof(__m128i) / Size;
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        const __m128i value =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(aIn + i * Size));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(aOut + i * Size),
+                         swap_lanes_sse2<Size>(value));
+    }
+    swap_bytes_scalar<Size>(aIn + i * Size, aOut + i * Size, aCount - i);
+}
+
+template <std::size_t Size>
+STRONG_TYPE_TARGET("avx2")
+void swap_bytes_avx2(const unsigned char* aIn, unsigned char* aOut,
+                     std::size_t aCount) noexcept
+{
+    constexpr std::size_t kLanes = sizeof(__m256i) / Size;
+    const __m256i mask = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(byte_swap_mask<Size>::kMask.value));
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        const __m256i value = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(aIn + i * Size));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(aOut + i * Size),
+                            _mm256_shuffle_epi8(value, mask));
+    }
+    swap_bytes_scalar<Size>(aIn + i * Size, aOut + i * Size, aCount - i);
+}
+
+template <std::size_t Size>
+STRONG_TYPE_TARGET("avx512f,avx512bw")
+void swap_bytes_avx512(const unsigned char* aIn, unsigned char* aOut,
+                       std::size_t aCount) noexcept
+{
+    constexpr std::size_t kLanes = sizeof(__m512i) / Size;
+    const __m512i mask = _mm512_loadu_si512(byte_swap_mask<Size>::kMask.value);
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        const __m512i value = _mm512_loadu_si512(aIn + i * Size);
+        _mm512_storeu_si512(aOut + i * Size,
+                            _mm512_shuffle_epi8(value, mask));
+    }
+    swap_bytes_scalar<Size>(aIn + i * Size, aOut + i * Size, aCount - i);
+}
+#endif
+
+template <std::size_t Size>
+void dispatch_swap_bytes(const unsigned char* aIn, unsigned char* aOut,
+                         std::size_t aCount, target aTarget) noexcept
+{
+#if STRONG_TYPE_SIMD_X86
+    if constexpr (Size > 1)
+    {
+        switch (clamp(aTarget))
+        {
+            case target::avx512:
+                return swap_bytes_avx512<Size>(aIn, aOut, aCount);
+            case target::avx2:
+                return swap_bytes_avx2<Size>(aIn, aOut, aCount);
+            case target::sse2:
+                return swap_bytes_sse2<Size>(aIn, aOut, aCount);
+            default:
+                break;
+        }
+    }
+#endif
+    (void)aTarget;
+    swap_bytes_scalar<Size>(aIn, aOut, aCount);
+}
+
+// Copies values between ranges of StrongT and of endian_value<StrongT>:
+// a single memcpy for native order and a byte swap of every element
+// otherwise.
+template <endian Order, typename StrongT>
+void convert_order(const void* aIn, void* aOut, std::size_t aCount,
+                   target aTarget) noexcept
+{
+    constexpr std::size_t kSize = sizeof(underlying_type<StrongT>);
+    if constexpr (Order == endian::native || kSize == 1)
+    {
+        if (aCount != 0)
+        {
+            std::memmove(aOut, aIn, aCount * kSize);
+        }
+    }
+    else
+    {
+        dispatch_swap_bytes<kSize>(static_cast<const unsigned char*>(aIn),
+                                   static_cast<unsigned char*>(aOut), aCount,
+                                   aTarget);
+    }
+}
+}  // namespace simd::details
+
+namespace simd
+{
+// aOut[i] = aIn[i].load() for a range of endian_value, e.g. an array of
+// big_endian fields in a memory-mapped file. Foreign byte order is swapped
+// with pshufb (AVX2, AVX-512) or shifts and word shuffles (SSE2); native
+// order is a plain copy.
+template <typename InRange, typename OutRange>
+void load_native(const InRange& aIn, OutRange&& aOut,
+                 target aTarget = best_target()) noexcept
+{
+    using E = details::range_value_t<const InRange>;
+    static_assert(is_endian_value_v<E>, "Input must be endian values.");
+    using StrongT = typename E::value_type;
+    static_assert(std::is_same_v<StrongT, details::range_value_t<OutRange>>,
+                  "Output must be values of the stored strong type.");
+    const span<const E> in(aIn);
+    const span<StrongT> out(aOut);
+    assert(in.size() == out.size() && "Ranges must have the same size.");
+    details::convert_order<E::order, StrongT>(in.data(), out.data(),
+                                              out.size(), aTarget);
+}
+
+// aOut[i].store(aIn[i]), the reverse of load_native.
+template <typename InRange, typename OutRange>
+void store_native(const InRange& aIn, OutRange&& aOut,
+                  target aTarget = best_target()) noexcept
+{
+    using E = details::range_value_t<OutRange>;
+    static_assert(is_endian_value_v<E>, "Output must be endian values.");
+    using StrongT = typename E::value_type;
+    static_assert(
+        std::is_same_v<StrongT, details::range_value_t<const InRange>>,
+        "Input must be values of the stored strong type.");
+    const span<const StrongT> in(aIn);
+    const span<E> out(aOut);
+    assert(in.size() == out.size() && "Ranges must have the same size.");
+    details::convert_order<E::order, StrongT>(in.data(), out.data(),
+                                              out.size(), aTarget);
+}
+}  // namespace simd
+}  // namespace strong
+
+#endif /* strong_type_endian_h */
@@ -0,0 +1,814 @@
+#ifndef strong_type_fixed_point_h
+#define strong_type_fixed_point_h
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "simd.h"
+#include "span.h"
+#include "strong_type.h"
+
+namespace strong
+{
+// How operations drop fraction bits that do not fit the result:
+// toward_zero - truncation like integer division, down - toward negative
+// infinity like arithmetic shift, nearest - to the nearest value with halves
+// rounded away from zero like std::round.
+enum class rounding
+{
+    toward_zero,
+    down,
+    nearest
+};
+
+// Tag of a fixed_point: user tag, number of fraction bits and the rounding
+// of every operation that drops bits.
+template <typename Tag, int FractionBits, rounding Rounding>
+struct fixed_point_tag
+{
+    using tag = Tag;
+    static constexpr int fraction_bits = FractionBits;
+    static constexpr rounding default_rounding = Rounding;
+};
+
+namespace details
+{
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#define STRONG_TYPE_HAS_INT128 1
+#else
+#define STRONG_TYPE_HAS_INT128 0
+#endif
+
+// Integer type that holds the product of two values of T and the dividend
+// of fixed point division.
+template <typename T, std::size_t Size = sizeof(T)>
+struct wide_integer
+{
+    static_assert(Size <= 4 || STRONG_TYPE_HAS_INT128,
+                  "64-bit fixed_point requires 128-bit integer type.");
+};
+
+template <typename T>
+struct wide_integer<T, 1>
+{
+    using type =
+        std::conditional_t<std::is_signed_v<T>, std::int32_t, std::uint32_t>;
+};
+
+template <typename T>
+struct wide_integer<T, 2>
+{
+    using type =
+        std::conditional_t<std::is_signed_v<T>, std::int32_t, std::uint32_t>;
+};
+
+template <typename T>
+struct wide_integer<T, 4>
+{
+    using type =
+        std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+};
+
+#if STRONG_TYPE_HAS_INT128
+template <typename T>
+struct wide_integer<T, 8>
+{
+    using type = std::conditional_t<std::is_signed_v<T>, int128_t, uint128_t>;
+};
+#endif
+
+template <typename T>
+using wide_t = typename wide_integer<T>::type;
+
+// aValue / 2^Bits rounded with R. Signed tells whether aValue may be
+// negative; traits of W are not usable for 128-bit integers in strict ISO
+// mode.
+template <rounding R, int Bits, bool Signed, typename W>
+constexpr W shift_right_rounded(W aValue) noexcept
+{
+    if constexpr (Bits == 0)
+    {
+        return aValue;
+    }
+    else
+    {
+        constexpr W kMask = (W{1} << Bits) - 1;
+        constexpr W kHalf = W{1} << (Bits - 1);
+        if constexpr (R == rounding::down ||
+                      (!Signed && R == rounding::toward_zero))
+        {
+            return aValue >> Bits;
+        }
+        else if constexpr (R == rounding::toward_zero)
+        {
+            return (aValue + (aValue < 0 ? kMask : W{0})) >> Bits;
+        }
+        else if constexpr (Signed)
+        {
+            return (aValue + kHalf - (aValue < 0 ? W{1} : W{0})) >> Bits;
+        }
+        else
+        {
+            return (aValue + kHalf) >> Bits;
+        }
+    }
+}
+
+// aNum / aDen rounded with R.
+template <rounding R, bool Signed, typename W>
+constexpr W divide_rounded(W aNum, W aDen) noexcept
+{
+    W quotient = aNum / aDen;
+    const W remainder = aNum % aDen;
+    if constexpr (R == rounding::down && Signed)
+    {
+        if (remainder != 0 && ((remainder < 0) != (aDen < 0)))
+        {
+            --quotient;
+        }
+    }
+    else if constexpr (R == rounding::nearest && Signed)
+    {
+        const W twice = 2 * (remainder < 0 ? -remainder : remainder);
+        if (twice >= (aDen < 0 ? -aDen : aDen))
+        {
+            quotient += (aNum < 0) == (aDen < 0) ? W{1} : W{-1};
+        }
+    }
+    else if constexpr (R == rounding::nearest)
+    {
+        if (2 * remainder >= aDen)
+        {
+            ++quotient;
+        }
+    }
+    return quotient;
+}
+
+// aValue rounded with R to an integer of type T.
+template <rounding R, typename T, typename F>
+constexpr T round_floating(F aValue) noexcept
+{
+    if constexpr (R == rounding::toward_zero)
+    {
+        return static_cast<T>(aValue);
+    }
+    else if constexpr (R == rounding::down)
+    {
+        const T truncated = static_cast<T>(aValue);
+        return static_cast<F>(truncated) > aValue
+                   ? static_cast<T>(truncated - 1)
+                   : truncated;
+    }
+    else
+    {
+        return static_cast<T>(aValue < 0 ? aValue - F{0.5} : aValue + F{0.5});
+    }
+}
+}  // namespace details
+
+template <typename T>
+struct is_fixed_point : std::false_type
+{
+};
+
+template <typename StrongT>
+struct fixed_point_arithmetic;
+
+// Multiplication and division of fixed point values with the rounding of
+// the type, multiplication by integers and division by integers.
+// Intermediate values are twice as wide as the underlying type, so the
+// only overflow is the one of the result.
+template <typename Tag, typename T, template <typename> typename... Ops>
+struct fixed_point_arithmetic<strong_type<Tag, T, Ops...>>
+{
+   private:
+    using fixed = strong_type<Tag, T, Ops...>;
+    using W = details::wide_t<T>;
+    static constexpr int kBits = Tag::fraction_bits;
+    static constexpr rounding kRounding = Tag::default_rounding;
+    static constexpr bool kSigned = std::is_signed_v<T>;
+
+   public:
+    friend constexpr fixed operator*(const fixed& aLhs,
+                                     const fixed& aRhs) noexcept
+    {
+        return fixed(static_cast<T>(
+            details::shift_right_rounded<kRounding, kBits, kSigned>(
+                static_cast<W>(static_cast<W>(aLhs.get()) *
+                               static_cast<W>(aRhs.get())))));
+    }
+
+    friend constexpr fixed operator/(const fixed& aLhs,
+                                     const fixed& aRhs) noexcept
+    {
+        return fixed(static_cast<T>(details::divide_rounded<kRounding, kSigned>(
+            static_cast<W>(static_cast<W>(aLhs.get()) * (W{1} << kBits)),
+            static_cast<W>(aRhs.get()))));
+    }
+
+    friend constexpr fixed& operator*=(fixed& aLhs, const fixed& aRhs) noexcept
+    {
+        aLhs = aLhs * aRhs;
+        return aLhs;
+    }
+
+    friend constexpr fixed& operator/=(fixed& aLhs, const fixed& aRhs) noexcept
+    {
+        aLhs = aLhs / aRhs;
+        return aLhs;
+    }
+
+    friend constexpr fixed operator*(const fixed& aLhs, T aRhs) noexcept
+    {
+        return fixed(static_cast<T>(aLhs.get() * aRhs));
+    }
+
+    friend constexpr fixed operator*(T aLhs, const fixed& aRhs) noexcept
+    {
+        return fixed(static_cast<T>(aLhs * aRhs.get()));
+    }
+
+    friend constexpr fixed operator/(const fixed& aLhs, T aRhs) noexcept
+    {
+        return fixed(static_cast<T>(details::divide_rounded<kRounding, kSigned>(
+            static_cast<W>(aLhs.get()), static_cast<W>(aRhs))));
+    }
+};
+
+// Binary fixed point number in Q format: T holds the value multiplied by
+// 2^FractionBits. Addition, subtraction and comparisons are those of T;
+// multiplication and division go through twice as wide integers and round
+// with Rounding. Division by zero and results out of range of T behave like
+// the same errors of integer arithmetic.
+template <typename Tag, typename T, int FractionBits,
+          rounding Rounding = rounding::nearest>
+using fixed_point =
+    strong_type<fixed_point_tag<Tag, FractionBits, Rounding>, T, comparisons,
+                plus, plus_assignment, minus, minus_assignment, unary_minus,
+                fixed_point_arithmetic>;
+
+template <typename Tag, typename T, int FractionBits, rounding Rounding>
+struct is_fixed_point<fixed_point<Tag, T, FractionBits, Rounding>>
+    : std::true_type
+{
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                  "fixed_point requires integral underlying type.");
+    static_assert(FractionBits >= 0 &&
+                      FractionBits < std::numeric_limits<T>::digits,
+                  "Invalid number of fraction bits.");
+};
+
+template <typename T>
+inline constexpr bool is_fixed_point_v = is_fixed_point<T>::value;
+
+template <typename FixedT>
+inline constexpr int fraction_bits_v = tag_type<FixedT>::fraction_bits;
+
+template <typename FixedT>
+inline constexpr rounding rounding_v = tag_type<FixedT>::default_rounding;
+
+// aLhs * aRhs and aLhs / aRhs with rounding other than the default one of
+// the type.
+template <rounding R, typename FixedT>
+constexpr FixedT multiply(const FixedT& aLhs, const FixedT& aRhs) noexcept
+{
+    static_assert(is_fixed_point_v<FixedT>, "Invalid FixedT.");
+    using T = underlying_type<FixedT>;
+    using W = details::wide_t<T>;
+    return FixedT(static_cast<T>(
+        details::shift_right_rounded<R, fraction_bits_v<FixedT>,
+                                     std::is_signed_v<T>>(static_cast<W>(
+            static_cast<W>(aLhs.get()) * static_cast<W>(aRhs.get())))));
+}
+
+template <rounding R, typename FixedT>
+constexpr FixedT divide(const FixedT& aLhs, const FixedT& aRhs) noexcept
+{
+    static_assert(is_fixed_point_v<FixedT>, "Invalid FixedT.");
+    using T = underlying_type<FixedT>;
+    using W = details::wide_t<T>;
+    return FixedT(
+        static_cast<T>(details::divide_rounded<R, std::is_signed_v<T>>(
+            static_cast<W>(static_cast<W>(aLhs.get()) *
+                           (W{1} << fraction_bits_v<FixedT>)),
+            static_cast<W>(aRhs.get()))));
+}
+
+// Fixed point value of an integer or a floating point number. Floating point
+// values are rounded with the rounding of FixedT; usable in constant
+// expressions, e.g. constexpr auto kRate = to_fixed_point<Price>(0.0125).
+template <typename FixedT, typename T>
+constexpr FixedT to_fixed_point(T aValue) noexcept
+{
+    static_assert(is_fixed_point_v<FixedT>, "Invalid FixedT.");
+    static_assert(std::is_arithmetic_v<T>, "Invalid T.");
+    using U = underlying_type<FixedT>;
+    constexpr int kBits = fraction_bits_v<FixedT>;
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        constexpr T kScale = static_cast<T>(std::uintmax_t{1} << kBits);
+        return FixedT(
+            details::round_floating<rounding_v<FixedT>, U>(aValue * kScale));
+    }
+    else
+    {
+        return FixedT(static_cast<U>(static_cast<U>(aValue) * (U{1} << kBits)));
+    }
+}
+
+// Value of aValue as a floating point number, or as an integer rounded with
+// the rounding of FixedT.
+template <typename T, typename FixedT>
+constexpr T from_fixed_point(const FixedT& aValue) noexcept
+{
+    static_assert(is_fixed_point_v<FixedT>, "Invalid FixedT.");
+    static_assert(std::is_arithmetic_v<T>, "Invalid T.");
+    using U = underlying_type<FixedT>;
+    using W = details::wide_t<U>;
+    constexpr int kBits = fraction_bits_v<FixedT>;
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        constexpr T kScale = static_cast<T>(std::uintmax_t{1} << kBits);
+        return static_cast<T>(aValue.get()) / kScale;
+    }
+    else
+    {
+        return static_cast<T>(
+            details::shift_right_rounded<rounding_v<FixedT>, kBits,
+                                         std::is_signed_v<U>>(
+                static_cast<W>(aValue.get())));
+    }
+}
+
+// Converts between fixed point types with different numbers of fraction
+// bits or underlying types. Dropped bits are rounded with the rounding of
+// ToF.
+template <typename ToF, typename FromF>
+constexpr ToF fixed_point_cast(const FromF& aFrom) noexcept
+{
+    static_assert(is_fixed_point_v<ToF> && is_fixed_point_v<FromF>,
+                  "Invalid fixed point types.");
+    using To = underlying_type<ToF>;
+    using From = underlying_type<FromF>;
+    using W = details::wide_t<std::conditional_t<(sizeof(To) > sizeof(From)),
+                                                 To, From>>;
+    constexpr int kShift = fraction_bits_v<ToF> - fraction_bits_v<FromF>;
+    const W value = static_cast<W>(aFrom.get());
+    if constexpr (kShift >= 0)
+    {
+        return ToF(static_cast<To>(value * (W{1} << kShift)));
+    }
+    else
+    {
+        return ToF(static_cast<To>(
+            details::shift_right_rounded<rounding_v<ToF>, -kShift,
+                                         std::is_signed_v<From>>(value)));
+    }
+}
+
+namespace simd::details
+{
+template <bool Broadcast, typename FixedT>
+void fixed_multiply_scalar(const FixedT* aLhs, const FixedT* aRhs,
+                           const FixedT* aScalar, FixedT* aOut,
+                           std::size_t aCount) noexcept
+{
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        aOut[i] = aLhs[i] * (Broadcast ? *aScalar : aRhs[i]);
+    }
+}
+
+#if STRONG_TYPE_SIMD_X86
+// Products of 16-bit lanes are assembled from pmullw and pmulhw halves into
+// 32-bit lanes; products of 32-bit lanes come from pmuldq (pmuludq) of even
+// and odd lanes into 64-bit lanes, which needs AVX2 for the signed
+// multiplication and 64-bit comparison. Products are rounded with the same
+// formulas as in operator*, so results do not depend on the instruction
+// set. Other lane widths use the scalar loop.
+template <typename T>
+inline constexpr bool has_fixed_sse2_v = sizeof(T) == 2;
+
+template <typename T>
+inline constexpr bool has_fixed_avx_v = sizeof(T) == 2 || sizeof(T) == 4;
+
+template <typename FixedT>
+struct fixed_constants
+{
+    using T = underlying_type<FixedT>;
+    static constexpr int kBits = fraction_bits_v<FixedT>;
+    // Products of integers are exact and need no rounding, like in
+    // shift_right_rounded.
+    static constexpr rounding kRounding =
+        kBits == 0 ? rounding::down : rounding_v<FixedT>;
+    static constexpr bool kSigned = std::is_signed_v<T>;
+    static constexpr long long kHalf = kBits == 0 ? 0 : 1ll << (kBits - 1);
+    static constexpr long long kMask = (1ll << kBits) - 1;
+};
+
+template <typename FixedT>
+STRONG_TYPE_SIMD_INLINE __m128i fixed_lanes_sse2(__m128i aLhs,
+                                                 __m128i aRhs) noexcept
+{
+    using C = fixed_constants<FixedT>;
+    const __m128i low = _mm_mullo_epi16(aLhs, aRhs);
+    const __m128i high = C::kSigned ? _mm_mulhi_epi16(aLhs, aRhs)
+                                    : _mm_mulhi_epu16(aLhs, aRhs);
+    __m128i products[2] = {_mm_unpacklo_epi16(low, high),
+                           _mm_unpackhi_epi16(low, high)};
+    for (auto& product: products)
+    {
+        if constexpr (C::kSigned)
+        {
+            const __m128i sign = _mm_srai_epi32(product, 31);
+            if constexpr (C::kRounding == rounding::toward_zero)
+            {
+                product = _mm_add_epi32(
+                    product,
+                    _mm_and_si128(sign, _mm_set1_epi32(int{C::kMask})));
+            }
+            else if constexpr (C::kRounding == rounding::nearest)
+            {
+                product = _mm_add_epi32(
+                    product,
+                    _mm_add_epi32(_mm_set1_epi32(int{C::kHalf}), sign));
+            }
+            product = _mm_srai_epi32(product, C::kBits);
+        }
+        else
+        {
+            if constexpr (C::kRounding == rounding::nearest)
+            {
+                product =
+                    _mm_add_epi32(product, _mm_set1_epi32(int{C::kHalf}));
+            }
+            product = _mm_srli_epi32(product, C::kBits);
+        }
+        // Low halves sign-extended pass packssdw without saturation.
+        product = _mm_srai_epi32(_mm_slli_epi32(product, 16), 16);
+    }
+    return _mm_packs_epi32(products[0], products[1]);
+}
+
+template <bool Broadcast, typename FixedT>
+void fixed_multiply_sse2(const FixedT* aLhs, const FixedT* aRhs,
+                         const FixedT* aScalar, FixedT* aOut,
+                         std::size_t aCount) noexcept
+{
+    using T = underlying_type<FixedT>;
+    constexpr std::size_t kLanes = sizeof(__m128i) / sizeof(T);
+
+    __m128i rhs = _mm_setzero_si128();
+    if constexpr (Broadcast)
+    {
+        rhs = _mm_set1_epi16(static_cast<short>(aScalar->get()));
+    }
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        const __m128i lhs =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(aLhs + i));
+        if constexpr (!Broadcast)
+        {
+            rhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aRhs + i));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(aOut + i),
+                         fixed_lanes_sse2<FixedT>(lhs, rhs));
+    }
+    fixed_multiply_scalar<Broadcast>(aLhs + i, Broadcast ? aRhs : aRhs + i,
+                                     aScalar, aOut + i, aCount - i);
+}
+
+template <typename FixedT>
+STRONG_TYPE_TARGET("avx2")
+STRONG_TYPE_SIMD_INLINE __m256i fixed_lanes_avx2(__m256i aLhs,
+                                                 __m256i aRhs) noexcept
+{
+    using C = fixed_constants<FixedT>;
+    if constexpr (sizeof(underlying_type<FixedT>) == 2)
+    {
+        const __m256i low = _mm256_mullo_epi16(aLhs, aRhs);
+        const __m256i high = C::kSigned ? _mm256_mulhi_epi16(aLhs, aRhs)
+                                        : _mm256_mulhi_epu16(aLhs, aRhs);
+        __m256i products[2] = {_mm256_unpacklo_epi16(low, high),
+                               _mm256_unpackhi_epi16(low, high)};
+        for (auto& product: products)
+        {
+            if constexpr (C::kSigned)
+            {
+                const __m256i sign = _mm256_srai_epi32(product, 31);
+                if constexpr (C::kRounding == rounding::toward_zero)
+                {
+                    product = _mm256_add_epi32(
+                        product, _mm256_and_si256(
+                                     sign, _mm256_set1_epi32(int{C::kMask})));
+                }
+                else if constexpr (C::kRounding == rounding::nearest)
+                {
+                    product = _mm256_add_epi32(
+                        product, _mm256_add_epi32(
+                                     _mm256_set1_epi32(int{C::kHalf}), sign));
+                }
+                product = _mm256_srai_epi32(product, C::kBits);
+            }
+            else
+            {
+                if constexpr (C::kRounding == rounding::nearest)
+                {
+                    product = _mm256_add_epi32(
+                        product, _mm256_set1_epi32(int{C::kHalf}));
+                }
+                product = _mm256_srli_epi32(product, C::kBits);
+            }
+            product = _mm256_srai_epi32(_mm256_slli_epi32(product, 16), 16);
+        }
+        return _mm256_packs_epi32(products[0], products[1]);
+    }
+    else
+    {
+        // Lanes 0, 2, 4 and 6 go to even products, 1, 3, 5 and 7 to odd.
+        __m256i products[2] = {
+            C::kSigned ? _mm256_mul_epi32(aLhs, aRhs)
+                       : _mm256_mul_epu32(aLhs, aRhs),
+            C::kSigned ? _mm256_mul_epi32(_mm256_srli_epi64(aLhs, 32),
+                                          _mm256_srli_epi64(aRhs, 32))
+                       : _mm256_mul_epu32(_mm256_srli_epi64(aLhs, 32),
+                                          _mm256_srli_epi64(aRhs, 32))};
+        for (auto& product: products)
+        {
+            if constexpr (C::kSigned)
+            {
+                const __m256i sign =
+                    _mm256_cmpgt_epi64(_mm256_setzero_si256(), product);
+                if constexpr (C::kRounding == rounding::toward_zero)
+                {
+                    product = _mm256_add_epi64(
+                        product,
+                        _mm256_and_si256(sign, _mm256_set1_epi64x(C::kMask)));
+                }
+                else if constexpr (C::kRounding == rounding::nearest)
+                {
+                    product = _mm256_add_epi64(
+                        product,
+                        _mm256_add_epi64(_mm256_set1_epi64x(C::kHalf), sign));
+                }
+            }
+            else if constexpr (C::kRounding == rounding::nearest)
+            {
+                product =
+                    _mm256_add_epi64(product, _mm256_set1_epi64x(C::kHalf));
+            }
+            // Fraction bits are fewer than 32, so low halves of logical and
+            // arithmetic shifts are the same.
+            product = _mm256_srli_epi64(product, C::kBits);
+        }
+        return _mm256_blend_epi32(products[0],
+                                  _mm256_slli_epi64(products[1], 32), 0xAA);
+    }
+}
+
+template <bool Broadcast, typename FixedT>
+STRONG_TYPE_TARGET("avx2")
+void fixed_multiply_avx2(const FixedT* aLhs, const FixedT* aRhs,
+                         const FixedT* aScalar, FixedT* aOut,
+                         std::size_t aCount) noexcept
+{
+    using T = underlying_type<FixedT>;
+    constexpr std::size_t kLanes = sizeof(__m256i) / sizeof(T);
+
+    __m256i rhs = _mm256_setzero_si256();
+    if constexpr (Broadcast && sizeof(T) == 2)
+    {
+        rhs = _mm256_set1_epi16(static_cast<short>(aScalar->get()));
+    }
+    else if constexpr (Broadcast)
+    {
+        rhs = _mm256_set1_epi32(static_cast<int>(aScalar->get()));
+    }
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        const __m256i lhs =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aLhs + i));
+        if constexpr (!Broadcast)
+        {
+            rhs = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(aRhs + i));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(aOut + i),
+                            fixed_lanes_avx2<FixedT>(lhs, rhs));
+    }
+    fixed_multiply_scalar<Broadcast>(aLhs + i, Broadcast ? aRhs : aRhs + i,
+                                     aScalar, aOut + i, aCount - i);
+}
+
+// GCC 12 reports the undefined passthrough operand of AVX-512 shift and
+// multiplication intrinsics as uninitialized.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+template <typename FixedT>
+STRONG_TYPE_TARGET("avx512f,avx512bw")
+STRONG_TYPE_SIMD_INLINE __m512i fixed_lanes_avx512(__m512i aLhs,
+                                                   __m512i aRhs) noexcept
+{
+    using C = fixed_constants<FixedT>;
+    if constexpr (sizeof(underlying_type<FixedT>) == 2)
+    {
+        const __m512i low = _mm512_mullo_epi16(aLhs, aRhs);
+        const __m512i high = C::kSigned ? _mm512_mulhi_epi16(aLhs, aRhs)
+                                        : _mm512_mulhi_epu16(aLhs, aRhs);
+        __m512i products[2] = {_mm512_unpacklo_epi16(low, high),
+                               _mm512_unpackhi_epi16(low, high)};
+        for (auto& product: products)
+        {
+            if constexpr (C::kSigned)
+            {
+                const __m512i sign = _mm512_srai_epi32(product, 31);
+                if constexpr (C::kRounding == rounding::toward_zero)
+                {
+                    product = _mm512_add_epi32(
+                        product, _mm512_and_si512(
+                                     sign, _mm512_set1_epi32(int{C::kMask})));
+                }
+                else if constexpr (C::kRounding == rounding::nearest)
+                {
+                    product = _mm512_add_epi32(
+                        product, _mm512_add_epi32(
+                                     _mm512_set1_epi32(int{C::kHalf}), sign));
+                }
+                product = _mm512_srai_epi32(product, C::kBits);
+            }
+            else
+            {
+                if constexpr (C::kRounding == rounding::nearest)
+                {
+                    product = _mm512_add_epi32(
+                        product, _mm512_set1_epi32(int{C::kHalf}));
+                }
+                product = _mm512_srli_epi32(product, C::kBits);
+            }
+            product = _mm512_srai_epi32(_mm512_slli_epi32(product, 16), 16);
+        }
+        return _mm512_packs_epi32(products[0], products[1]);
+    }
+    else
+    {
+        __m512i products[2] = {
+            C::kSigned ? _mm512_mul_epi32(aLhs, aRhs)
+                       : _mm512_mul_epu32(aLhs, aRhs),
+            C::kSigned ? _mm512_mul_epi32(_mm512_srli_epi64(aLhs, 32),
+                                          _mm512_srli_epi64(aRhs, 32))
+                       : _mm512_mul_epu32(_mm512_srli_epi64(aLhs, 32),
+                                          _mm512_srli_epi64(aRhs, 32))};
+        for (auto& product: products)
+        {
+            if constexpr (C::kSigned)
+            {
+                const __m512i sign = _mm512_srai_epi64(product, 63);
+                if constexpr (C::kRounding == rounding::toward_zero)
+                {
+                    product = _mm512_add_epi64(
+                        product,
+                        _mm512_and_si512(sign, _mm512_set1_epi64(C::kMask)));
+                }
+                else if constexpr (C::kRounding == rounding::nearest)
+                {
+                    product = _mm512_add_epi64(
+                        product,
+                        _mm512_add_epi64(_mm512_set1_epi64(C::kHalf), sign));
+                }
+            }
+            else if constexpr (C::kRounding == rounding::nearest)
+            {
+                product =
+                    _mm512_add_epi64(product, _mm512_set1_epi64(C::kHalf));
+            }
+            product = _mm512_srli_epi64(product, C::kBits);
+        }
+        return _mm512_mask_blend_epi32(
+            0xAAAA, products[0], _mm512_slli_epi64(products[1], 32));
+    }
+}
+
+template <bool Broadcast, typename FixedT>
+STRONG_TYPE_TARGET("avx512f,avx512bw")
+void fixed_multiply_avx512(const FixedT* aLhs, const FixedT* aRhs,
+                           const FixedT* aScalar, FixedT* aOut,
+                           std::size_t aCount) noexcept
+{
+    using T = underlying_type<FixedT>;
+    constexpr std::size_t kLanes = sizeof(__m512i) / sizeof(T);
+
+    __m512i rhs = _mm512_setzero_si512();
+    if constexpr (Broadcast && sizeof(T) == 2)
+    {
+        rhs = _mm512_set1_epi16(static_cast<short>(aScalar->get()));
+    }
+    else if constexpr (Broadcast)
+    {
+        rhs = _mm512_set1_epi32(static_cast<int>(aScalar->get()));
+    }
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        const __m512i lhs = _mm512_loadu_si512(aLhs + i);
+        if constexpr (!Broadcast)
+        {
+            rhs = _mm512_loadu_si512(aRhs + i);
+        }
+        _mm512_storeu_si512(aOut + i, fixed_lanes_avx512<FixedT>(lhs, rhs));
+    }
+    fixed_multiply_scalar<Broadcast>(aLhs + i, Broadcast ? aRhs : aRhs + i,
+                                     aScalar, aOut + i, aCount - i);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+template <bool Broadcast, typename FixedT>
+void dispatch_fixed_multiply(const FixedT* aLhs, const FixedT* aRhs,
+                             const FixedT* aScalar, FixedT* aOut,
+                             std::size_t aCount, target aTarget) noexcept
+{
+    static_assert(is_fixed_point_v<FixedT>, "Invalid FixedT.");
+#if STRONG_TYPE_SIMD_X86
+    using T = underlying_type<FixedT>;
+    switch (clamp(aTarget))
+    {
+        case target::avx512:
+            if constexpr (has_fixed_avx_v<T>)
+            {
+                return fixed_multiply_avx512<Broadcast>(aLhs, aRhs, aScalar,
+                                                        aOut, aCount);
+            }
+            break;
+        case target::avx2:
+            if constexpr (has_fixed_avx_v<T>)
+            {
+                return fixed_multiply_avx2<Broadcast>(aLhs, aRhs, aScalar,
+                                                      aOut, aCount);
+            }
+            break;
+        case target::sse2:
+            if constexpr (has_fixed_sse2_v<T>)
+            {
+                return fixed_multiply_sse2<Broadcast>(aLhs, aRhs, aScalar,
+                                                      aOut, aCount);
+            }
+            break;
+        default:
+            break;
+    }
+#endif
+    (void)aTarget;
+    fixed_multiply_scalar<Broadcast>(aLhs, aRhs, aScalar, aOut, aCount);
+}
+}  // namespace simd::details
+
+namespace simd
+{
+// Element-wise aOut[i] = aLhs[i] * aRhs[i] of fixed_point ranges, rounded
+// like operator*. 16- and 32-bit values are multiplied in vector registers
+// (32-bit ones with AVX2 and AVX-512); other values use the scalar loop.
+template <typename LhsRange, typename RhsRange, typename OutRange>
+std::enable_if_t<!is_strong_v<RhsRange>> fixed_multiply(
+    const LhsRange& aLhs, const RhsRange& aRhs, OutRange&& aOut,
+    target aTarget = best_target()) noexcept
+{
+    using FixedT = details::range_value_t<OutRange>;
+    const span<const FixedT> lhs(aLhs);
+    const span<const FixedT> rhs(aRhs);
+    const span<FixedT> out(aOut);
+    assert(lhs.size() == out.size() && rhs.size() == out.size() &&
+           "Ranges must have the same size.");
+    details::dispatch_fixed_multiply<false, FixedT>(
+        lhs.data(), rhs.data(), nullptr, out.data(), out.size(), aTarget);
+}
+
+// Element-wise aOut[i] = aLhs[i] * aRhs.
+template <typename LhsRange, typename FixedT, typename OutRange>
+std::enable_if_t<is_strong_v<FixedT>> fixed_multiply(
+    const LhsRange& aLhs, const FixedT& aRhs, OutRange&& aOut,
+    target aTarget = best_target()) noexcept
+{
+    static_assert(std::is_same_v<FixedT, details::range_value_t<OutRange>>,
+                  "Scalar operand must have the type of range elements.");
+    const span<const FixedT> lhs(aLhs);
+    const span<FixedT> out(aOut);
+    assert(lhs.size() == out.size() && "Ranges must have the same size.");
+    details::dispatch_fixed_multiply<true, FixedT>(
+        lhs.data(), nullptr, &aRhs, out.data(), out.size(), aTarget);
+}
+}  // namespace simd
+}  // namespace strong
+
+#endif /* strong_type_fixed_point_h */
@@ -0,0 +1,466 @@
+#ifndef strong_type_flat_map_h
+#define strong_type_flat_map_h
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hash.h"
+#include "span.h"
+#include "strong_type.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define STRONG_TYPE_FLAT_MAP_SSE2 1
+#else
+#define STRONG_TYPE_FLAT_MAP_SSE2 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define STRONG_TYPE_PREFETCH(address) __builtin_prefetch(address)
+#elif STRONG_TYPE_FLAT_MAP_SSE2
+#define STRONG_TYPE_PREFETCH(address) \
+    _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#else
+#define STRONG_TYPE_PREFETCH(address) static_cast<void>(address)
+#endif
+
+namespace strong
+{
+namespace details
+{
+inline unsigned count_trailing_zeros(std::uint32_t aValue) noexcept
+{
+    assert(aValue != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctz(aValue));
+#else
+    unsigned count = 0;
+    for (; (aValue & 1u) == 0; aValue >>= 1)
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// Compares 16 bytes worth of keys with one value at once. Masks have bit
+// i * sizeof(T) set for every matching lane i.
+template <typename T>
+class key_group
+{
+   public:
+    static constexpr std::size_t kLanes = 16 / sizeof(T);
+
+    explicit key_group(T aValue) noexcept
+    {
+#if STRONG_TYPE_FLAT_MAP_SSE2
+        T lanes[kLanes];
+        for (auto& lane: lanes)
+        {
+            lane = aValue;
+        }
+        std::memcpy(&value_, lanes, sizeof(value_));
+#else
+        value_ = aValue;
+#endif
+    }
+
+    std::uint32_t match(const T* aKeys) const noexcept
+    {
+#if STRONG_TYPE_FLAT_MAP_SSE2
+        const __m128i keys =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(aKeys));
+        const auto bytes = static_cast<std::uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(keys, value_)));
+        return lanes_of(bytes);
+#else
+        std::uint32_t mask = 0;
+        for (std::size_t lane = 0; lane < kLanes; ++lane)
+        {
+            if (aKeys[lane] == value_)
+            {
+                mask |= 1u << (lane * sizeof(T));
+            }
+        }
+        return mask;
+#endif
+    }
+
+    static std::size_t first_lane(std::uint32_t aMask) noexcept
+    {
+        return count_trailing_zeros(aMask) / sizeof(T);
+    }
+
+   private:
+    // Lane matches if all its bytes match: fold byte mask onto the lowest
+    // bit of every lane.
+    static std::uint32_t lanes_of(std::uint32_t aBytes) noexcept
+    {
+        if constexpr (sizeof(T) >= 2)
+        {
+            aBytes &= aBytes >> 1;
+        }
+        if constexpr (sizeof(T) >= 4)
+        {
+            aBytes &= aBytes >> 2;
+        }
+        if constexpr (sizeof(T) >= 8)
+        {
+            aBytes &= aBytes >> 4;
+        }
+        constexpr std::uint32_t kLaneBits = sizeof(T) == 1   ? 0xffffu
+                                            : sizeof(T) == 2 ? 0x5555u
+                                            : sizeof(T) == 4 ? 0x1111u
+                                                             : 0x0101u;
+        return aBytes & kLaneBits;
+    }
+
+#if STRONG_TYPE_FLAT_MAP_SSE2
+    __m128i value_;
+#else
+    T value_;
+#endif
+};
+}  // namespace details
+
+// Open addressing hash map for strong keys over integral types.
+//
+// Keys and values are stored in separate arrays. A slot is free when its key
+// equals the reserved value declared on the key tag:
+//   struct NodeTag { static constexpr uint32_t empty_key = 0xffffffff; };
+// so the table needs no control bytes and the reserved key must never be
+// inserted. Lookups compare 16 bytes of keys per step. Collisions are resolved
+// with linear probing that never wraps around: the table has an overflow area
+// after the last home slot and grows if a probe sequence runs past it. Erase
+// shifts the rest of the probe sequence back, so there are no tombstones.
+// Hash is hash_mixer<Tag> of the key. Values must be default constructible:
+// free slots hold default constructed values.
+template <typename KeyT, typename V>
+class flat_map
+{
+    static_assert(is_strong_v<KeyT>, "Invalid KeyT.");
+    using T = underlying_type<KeyT>;
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                  "KeyT must be a strong type over an integral type.");
+    static_assert(std::is_default_constructible_v<V>,
+                  "V must be default constructible.");
+    using group = details::key_group<T>;
+
+   public:
+    using key_type = KeyT;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+    flat_map() = default;
+
+    explicit flat_map(size_type aCount) { reserve(aCount); }
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type bucket_count() const noexcept { return capacity_; }
+
+    // Makes room for aCount elements without rehashing.
+    void reserve(size_type aCount)
+    {
+        size_type capacity = kMinCapacity;
+        while (max_load(capacity) < aCount)
+        {
+            capacity *= 2;
+        }
+        if (capacity > capacity_)
+        {
+            rehash(capacity);
+        }
+    }
+
+    void clear() noexcept
+    {
+        for (size_type slot = 0; slot < usable_; ++slot)
+        {
+            if (keys_[slot] != kEmpty)
+            {
+                keys_[slot] = kEmpty;
+                values_[slot] = V();
+            }
+        }
+        size_ = 0;
+    }
+
+    V* find(const KeyT& aKey) noexcept
+    {
+        const size_type slot = find_slot(aKey.get());
+        return slot == kNotFound ? nullptr : &values_[slot];
+    }
+
+    const V* find(const KeyT& aKey) const noexcept
+    {
+        const size_type slot = find_slot(aKey.get());
+        return slot == kNotFound ? nullptr : &values_[slot];
+    }
+
+    bool contains(const KeyT& aKey) const noexcept
+    {
+        return find_slot(aKey.get()) != kNotFound;
+    }
+
+    // Inserts value constructed from aArgs if aKey is absent. Returns the
+    // value stored for aKey and whether it was inserted. If constructing or
+    // storing the value throws, aKey is not inserted.
+    template <typename... Args>
+    std::pair<V*, bool> try_emplace(const KeyT& aKey, Args&&... aArgs)
+    {
+        const T key = aKey.get();
+        assert(key != kEmpty && "Reserved empty_key can not be inserted.");
+        if (const size_type slot = find_slot(key); slot != kNotFound)
+        {
+            return {&values_[slot], false};
+        }
+        V value(std::forward<Args>(aArgs)...);
+        if (size_ >= max_load(capacity_))
+        {
+            rehash(capacity_ == 0 ? kMinCapacity : capacity_ * 2);
+        }
+        size_type slot = find_free_slot(key);
+        while (slot == kNotFound)
+        {
+            rehash(capacity_ * 2);
+            slot = find_free_slot(key);
+        }
+        // The key makes the slot occupied: it is written once the value is.
+        values_[slot] = std::move(value);
+        keys_[slot] = key;
+        ++size_;
+        return {&values_[slot], true};
+    }
+
+    std::pair<V*, bool> insert(const KeyT& aKey, const V& aValue)
+    {
+        return try_emplace(aKey, aValue);
+    }
+
+    template <typename M>
+    std::pair<V*, bool> insert_or_assign(const KeyT& aKey, M&& aValue)
+    {
+        if (V* value = find(aKey))
+        {
+            *value = std::forward<M>(aValue);
+            return {value, false};
+        }
+        return try_emplace(aKey, std::forward<M>(aValue));
+    }
+
+    V& operator[](const KeyT& aKey) { return *try_emplace(aKey).first; }
+
+    bool erase(const KeyT& aKey)
+    {
+        size_type hole = find_slot(aKey.get());
+        if (hole == kNotFound)
+        {
+            return false;
+        }
+        for (size_type next = hole + 1;
+             next < usable_ && keys_[next] != kEmpty; ++next)
+        {
+            if (home(keys_[next]) <= hole)
+            {
+                keys_[hole] = keys_[next];
+                values_[hole] = std::move(values_[next]);
+                hole = next;
+            }
+        }
+        keys_[hole] = kEmpty;
+        values_[hole] = V();
+        --size_;
+        return true;
+    }
+
+    // Calls aFunction(KeyT, V&) for every element in unspecified order.
+    template <typename F>
+    void for_each(F&& aFunction)
+    {
+        for (size_type slot = 0; slot < usable_; ++slot)
+        {
+            if (keys_[slot] != kEmpty)
+            {
+                aFunction(KeyT(keys_[slot]), values_[slot]);
+            }
+        }
+    }
+
+    template <typename F>
+    void for_each(F&& aFunction) const
+    {
+        for (size_type slot = 0; slot < usable_; ++slot)
+        {
+            if (keys_[slot] != kEmpty)
+            {
+                aFunction(KeyT(keys_[slot]), values_[slot]);
+            }
+        }
+    }
+
+    // aResults[i] = find(aKeys[i]). Home slots of keys a few positions ahead
+    // are prefetched, so that independent lookups overlap their cache
+    // misses.
+    void find_batch(span<const KeyT> aKeys,
+                    span<const V*> aResults) const noexcept
+    {
+        assert(aKeys.size() == aResults.size() &&
+               "Spans must have the same size.");
+        for (size_type i = 0; i < aKeys.size(); ++i)
+        {
+            if (i + kPrefetchDistance < aKeys.size())
+            {
+                prefetch(aKeys[i + kPrefetchDistance].get());
+            }
+            aResults[i] = find(aKeys[i]);
+        }
+    }
+
+    // insert_or_assign(aKeys[i], aValues[i]) for every i with prefetching
+    // like in find_batch. Returns number of inserted keys.
+    size_type insert_batch(span<const KeyT> aKeys, span<const V> aValues)
+    {
+        assert(aKeys.size() == aValues.size() &&
+               "Spans must have the same size.");
+        reserve(size_ + aKeys.size());
+        size_type inserted = 0;
+        for (size_type i = 0; i < aKeys.size(); ++i)
+        {
+            if (i + kPrefetchDistance < aKeys.size())
+            {
+                prefetch(aKeys[i + kPrefetchDistance].get());
+            }
+            inserted += insert_or_assign(aKeys[i], aValues[i]).second ? 1u : 0u;
+        }
+        return inserted;
+    }
+
+   private:
+    static constexpr T kEmpty = static_cast<T>(tag_type<KeyT>::empty_key);
+    static constexpr size_type kLanes = group::kLanes;
+    static constexpr size_type kMinCapacity = 16;
+    static constexpr size_type kNotFound = ~size_type{0};
+    static constexpr size_type kPrefetchDistance = 8;
+
+    // At most 3/4 of home slots are used.
+    static constexpr size_type max_load(size_type aCapacity) noexcept
+    {
+        return aCapacity / 4 * 3;
+    }
+
+    size_type home(T aKey) const noexcept
+    {
+        using mixer = hash_mixer_t<tag_type<KeyT>>;
+        const auto hash = mixer{}(details::hash_input(aKey));
+        return static_cast<size_type>(hash) & (capacity_ - 1);
+    }
+
+    void prefetch(T aKey) const noexcept
+    {
+        if (capacity_ != 0)
+        {
+            const size_type slot = home(aKey);
+            STRONG_TYPE_PREFETCH(keys_.data() + slot);
+            STRONG_TYPE_PREFETCH(values_.data() + slot);
+        }
+    }
+
+    size_type find_slot(T aKey) const noexcept
+    {
+        if (size_ == 0 || aKey == kEmpty)
+        {
+            return kNotFound;
+        }
+        const group key(aKey);
+        const group empty(kEmpty);
+        for (size_type slot = home(aKey); slot < usable_; slot += kLanes)
+        {
+            if (const auto matches = key.match(keys_.data() + slot))
+            {
+                return slot + group::first_lane(matches);
+            }
+            if (empty.match(keys_.data() + slot))
+            {
+                return kNotFound;
+            }
+        }
+        return kNotFound;
+    }
+
+    // First free slot of probe sequence of absent aKey, kNotFound if the
+    // sequence runs past the overflow area.
+    size_type find_free_slot(T aKey) const noexcept
+    {
+        const group empty(kEmpty);
+        for (size_type slot = home(aKey); slot < usable_; slot += kLanes)
+        {
+            if (const auto frees = empty.match(keys_.data() + slot))
+            {
+                const size_type free = slot + group::first_lane(frees);
+                return free < usable_ ? free : kNotFound;
+            }
+        }
+        return kNotFound;
+    }
+
+    void rehash(size_type aCapacity)
+    {
+        for (;; aCapacity *= 2)
+        {
+            flat_map next;
+            next.capacity_ = aCapacity;
+            // Probe sequences that start near the end of home slots spill into
+            // the overflow area. Group loads may read one group past it.
+            next.usable_ = aCapacity + std::max(2 * kLanes, aCapacity / 8);
+            next.keys_.assign(next.usable_ + kLanes, kEmpty);
+            std::vector<size_type> slots;
+            slots.reserve(size_);
+            bool placed = true;
+            for (size_type slot = 0; slot < usable_ && placed; ++slot)
+            {
+                if (keys_[slot] != kEmpty)
+                {
+                    const size_type free = next.find_free_slot(keys_[slot]);
+                    placed = free != kNotFound;
+                    if (placed)
+                    {
+                        next.keys_[free] = keys_[slot];
+                        slots.push_back(free);
+                    }
+                }
+            }
+            if (!placed)
+            {
+                continue;
+            }
+            next.values_.resize(next.usable_);
+            auto destination = slots.begin();
+            for (size_type slot = 0; slot < usable_; ++slot)
+            {
+                if (keys_[slot] != kEmpty)
+                {
+                    next.values_[*destination++] = std::move(values_[slot]);
+                }
+            }
+            next.size_ = size_;
+            *this = std::move(next);
+            return;
+        }
+    }
+
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+    size_type usable_ = 0;
+    std::vector<T> keys_;
+    std::vector<V> values_;
+};
+}  // namespace strong
+
+#endif /* strong_type_flat_map_h */
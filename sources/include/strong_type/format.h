@@ -0,0 +1,275 @@
+#ifndef strong_type_format_h
+#define strong_type_format_h
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+// Whether std::from_chars parses floating point values. libc++, e.g. that
+// of Xcode, and libstdc++ before 11 parse integers only.
+#ifndef STRONG_TYPE_HAS_FLOAT_FROM_CHARS
+#if defined(__cpp_lib_to_chars)
+#define STRONG_TYPE_HAS_FLOAT_FROM_CHARS 1
+#else
+#define STRONG_TYPE_HAS_FLOAT_FROM_CHARS 0
+#endif
+#endif
+
+// Define STRONG_TYPE_USE_FMT to 1 to get fmt::formatter specializations.
+#ifndef STRONG_TYPE_USE_FMT
+#define STRONG_TYPE_USE_FMT 0
+#endif
+
+#if STRONG_TYPE_USE_FMT
+#include <fmt/format.h>
+#endif
+
+#include "span.h"
+#include "strong_type.h"
+
+namespace strong
+{
+namespace details
+{
+// Text written before and after the value of strong types with Tag, e.g.
+//   struct PriceTag { static constexpr std::string_view suffix = " USD"; };
+template <typename Tag, typename = void>
+inline constexpr std::string_view text_prefix_v{};
+
+template <typename Tag>
+inline constexpr std::string_view
+    text_prefix_v<Tag, std::void_t<decltype(Tag::prefix)>> = Tag::prefix;
+
+template <typename Tag, typename = void>
+inline constexpr std::string_view text_suffix_v{};
+
+template <typename Tag>
+inline constexpr std::string_view
+    text_suffix_v<Tag, std::void_t<decltype(Tag::suffix)>> = Tag::suffix;
+
+template <typename Tag, typename = void>
+inline constexpr bool has_fraction_bits_v = false;
+
+template <typename Tag>
+inline constexpr bool
+    has_fraction_bits_v<Tag, std::void_t<decltype(Tag::fraction_bits)>> =
+        true;
+
+template <typename T, typename = void>
+inline constexpr bool is_text_convertible_v = false;
+
+// Strong types over integral and floating point types, except bool and
+// fixed point values, whose underlying integers are not their values.
+template <typename T>
+inline constexpr bool is_text_convertible_v<
+    T, std::enable_if_t<std::is_arithmetic_v<typename is_strong<T>::type>>> =
+    !std::is_same_v<underlying_type<T>, bool> &&
+    !has_fraction_bits_v<tag_type<T>>;
+
+// Strong types that from_chars parses: floating point values only where
+// std::from_chars parses them.
+template <typename T>
+inline constexpr bool is_text_parsable_v =
+    is_text_convertible_v<T> &&
+    (STRONG_TYPE_HAS_FLOAT_FROM_CHARS ||
+     std::is_integral_v<typename is_strong<T>::type>);
+
+template <typename T>
+constexpr std::size_t max_number_chars() noexcept
+{
+    using limits = std::numeric_limits<T>;
+    if constexpr (std::is_integral_v<T>)
+    {
+        // Sign and the partial digit that digits10 leaves out.
+        return static_cast<std::size_t>(limits::digits10) + 2;
+    }
+    else
+    {
+        // Sign, point, exponent sign and up to 4 exponent digits.
+        return static_cast<std::size_t>(limits::max_digits10) + 8;
+    }
+}
+
+inline char* copy_text(char* aFirst, std::string_view aText) noexcept
+{
+    return std::copy(aText.begin(), aText.end(), aFirst);
+}
+}  // namespace details
+
+template <typename StrongT>
+inline constexpr bool is_text_convertible_v =
+    details::is_text_convertible_v<StrongT>;
+
+template <typename StrongT>
+inline constexpr bool is_text_parsable_v =
+    details::is_text_parsable_v<StrongT>;
+
+// Upper bound of the length of the text of any value of StrongT, prefix and
+// suffix included: a buffer of this size never makes to_chars fail.
+template <typename StrongT>
+inline constexpr std::size_t max_chars_v =
+    details::text_prefix_v<tag_type<StrongT>>.size() +
+    details::max_number_chars<underlying_type<StrongT>>() +
+    details::text_suffix_v<tag_type<StrongT>>.size();
+
+// Writes the prefix of the Tag, the value and the suffix of the Tag into
+// [aFirst, aLast) like std::to_chars: no allocation, no locale, and
+// errc::value_too_large with aLast if the text does not fit. Floating point
+// values get the shortest text that parses back to the same value.
+template <typename StrongT>
+std::enable_if_t<is_text_convertible_v<StrongT>, std::to_chars_result>
+to_chars(char* aFirst, char* aLast, const StrongT& aValue) noexcept
+{
+    constexpr std::string_view kPrefix =
+        details::text_prefix_v<tag_type<StrongT>>;
+    constexpr std::string_view kSuffix =
+        details::text_suffix_v<tag_type<StrongT>>;
+    if (static_cast<std::size_t>(aLast - aFirst) < kPrefix.size())
+    {
+        return {aLast, std::errc::value_too_large};
+    }
+    aFirst = details::copy_text(aFirst, kPrefix);
+    const std::to_chars_result result =
+        std::to_chars(aFirst, aLast, aValue.get());
+    if (result.ec != std::errc() ||
+        static_cast<std::size_t>(aLast - result.ptr) < kSuffix.size())
+    {
+        return {aLast, std::errc::value_too_large};
+    }
+    return {details::copy_text(result.ptr, kSuffix), std::errc()};
+}
+
+// Parses text written by to_chars: the prefix and suffix of the Tag must
+// be present. On failure aValue is unchanged and ptr is aFirst, as with
+// std::from_chars. Floating point values are parsed only if
+// STRONG_TYPE_HAS_FLOAT_FROM_CHARS.
+template <typename StrongT>
+std::enable_if_t<is_text_parsable_v<StrongT>, std::from_chars_result>
+from_chars(const char* aFirst, const char* aLast, StrongT& aValue) noexcept
+{
+    constexpr std::string_view kPrefix =
+        details::text_prefix_v<tag_type<StrongT>>;
+    constexpr std::string_view kSuffix =
+        details::text_suffix_v<tag_type<StrongT>>;
+    const std::string_view text(aFirst,
+                                static_cast<std::size_t>(aLast - aFirst));
+    if (text.substr(0, kPrefix.size()) != kPrefix)
+    {
+        return {aFirst, std::errc::invalid_argument};
+    }
+    underlying_type<StrongT> value{};
+    const std::from_chars_result result =
+        std::from_chars(aFirst + kPrefix.size(), aLast, value);
+    if (result.ec != std::errc())
+    {
+        return {aFirst, result.ec};
+    }
+    const std::string_view rest(result.ptr,
+                                static_cast<std::size_t>(aLast - result.ptr));
+    if (rest.substr(0, kSuffix.size()) != kSuffix)
+    {
+        return {aFirst, std::errc::invalid_argument};
+    }
+    aValue = StrongT(value);
+    return {result.ptr + kSuffix.size(), std::errc()};
+}
+
+struct format_range_result
+{
+    // One past the last written character.
+    char* ptr;
+    // Number of values written.
+    std::size_t count;
+    // errc::value_too_large if not all values fit.
+    std::errc ec;
+};
+
+// Writes aValues separated by aSeparator into [aFirst, aLast). Only whole
+// values are written: if the buffer fills up, ptr and count tell how much
+// to flush and which value to continue from, after a separator. While at
+// least max_chars_v bytes are left, values are written without checking
+// the space for each.
+template <typename Range>
+format_range_result format_range(char* aFirst, char* aLast,
+                                 const Range& aValues,
+                                 std::string_view aSeparator = " ") noexcept
+{
+    using StrongT = details::range_value_t<const Range>;
+    static_assert(is_text_convertible_v<StrongT>,
+                  "Range must hold strong arithmetic types.");
+    const span<const StrongT> values(aValues);
+    const std::size_t maxChars = max_chars_v<StrongT> + aSeparator.size();
+
+    format_range_result result{aFirst, 0, std::errc()};
+    for (const StrongT& value: values)
+    {
+        char* position = result.ptr;
+        const std::string_view separator =
+            result.count == 0 ? std::string_view() : aSeparator;
+        if (static_cast<std::size_t>(aLast - position) >= maxChars)
+        {
+            position = details::copy_text(position, separator);
+            position = to_chars(position, aLast, value).ptr;
+        }
+        else
+        {
+            if (static_cast<std::size_t>(aLast - position) <
+                separator.size())
+            {
+                result.ec = std::errc::value_too_large;
+                return result;
+            }
+            position = details::copy_text(position, separator);
+            const std::to_chars_result written =
+                to_chars(position, aLast, value);
+            if (written.ec != std::errc())
+            {
+                result.ec = written.ec;
+                return result;
+            }
+            position = written.ptr;
+        }
+        result.ptr = position;
+        ++result.count;
+    }
+    return result;
+}
+}  // namespace strong
+
+#if STRONG_TYPE_USE_FMT
+// fmt::format("{:x}", id): the format spec applies to the underlying value,
+// the prefix and suffix of the Tag are written around it. Width and
+// alignment too pad the number only: "{:>8}" pads between the prefix and
+// the value.
+template <typename Tag, typename T, template <typename> typename... Ops>
+struct fmt::formatter<
+    strong::strong_type<Tag, T, Ops...>, char,
+    std::enable_if_t<
+        strong::is_text_convertible_v<strong::strong_type<Tag, T, Ops...>>>>
+    : fmt::formatter<T, char>
+{
+    template <typename FormatContext>
+    auto format(const strong::strong_type<Tag, T, Ops...>& aValue,
+                FormatContext& aContext) const
+    {
+        constexpr std::string_view kPrefix =
+            strong::details::text_prefix_v<Tag>;
+        constexpr std::string_view kSuffix =
+            strong::details::text_suffix_v<Tag>;
+        auto out = std::copy(kPrefix.begin(), kPrefix.end(), aContext.out());
+        aContext.advance_to(out);
+        out = fmt::formatter<T, char>::format(aValue.get(), aContext);
+        return std::copy(kSuffix.begin(), kSuffix.end(), out);
+    }
+};
+#endif
+
+#endif /* strong_type_format_h */
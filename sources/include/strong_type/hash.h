@@ -0,0 +1,241 @@
+#ifndef strong_type_hash_h
+#define strong_type_hash_h
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include "strong_type.h"
+
+namespace strong
+{
+// Enables std::hash<StrongT> and strong::hash for StrongT.
+template <typename StrongT>
+struct hashable
+{
+};
+
+namespace details
+{
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+// Folded 64x64->128 bit product computed with 64-bit arithmetic only.
+constexpr std::uint64_t mum_portable(std::uint64_t aLhs,
+                                     std::uint64_t aRhs) noexcept
+{
+    constexpr std::uint64_t kLow = 0xffffffffULL;
+    const std::uint64_t ll = (aLhs & kLow) * (aRhs & kLow);
+    const std::uint64_t lh = (aLhs & kLow) * (aRhs >> 32);
+    const std::uint64_t hl = (aLhs >> 32) * (aRhs & kLow);
+    const std::uint64_t hh = (aLhs >> 32) * (aRhs >> 32);
+    const std::uint64_t middle = (ll >> 32) + (lh & kLow) + (hl & kLow);
+    const std::uint64_t low = (ll & kLow) | (middle << 32);
+    const std::uint64_t high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+    return low ^ high;
+}
+
+// Folded 64x64->128 bit product: xor of its low and high halves.
+constexpr std::uint64_t mum(std::uint64_t aLhs, std::uint64_t aRhs) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    const uint128_t product = static_cast<uint128_t>(aLhs) * aRhs;
+    return static_cast<std::uint64_t>(product) ^
+           static_cast<std::uint64_t>(product >> 64);
+#else
+    return mum_portable(aLhs, aRhs);
+#endif
+}
+}  // namespace details
+
+// Leaves the value as is, like std::hash of integers in libstdc++ and libc++.
+// Good only for tables that reduce hash modulo a prime.
+struct identity_mixer
+{
+    constexpr std::uint64_t operator()(std::uint64_t aValue) const noexcept
+    {
+        return aValue;
+    }
+};
+
+// 64-bit finalizer of MurmurHash3: every input bit affects every output bit.
+struct murmur_mixer
+{
+    constexpr std::uint64_t operator()(std::uint64_t aValue) const noexcept
+    {
+        aValue ^= aValue >> 33;
+        aValue *= 0xff51afd7ed558ccdULL;
+        aValue ^= aValue >> 33;
+        aValue *= 0xc4ceb9fe1a85ec53ULL;
+        aValue ^= aValue >> 33;
+        return aValue;
+    }
+};
+
+// Multiply-and-fold step of wyhash: a single wide multiplication, cheaper
+// than murmur_mixer where 128-bit products are native.
+struct wy_mixer
+{
+    constexpr std::uint64_t operator()(std::uint64_t aValue) const noexcept
+    {
+        return details::mum(aValue ^ 0x2d358dccaa6c78a5ULL,
+                            0x8bb84b93962eacc9ULL);
+    }
+};
+
+// Mixer used to hash strong types with given Tag. Specialize it to select
+// another mixer for a Tag:
+// template <> struct strong::hash_mixer<NodeTag> { using type = wy_mixer; };
+template <typename Tag>
+struct hash_mixer
+{
+    using type = murmur_mixer;
+};
+
+template <typename Tag>
+using hash_mixer_t = typename hash_mixer<Tag>::type;
+
+template <typename T>
+inline constexpr bool is_hashable_v =
+    is_strong_v<T> && has_op_v<T, hashable>;
+
+namespace details
+{
+// Integers, enumerations and pointers are mixed directly, any other type is
+// first hashed with std::hash.
+template <typename T>
+constexpr std::uint64_t hash_input(const T& aValue) noexcept
+{
+    if constexpr (std::is_integral_v<T>)
+    {
+        return static_cast<std::uint64_t>(aValue);
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        return static_cast<std::uint64_t>(
+            static_cast<std::underlying_type_t<T>>(aValue));
+    }
+    else if constexpr (std::is_pointer_v<T>)
+    {
+        return static_cast<std::uint64_t>(
+            reinterpret_cast<std::uintptr_t>(aValue));
+    }
+    else
+    {
+        return static_cast<std::uint64_t>(std::hash<T>{}(aValue));
+    }
+}
+
+// Hash of aValue, the underlying value of a strong type with Tag.
+template <typename Tag, typename T>
+constexpr std::size_t mix(const T& aValue) noexcept
+{
+    using mixer = hash_mixer_t<Tag>;
+    return static_cast<std::size_t>(mixer{}(hash_input(aValue)));
+}
+}  // namespace details
+
+template <typename StrongT>
+constexpr std::size_t hash_value(const StrongT& aValue) noexcept
+{
+    static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+    static_assert(has_op_v<StrongT, hashable>,
+                  "StrongT does not have hashable mixin.");
+    return details::mix<tag_type<StrongT>>(aValue.get());
+}
+
+// A single functor for containers keyed by any hashable strong type. It is
+// not transparent: raw values do not know the Tag that selects the mixer,
+// so containers are searched by strong keys only.
+struct hash
+{
+    template <typename StrongT,
+              typename = std::enable_if_t<is_hashable_v<StrongT>>>
+    constexpr std::size_t operator()(const StrongT& aValue) const noexcept
+    {
+        return hash_value(aValue);
+    }
+};
+
+// Transparent hasher of a single hashable StrongT: it hashes StrongT and
+// its underlying type alike, with the mixer of its Tag, so containers with
+// heterogeneous lookup can be searched by raw values:
+// std::unordered_set<NodeId, strong::transparent_hash<NodeId>,
+//                    strong::transparent_equal_to<NodeId>> nodes;
+// nodes.find(std::uint32_t{7});
+template <typename StrongT>
+struct transparent_hash
+{
+    static_assert(is_hashable_v<StrongT>,
+                  "StrongT does not have hashable mixin.");
+    using is_transparent = void;
+
+    constexpr std::size_t operator()(const StrongT& aValue) const noexcept
+    {
+        return hash_value(aValue);
+    }
+
+    constexpr std::size_t operator()(
+        const underlying_type<StrongT>& aValue) const noexcept
+    {
+        return details::mix<tag_type<StrongT>>(aValue);
+    }
+};
+
+// Transparent equality of StrongT and its underlying type, the key equality
+// to pair with transparent_hash.
+template <typename StrongT>
+struct transparent_equal_to
+{
+    static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+    using is_transparent = void;
+
+    template <typename Lhs, typename Rhs>
+    constexpr bool operator()(const Lhs& aLhs, const Rhs& aRhs) const
+    {
+        static_assert(is_key_v<Lhs> && is_key_v<Rhs>,
+                      "Operands must be StrongT or its underlying type.");
+        return getValue(aLhs) == getValue(aRhs);
+    }
+
+   private:
+    template <typename T>
+    static constexpr bool is_key_v =
+        std::is_same_v<T, StrongT> ||
+        std::is_same_v<T, underlying_type<StrongT>>;
+};
+
+namespace details
+{
+template <typename StrongT, bool = has_op_v<StrongT, hashable>>
+struct std_hash
+{
+    std::size_t operator()(const StrongT& aValue) const noexcept
+    {
+        return hash_value(aValue);
+    }
+};
+
+// Disabled std::hash specialization for strong types without hashable.
+template <typename StrongT>
+struct std_hash<StrongT, false>
+{
+    std_hash() = delete;
+    std_hash(const std_hash&) = delete;
+    std_hash& operator=(const std_hash&) = delete;
+};
+}  // namespace details
+}  // namespace strong
+
+namespace std
+{
+template <typename Tag, typename T, template <typename> typename... Ops>
+struct hash<strong::strong_type<Tag, T, Ops...>>
+    : strong::details::std_hash<strong::strong_type<Tag, T, Ops...>>
+{
+};
+}  // namespace std
+
+#endif /* strong_type_hash_h */
@@ -0,0 +1,405 @@
+#ifndef strong_type_histogram_h
+#define strong_type_histogram_h
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "atomic.h"
+#include "sharded_counter.h"
+#include "span.h"
+#include "strong_type.h"
+#include "varint.h"
+
+namespace strong
+{
+namespace details
+{
+inline unsigned highest_bit64(std::uint64_t aValue) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<unsigned>(__builtin_clzll(aValue));
+#else
+    unsigned bit = 0;
+    while (aValue >>= 1)
+    {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+// Log-linear buckets of 64-bit values: values below 2^SubBucketBits have a
+// bucket each, and every following power of two is split into
+// 2^SubBucketBits buckets of equal width. Values of a bucket differ from
+// each other by less than 2^-SubBucketBits of their magnitude.
+template <unsigned SubBucketBits>
+struct log_buckets
+{
+    static_assert(SubBucketBits >= 1 && SubBucketBits <= 16,
+                  "SubBucketBits must be in [1, 16].");
+
+    static constexpr std::uint64_t kSubBuckets = std::uint64_t{1}
+                                                 << SubBucketBits;
+    static constexpr std::size_t kCount =
+        static_cast<std::size_t>((65 - SubBucketBits) * kSubBuckets);
+
+    static std::size_t index(std::uint64_t aValue) noexcept
+    {
+        if (aValue < kSubBuckets)
+        {
+            return static_cast<std::size_t>(aValue);
+        }
+        const unsigned shift = highest_bit64(aValue) - SubBucketBits;
+        return static_cast<std::size_t>(
+            ((std::uint64_t{shift} + 1) << SubBucketBits) +
+            (aValue >> shift) - kSubBuckets);
+    }
+
+    static constexpr std::uint64_t lowest(std::size_t aIndex) noexcept
+    {
+        if (aIndex < kSubBuckets)
+        {
+            return aIndex;
+        }
+        const auto shift = static_cast<unsigned>((aIndex >> SubBucketBits) - 1);
+        return (kSubBuckets + (aIndex & (kSubBuckets - 1))) << shift;
+    }
+
+    static constexpr std::uint64_t highest(std::size_t aIndex) noexcept
+    {
+        if (aIndex < kSubBuckets)
+        {
+            return aIndex;
+        }
+        const auto shift = static_cast<unsigned>((aIndex >> SubBucketBits) - 1);
+        return lowest(aIndex) + ((std::uint64_t{1} << shift) - 1);
+    }
+};
+}  // namespace details
+
+// Dump of a histogram: a 16-byte header followed by a LEB128 varint pair
+// (distance from the previous non-empty bucket, count) per non-empty
+// bucket. Integers of the header are in native byte order.
+struct histogram_header
+{
+    static constexpr std::uint32_t kMagic = 0x47485453;  // "STHG"
+
+    std::uint32_t magic;
+    std::uint8_t sub_bucket_bits;
+    std::uint8_t element_size;
+    std::uint16_t reserved;
+    std::uint64_t buckets;
+};
+
+static_assert(sizeof(histogram_header) == 16);
+
+// Counts of a histogram merged from all shards at one point, for queries,
+// merging with other snapshots and dumps.
+template <typename StrongT, unsigned SubBucketBits = 7>
+class histogram_snapshot
+{
+    static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+    using T = underlying_type<StrongT>;
+    using buckets = details::log_buckets<SubBucketBits>;
+
+   public:
+    using value_type = StrongT;
+
+    histogram_snapshot() : counts_(buckets::kCount) {}
+
+    static constexpr std::size_t bucket_count() noexcept
+    {
+        return buckets::kCount;
+    }
+
+    // Number of the recorded values that fall into aIndex.
+    std::uint64_t count(std::size_t aIndex) const noexcept
+    {
+        return counts_[aIndex];
+    }
+
+    std::uint64_t total() const noexcept { return total_; }
+
+    // Values of a bucket that all map to the same count.
+    static StrongT lowest_value(std::size_t aIndex) noexcept
+    {
+        return to_value(buckets::lowest(aIndex));
+    }
+
+    static StrongT highest_value(std::size_t aIndex) noexcept
+    {
+        return to_value(buckets::highest(aIndex));
+    }
+
+    // Smallest value such that aPercentile percent of the recorded values
+    // are not greater, up to the width of its bucket: the highest value of
+    // the bucket, so that the result is never below the exact percentile.
+    // StrongT{} if nothing was recorded.
+    StrongT value_at_percentile(double aPercentile) const noexcept
+    {
+        if (total_ == 0)
+        {
+            return StrongT{};
+        }
+        const double fraction = std::clamp(aPercentile, 0.0, 100.0) / 100.0;
+        const auto rank = std::clamp<std::uint64_t>(
+            static_cast<std::uint64_t>(
+                std::ceil(fraction * static_cast<double>(total_))),
+            1, total_);
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < buckets::kCount; ++i)
+        {
+            seen += counts_[i];
+            if (seen >= rank)
+            {
+                return highest_value(i);
+            }
+        }
+        return highest_value(buckets::kCount - 1);
+    }
+
+    // Lowest value of the first non-empty bucket, StrongT{} if empty.
+    StrongT min() const noexcept
+    {
+        for (std::size_t i = 0; i < buckets::kCount; ++i)
+        {
+            if (counts_[i] != 0)
+            {
+                return lowest_value(i);
+            }
+        }
+        return StrongT{};
+    }
+
+    // Highest value of the last non-empty bucket, StrongT{} if empty.
+    StrongT max() const noexcept
+    {
+        for (std::size_t i = buckets::kCount; i-- > 0;)
+        {
+            if (counts_[i] != 0)
+            {
+                return highest_value(i);
+            }
+        }
+        return StrongT{};
+    }
+
+    histogram_snapshot& operator+=(const histogram_snapshot& aOther) noexcept
+    {
+        for (std::size_t i = 0; i < buckets::kCount; ++i)
+        {
+            counts_[i] += aOther.counts_[i];
+        }
+        total_ += aOther.total_;
+        return *this;
+    }
+
+    // Appends the dump of the snapshot to aOut: a few bytes per non-empty
+    // bucket.
+    void dump(std::vector<std::byte>& aOut) const
+    {
+        const std::size_t start = aOut.size();
+        aOut.resize(start + sizeof(histogram_header));
+        std::uint64_t nonEmpty = 0;
+        std::size_t previous = 0;
+        constexpr std::size_t kVarintSize =
+            details::max_varint_size_v<std::uint64_t>;
+        for (std::size_t i = 0; i < buckets::kCount; ++i)
+        {
+            if (counts_[i] != 0)
+            {
+                std::byte varints[2 * kVarintSize];
+                std::byte* end = details::write_varint(
+                    static_cast<std::uint64_t>(i - previous), varints);
+                end = details::write_varint(counts_[i], end);
+                aOut.insert(aOut.end(), varints, end);
+                previous = i;
+                ++nonEmpty;
+            }
+        }
+        const histogram_header header{histogram_header::kMagic,
+                                      SubBucketBits,
+                                      static_cast<std::uint8_t>(sizeof(T)),
+                                      0, nonEmpty};
+        std::memcpy(aOut.data() + start, &header, sizeof(header));
+    }
+
+    // Reads a dump that takes all of aIn into aSnapshot.
+    // errc::invalid_argument means that it is a dump of a histogram of
+    // other buckets or values, errc::illegal_byte_sequence that it is
+    // truncated or corrupt.
+    static std::errc load(span<const std::byte> aIn,
+                          histogram_snapshot& aSnapshot)
+    {
+        histogram_header header;
+        if (aIn.size() < sizeof(header))
+        {
+            return std::errc::illegal_byte_sequence;
+        }
+        std::memcpy(&header, aIn.data(), sizeof(header));
+        if (header.magic != histogram_header::kMagic)
+        {
+            return std::errc::illegal_byte_sequence;
+        }
+        if (header.sub_bucket_bits != SubBucketBits ||
+            header.element_size != sizeof(T))
+        {
+            return std::errc::invalid_argument;
+        }
+        histogram_snapshot result;
+        const std::byte* in = aIn.data() + sizeof(header);
+        const std::byte* const last = aIn.data() + aIn.size();
+        std::uint64_t index = 0;
+        for (std::uint64_t i = 0; i < header.buckets; ++i)
+        {
+            std::uint64_t distance;
+            std::uint64_t count;
+            if (!details::read_varint(in, last, distance) ||
+                !details::read_varint(in, last, count) ||
+                (i != 0 && distance == 0) ||
+                distance >= buckets::kCount - index)
+            {
+                return std::errc::illegal_byte_sequence;
+            }
+            index += distance;
+            result.counts_[static_cast<std::size_t>(index)] = count;
+            result.total_ += count;
+        }
+        if (in != last)
+        {
+            return std::errc::illegal_byte_sequence;
+        }
+        aSnapshot = std::move(result);
+        return std::errc();
+    }
+
+   private:
+    template <typename, unsigned>
+    friend class histogram;
+
+    static StrongT to_value(std::uint64_t aValue) noexcept
+    {
+        constexpr auto kMax =
+            static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+        return StrongT(static_cast<T>(std::min(aValue, kMax)));
+    }
+
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t total_ = 0;
+};
+
+// Histogram of durations, or of any strong integer with comparisons and
+// plus, in log-linear buckets like HdrHistogram: every value is counted
+// in a bucket narrower than 2^-SubBucketBits of the value, 0.8% for the
+// default 7. Buckets cover all 64-bit values, so nothing is clipped, and
+// negative values count as zero.
+//
+// Counts are split into cache line aligned shards like sharded_counter:
+// record() is a relaxed fetch_add on the shard of the calling thread,
+// which is wait-free and does not contend with other threads.
+// snapshot() sums the shards; a snapshot taken while other threads record
+// sees some subset of concurrent records. Shards take 8 bytes per bucket,
+// about 58 KB each for the default 7 SubBucketBits.
+template <typename StrongT, unsigned SubBucketBits = 7>
+class histogram
+{
+    static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+    static_assert(has_op_v<StrongT, comparisons> && has_op_v<StrongT, plus>,
+                  "StrongT must have comparisons and plus.");
+    using T = underlying_type<StrongT>;
+    static_assert(std::is_integral_v<T>, "Invalid underlying type.");
+    using buckets = details::log_buckets<SubBucketBits>;
+
+    struct alignas(cache_line_size) shard
+    {
+        std::atomic<std::uint64_t> counts[buckets::kCount]{};
+    };
+
+   public:
+    using value_type = StrongT;
+    using snapshot_type = histogram_snapshot<StrongT, SubBucketBits>;
+
+    histogram() : histogram(sharded_counter<StrongT>::default_shard_count())
+    {
+    }
+
+    // aShardCount is rounded up to a power of two.
+    explicit histogram(std::size_t aShardCount)
+        : mask_(details::round_up_to_power_of_two(aShardCount) - 1),
+          shards_(std::make_unique<shard[]>(mask_ + 1))
+    {
+    }
+
+    histogram(const histogram&) = delete;
+    histogram& operator=(const histogram&) = delete;
+
+    std::size_t shard_count() const noexcept { return mask_ + 1; }
+
+    // Index of the bucket that counts aValue.
+    static std::size_t bucket_of(StrongT aValue) noexcept
+    {
+        const T value = aValue.get();
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (value < 0)
+            {
+                return 0;
+            }
+        }
+        return buckets::index(static_cast<std::uint64_t>(value));
+    }
+
+    void record(StrongT aValue, std::uint64_t aCount = 1) noexcept
+    {
+        shards_[details::this_thread_slot() & mask_]
+            .counts[bucket_of(aValue)]
+            .fetch_add(aCount, std::memory_order_relaxed);
+    }
+
+    snapshot_type snapshot() const
+    {
+        snapshot_type result;
+        for (std::size_t s = 0; s <= mask_; ++s)
+        {
+            for (std::size_t i = 0; i < buckets::kCount; ++i)
+            {
+                result.counts_[i] +=
+                    shards_[s].counts[i].load(std::memory_order_relaxed);
+            }
+        }
+        for (std::size_t i = 0; i < buckets::kCount; ++i)
+        {
+            result.total_ += result.counts_[i];
+        }
+        return result;
+    }
+
+    // Not atomic with respect to concurrent record().
+    void reset() noexcept
+    {
+        for (std::size_t s = 0; s <= mask_; ++s)
+        {
+            for (auto& count: shards_[s].counts)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+   private:
+    std::size_t mask_;
+    std::unique_ptr<shard[]> shards_;
+};
+}  // namespace strong
+
+#endif /* strong_type_histogram_h */
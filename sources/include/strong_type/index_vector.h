@@ -0,0 +1,347 @@
+#ifndef strong_type_index_vector_h
+#define strong_type_index_vector_h
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "strong_type.h"
+
+namespace strong
+{
+namespace details
+{
+template <typename IndexT>
+inline constexpr bool is_index_v =
+    is_strong_v<IndexT> && std::is_integral_v<underlying_type<IndexT>> &&
+    !std::is_same_v<underlying_type<IndexT>, bool>;
+
+template <typename IndexT>
+constexpr bool is_in_range(const IndexT& aIndex, std::size_t aSize) noexcept
+{
+    if constexpr (std::is_signed_v<underlying_type<IndexT>>)
+    {
+        if (aIndex.get() < 0)
+        {
+            return false;
+        }
+    }
+    return static_cast<std::size_t>(aIndex.get()) < aSize;
+}
+
+template <typename IndexT>
+constexpr std::size_t to_position(const IndexT& aIndex) noexcept
+{
+    return static_cast<std::size_t>(aIndex.get());
+}
+
+// Number of positions that IndexT can address: [0, max of its underlying
+// type], limited to what std::size_t can count.
+template <typename IndexT>
+constexpr std::size_t index_count() noexcept
+{
+    using T = underlying_type<IndexT>;
+    constexpr auto kMax = static_cast<std::make_unsigned_t<T>>(
+        std::numeric_limits<T>::max());
+    if constexpr (kMax >= std::numeric_limits<std::size_t>::max())
+    {
+        return std::numeric_limits<std::size_t>::max();
+    }
+    else
+    {
+        return static_cast<std::size_t>(kMax) + 1;
+    }
+}
+
+template <typename IndexT>
+constexpr IndexT to_index(std::size_t aPosition) noexcept
+{
+    using T = underlying_type<IndexT>;
+    assert(aPosition <=
+               static_cast<std::size_t>(std::numeric_limits<T>::max()) &&
+           "Position does not fit into IndexT.");
+    return IndexT(static_cast<T>(aPosition));
+}
+
+// Range of all valid indices of a container: [IndexT{0}, IndexT{aSize}).
+template <typename IndexT>
+class index_range
+{
+   public:
+    class iterator
+    {
+       public:
+        using value_type = IndexT;
+        using difference_type = std::ptrdiff_t;
+        using reference = IndexT;
+        using pointer = void;
+        using iterator_category = std::input_iterator_tag;
+
+        constexpr explicit iterator(std::size_t aPosition) noexcept
+            : position_(aPosition)
+        {
+        }
+
+        constexpr IndexT operator*() const noexcept
+        {
+            return to_index<IndexT>(position_);
+        }
+
+        constexpr iterator& operator++() noexcept
+        {
+            ++position_;
+            return *this;
+        }
+
+        constexpr bool operator==(const iterator& aOther) const noexcept
+        {
+            return position_ == aOther.position_;
+        }
+
+        constexpr bool operator!=(const iterator& aOther) const noexcept
+        {
+            return position_ != aOther.position_;
+        }
+
+       private:
+        std::size_t position_;
+    };
+
+    constexpr explicit index_range(std::size_t aSize) noexcept : size_(aSize)
+    {
+    }
+
+    constexpr iterator begin() const noexcept { return iterator(0); }
+    constexpr iterator end() const noexcept { return iterator(size_); }
+
+   private:
+    std::size_t size_;
+};
+}  // namespace details
+
+// Dynamic array that can be subscripted only with IndexT, a strong type over
+// an integral type. Indices are checked with assert, so checks vanish in
+// release builds. Growing beyond max_size(), the number of indices IndexT
+// can represent, throws std::length_error. Memory comes from Allocator:
+// pass an arena-backed allocator (for example
+// std::pmr::polymorphic_allocator, see pmr::index_vector) to place elements
+// into an arena.
+template <typename IndexT, typename Value,
+          typename Allocator = std::allocator<Value>>
+class index_vector
+{
+    static_assert(details::is_index_v<IndexT>,
+                  "IndexT must be a strong type over an integral type.");
+    using storage_type = std::vector<Value, Allocator>;
+
+   public:
+    using index_type = IndexT;
+    using value_type = Value;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using reference = Value&;
+    using const_reference = const Value&;
+    using iterator = typename storage_type::iterator;
+    using const_iterator = typename storage_type::const_iterator;
+
+    index_vector() noexcept(noexcept(Allocator())) = default;
+
+    explicit index_vector(const Allocator& aAllocator) noexcept
+        : values_(aAllocator)
+    {
+    }
+
+    index_vector(size_type aCount, const Value& aValue,
+                 const Allocator& aAllocator = Allocator())
+        : values_(checked_size(aCount), aValue, aAllocator)
+    {
+    }
+
+    explicit index_vector(size_type aCount,
+                          const Allocator& aAllocator = Allocator())
+        : values_(checked_size(aCount), aAllocator)
+    {
+    }
+
+    reference operator[](const IndexT& aIndex) noexcept
+    {
+        assert(contains(aIndex) && "Index is out of range.");
+        return values_[details::to_position(aIndex)];
+    }
+
+    const_reference operator[](const IndexT& aIndex) const noexcept
+    {
+        assert(contains(aIndex) && "Index is out of range.");
+        return values_[details::to_position(aIndex)];
+    }
+
+    bool contains(const IndexT& aIndex) const noexcept
+    {
+        return details::is_in_range(aIndex, values_.size());
+    }
+
+    // Appends an element and returns its index. Throws std::length_error if
+    // the container already holds max_size() elements.
+    template <typename... Args>
+    IndexT emplace_back(Args&&... aArgs)
+    {
+        if (values_.size() >= details::index_count<IndexT>())
+        {
+            throw std::length_error("strong::index_vector: too many values");
+        }
+        const IndexT index = details::to_index<IndexT>(values_.size());
+        values_.emplace_back(std::forward<Args>(aArgs)...);
+        return index;
+    }
+
+    IndexT push_back(const Value& aValue) { return emplace_back(aValue); }
+    IndexT push_back(Value&& aValue)
+    {
+        return emplace_back(std::move(aValue));
+    }
+
+    void pop_back() noexcept
+    {
+        assert(!values_.empty() && "Container is empty.");
+        values_.pop_back();
+    }
+
+    // Index the next emplace_back will return.
+    IndexT next_index() const noexcept
+    {
+        return details::to_index<IndexT>(values_.size());
+    }
+
+    details::index_range<IndexT> indices() const noexcept
+    {
+        return details::index_range<IndexT>(values_.size());
+    }
+
+    reference front() noexcept { return values_.front(); }
+    const_reference front() const noexcept { return values_.front(); }
+    reference back() noexcept { return values_.back(); }
+    const_reference back() const noexcept { return values_.back(); }
+
+    Value* data() noexcept { return values_.data(); }
+    const Value* data() const noexcept { return values_.data(); }
+
+    iterator begin() noexcept { return values_.begin(); }
+    const_iterator begin() const noexcept { return values_.begin(); }
+    iterator end() noexcept { return values_.end(); }
+    const_iterator end() const noexcept { return values_.end(); }
+
+    bool empty() const noexcept { return values_.empty(); }
+    size_type size() const noexcept { return values_.size(); }
+    size_type capacity() const noexcept { return values_.capacity(); }
+
+    // Largest number of elements, each with its own index.
+    size_type max_size() const noexcept
+    {
+        return std::min(details::index_count<IndexT>(), values_.max_size());
+    }
+
+    // Throw std::length_error if aCapacity or aSize is above max_size().
+    void reserve(size_type aCapacity)
+    {
+        values_.reserve(checked_size(aCapacity));
+    }
+    void resize(size_type aSize) { values_.resize(checked_size(aSize)); }
+    void resize(size_type aSize, const Value& aValue)
+    {
+        values_.resize(checked_size(aSize), aValue);
+    }
+    void clear() noexcept { values_.clear(); }
+    void shrink_to_fit() { values_.shrink_to_fit(); }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return values_.get_allocator();
+    }
+
+   private:
+    static size_type checked_size(size_type aCount)
+    {
+        if (aCount > details::index_count<IndexT>())
+        {
+            throw std::length_error("strong::index_vector: too many values");
+        }
+        return aCount;
+    }
+
+    storage_type values_;
+};
+
+// Fixed-size array that can be subscripted only with IndexT.
+template <typename IndexT, typename Value, std::size_t N>
+class index_array
+{
+    static_assert(details::is_index_v<IndexT>,
+                  "IndexT must be a strong type over an integral type.");
+    using storage_type = std::array<Value, N>;
+
+   public:
+    using index_type = IndexT;
+    using value_type = Value;
+    using size_type = std::size_t;
+    using reference = Value&;
+    using const_reference = const Value&;
+    using iterator = typename storage_type::iterator;
+    using const_iterator = typename storage_type::const_iterator;
+
+    constexpr reference operator[](const IndexT& aIndex) noexcept
+    {
+        assert(contains(aIndex) && "Index is out of range.");
+        return values_[details::to_position(aIndex)];
+    }
+
+    constexpr const_reference operator[](const IndexT& aIndex) const noexcept
+    {
+        assert(contains(aIndex) && "Index is out of range.");
+        return values_[details::to_position(aIndex)];
+    }
+
+    constexpr bool contains(const IndexT& aIndex) const noexcept
+    {
+        return details::is_in_range(aIndex, N);
+    }
+
+    constexpr details::index_range<IndexT> indices() const noexcept
+    {
+        return details::index_range<IndexT>(N);
+    }
+
+    void fill(const Value& aValue) { values_.fill(aValue); }
+
+    constexpr Value* data() noexcept { return values_.data(); }
+    constexpr const Value* data() const noexcept { return values_.data(); }
+
+    constexpr iterator begin() noexcept { return values_.begin(); }
+    constexpr const_iterator begin() const noexcept { return values_.begin(); }
+    constexpr iterator end() noexcept { return values_.end(); }
+    constexpr const_iterator end() const noexcept { return values_.end(); }
+
+    constexpr bool empty() const noexcept { return N == 0; }
+    constexpr size_type size() const noexcept { return N; }
+
+    // Public to keep index_array an aggregate, like std::array.
+    storage_type values_;
+};
+
+namespace pmr
+{
+template <typename IndexT, typename Value>
+using index_vector =
+    strong::index_vector<IndexT, Value, std::pmr::polymorphic_allocator<Value>>;
+}  // namespace pmr
+}  // namespace strong
+
+#endif /* strong_type_index_vector_h */
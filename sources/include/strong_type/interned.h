@@ -0,0 +1,279 @@
+#ifndef strong_type_interned_h
+#define strong_type_interned_h
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <string_view>
+
+#include "hash.h"
+#include "strong_type.h"
+
+namespace strong
+{
+template <typename Tag>
+class intern_table;
+
+// Gives an interned id access to its string.
+template <typename StrongT>
+struct interned_string
+{
+    std::string_view view() const noexcept
+    {
+        const StrongT& ref = static_cast<const StrongT&>(*this);
+        return intern_table<tag_type<StrongT>>::instance().view(ref);
+    }
+};
+
+// Compact id of a string interned in the table of Tag. Equal strings have
+// equal ids, so equality and hashing are integer operations; ordering is
+// the order of interning, not lexicographic. A value-initialized id stands
+// for the empty string.
+template <typename Tag>
+using interned = strong_type<Tag, std::uint32_t, comparisons, hashable,
+                             interned_string>;
+
+namespace details
+{
+inline unsigned highest_bit(std::uint32_t aValue) noexcept
+{
+    assert(aValue != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return 31u - static_cast<unsigned>(__builtin_clz(aValue));
+#else
+    unsigned bit = 0;
+    while (aValue >>= 1)
+    {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+}  // namespace details
+
+// Process-wide table of strings interned for Tag.
+//
+// Bytes of strings are copied into an arena and never move, so views stay
+// valid until the table is destroyed at the end of the program. Views of
+// ids are kept in segments of doubling size that are never reallocated:
+// view() is two loads.
+// Strings are found through an open addressing table of (hash, id) words;
+// lookups of strings that are already interned only read atomics and never
+// lock. Interning a new string takes a mutex; when the lookup table grows,
+// the old one is kept in the arena, so readers that still probe it stay
+// safe and at worst fall back to the locked path.
+template <typename Tag>
+class intern_table
+{
+   public:
+    using id_type = interned<Tag>;
+
+    static intern_table& instance() noexcept
+    {
+        static intern_table table;
+        return table;
+    }
+
+    intern_table(const intern_table&) = delete;
+    intern_table& operator=(const intern_table&) = delete;
+
+    id_type intern(std::string_view aString)
+    {
+        const std::uint32_t hash = hash_of(aString);
+        if (const auto found = find(aString, hash))
+        {
+            return *found;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (const auto found = find(aString, hash))
+        {
+            return *found;
+        }
+        return add(aString, hash);
+    }
+
+    // Id of aString if it has been interned.
+    std::optional<id_type> find(std::string_view aString) const noexcept
+    {
+        return find(aString, hash_of(aString));
+    }
+
+    std::string_view view(id_type aId) const noexcept
+    {
+        assert(aId.get() < size() && "Id was not issued by this table.");
+        const std::uint32_t position = aId.get() + kFirstSegmentSize;
+        const unsigned segment = details::highest_bit(position) - kFirstBits;
+        const std::string_view* views =
+            segments_[segment].load(std::memory_order_acquire);
+        return views[position - (kFirstSegmentSize << segment)];
+    }
+
+    // Number of interned strings, including the empty string.
+    std::size_t size() const noexcept
+    {
+        return count_.load(std::memory_order_acquire);
+    }
+
+   private:
+    static constexpr unsigned kFirstBits = 6;
+    static constexpr std::uint32_t kFirstSegmentSize = 1u << kFirstBits;
+    static constexpr unsigned kSegments = 32 - kFirstBits;
+    static constexpr std::size_t kMinSlots = 256;
+
+    // Slot of the lookup table: hash in the high half, id + 1 in the low
+    // half, 0 if free.
+    struct lookup_table
+    {
+        std::size_t mask;
+        std::atomic<std::uint64_t>* slots;
+    };
+
+    intern_table() : arena_(kArenaBlock)
+    {
+        for (auto& segment: segments_)
+        {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        table_.store(make_table(kMinSlots), std::memory_order_release);
+        add(std::string_view(), hash_of(std::string_view()));
+    }
+
+    static std::uint32_t hash_of(std::string_view aString) noexcept
+    {
+        const auto hash = static_cast<std::uint64_t>(
+            std::hash<std::string_view>{}(aString));
+        return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+    }
+
+    static std::uint64_t slot_value(std::uint32_t aHash,
+                                    std::uint32_t aId) noexcept
+    {
+        return (std::uint64_t{aHash} << 32) | (std::uint64_t{aId} + 1);
+    }
+
+    std::optional<id_type> find(std::string_view aString,
+                                std::uint32_t aHash) const noexcept
+    {
+        const lookup_table* table = table_.load(std::memory_order_acquire);
+        for (std::size_t slot = aHash & table->mask;;
+             slot = (slot + 1) & table->mask)
+        {
+            const std::uint64_t value =
+                table->slots[slot].load(std::memory_order_acquire);
+            if (value == 0)
+            {
+                return std::nullopt;
+            }
+            if (static_cast<std::uint32_t>(value >> 32) == aHash)
+            {
+                const id_type id(static_cast<std::uint32_t>(value) - 1);
+                if (view(id) == aString)
+                {
+                    return id;
+                }
+            }
+        }
+    }
+
+    lookup_table* make_table(std::size_t aSlots)
+    {
+        auto* slots = static_cast<std::atomic<std::uint64_t>*>(
+            arena_.allocate(aSlots * sizeof(std::atomic<std::uint64_t>),
+                            alignof(std::atomic<std::uint64_t>)));
+        for (std::size_t i = 0; i < aSlots; ++i)
+        {
+            new (slots + i) std::atomic<std::uint64_t>(0);
+        }
+        auto* table = static_cast<lookup_table*>(
+            arena_.allocate(sizeof(lookup_table), alignof(lookup_table)));
+        return new (table) lookup_table{aSlots - 1, slots};
+    }
+
+    static void insert(lookup_table* aTable, std::uint64_t aValue) noexcept
+    {
+        std::size_t slot = static_cast<std::uint32_t>(aValue >> 32) &
+                           aTable->mask;
+        while (aTable->slots[slot].load(std::memory_order_relaxed) != 0)
+        {
+            slot = (slot + 1) & aTable->mask;
+        }
+        aTable->slots[slot].store(aValue, std::memory_order_release);
+    }
+
+    // Called with mutex_ held.
+    id_type add(std::string_view aString, std::uint32_t aHash)
+    {
+        const auto id = static_cast<std::uint32_t>(
+            count_.load(std::memory_order_relaxed));
+        assert(id < 0xFFFFFFFFu - kFirstSegmentSize &&
+               "Too many interned strings.");
+
+        char* bytes = nullptr;
+        if (!aString.empty())
+        {
+            bytes = static_cast<char*>(arena_.allocate(aString.size(), 1));
+            std::memcpy(bytes, aString.data(), aString.size());
+        }
+        const std::uint32_t position = id + kFirstSegmentSize;
+        const unsigned segment = details::highest_bit(position) - kFirstBits;
+        std::string_view* views =
+            segments_[segment].load(std::memory_order_relaxed);
+        if (views == nullptr)
+        {
+            const std::size_t length = std::size_t{kFirstSegmentSize}
+                                       << segment;
+            views = static_cast<std::string_view*>(
+                arena_.allocate(length * sizeof(std::string_view),
+                                alignof(std::string_view)));
+            segments_[segment].store(views, std::memory_order_release);
+        }
+        new (views + (position - (kFirstSegmentSize << segment)))
+            std::string_view(bytes, aString.size());
+        count_.store(id + 1, std::memory_order_release);
+
+        lookup_table* table = table_.load(std::memory_order_relaxed);
+        if (2 * (std::size_t{id} + 1) > table->mask + 1)
+        {
+            lookup_table* grown = make_table(2 * (table->mask + 1));
+            for (std::size_t slot = 0; slot <= table->mask; ++slot)
+            {
+                const std::uint64_t value =
+                    table->slots[slot].load(std::memory_order_relaxed);
+                if (value != 0)
+                {
+                    insert(grown, value);
+                }
+            }
+            table_.store(grown, std::memory_order_release);
+            table = grown;
+        }
+        insert(table, slot_value(aHash, id));
+        return id_type(id);
+    }
+
+    static constexpr std::size_t kArenaBlock = 64 * 1024;
+
+    std::mutex mutex_;
+    std::pmr::monotonic_buffer_resource arena_;
+    std::atomic<lookup_table*> table_{nullptr};
+    std::atomic<std::string_view*> segments_[kSegments];
+    std::atomic<std::size_t> count_{0};
+};
+
+// Interns aString in the table of Tag.
+template <typename Tag>
+interned<Tag> intern(std::string_view aString)
+{
+    return intern_table<Tag>::instance().intern(aString);
+}
+}  // namespace strong
+
+#endif /* strong_type_interned_h */
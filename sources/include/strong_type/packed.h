@@ -0,0 +1,300 @@
+#ifndef strong_type_packed_h
+#define strong_type_packed_h
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "simd.h"
+#include "span.h"
+#include "strong_type.h"
+
+namespace strong
+{
+// Field of a packed word: values of StrongT stored in Bits bits.
+template <typename StrongT, unsigned Bits>
+struct field
+{
+    static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+    static_assert(std::is_unsigned_v<underlying_type<StrongT>> &&
+                      !std::is_same_v<underlying_type<StrongT>, bool>,
+                  "Fields must have unsigned integral underlying types.");
+    static_assert(Bits > 0 &&
+                      Bits <= std::numeric_limits<
+                                  underlying_type<StrongT>>::digits,
+                  "Invalid number of bits.");
+
+    using type = StrongT;
+    static constexpr unsigned bits = Bits;
+};
+
+namespace details
+{
+template <typename StrongT, typename... Fields>
+inline constexpr std::size_t count_of_v =
+    (std::size_t{0} + ... + std::is_same_v<StrongT, typename Fields::type>);
+
+// Number of bits below the field of StrongT: the total width of the fields
+// listed before it.
+template <typename StrongT, typename... Fields>
+constexpr unsigned shift_of() noexcept
+{
+    unsigned shift = 0;
+    bool found = false;
+    ((found = found || std::is_same_v<StrongT, typename Fields::type>,
+      shift += found ? 0 : Fields::bits),
+     ...);
+    return shift;
+}
+
+template <typename StrongT, typename... Fields>
+constexpr unsigned bits_of() noexcept
+{
+    return ((std::is_same_v<StrongT, typename Fields::type> ? Fields::bits
+                                                            : 0) +
+            ...);
+}
+
+template <typename Word, unsigned Bits>
+inline constexpr Word low_mask_v =
+    Bits == std::numeric_limits<Word>::digits
+        ? std::numeric_limits<Word>::max()
+        : static_cast<Word>((Word{1} << Bits) - 1);
+}  // namespace details
+
+// Strong fields packed into one unsigned word, e.g. shard, generation and
+// slot of a 64-bit handle. Fields are identified by their strong types and
+// laid out from the least significant bit in the order of Fields; masks and
+// shifts are compile-time constants, so get() and set() compile to the same
+// shifts and masks as hand-written code.
+template <typename Word, typename... Fields>
+class packed
+{
+    static_assert(std::is_unsigned_v<Word> && !std::is_same_v<Word, bool>,
+                  "Word must be an unsigned integral type.");
+    static_assert((0u + ... + Fields::bits) <=
+                      unsigned{std::numeric_limits<Word>::digits},
+                  "Fields do not fit in Word.");
+    static_assert(
+        ((details::count_of_v<typename Fields::type, Fields...> == 1) && ...),
+        "Every field must have a distinct strong type.");
+    static_assert(((sizeof(underlying_type<typename Fields::type>) <=
+                    sizeof(Word)) &&
+                   ...),
+                  "Field types must not be wider than Word.");
+
+    template <typename StrongT>
+    static constexpr void check_field() noexcept
+    {
+        static_assert(details::count_of_v<StrongT, Fields...> == 1,
+                      "StrongT is not a field of this packed word.");
+    }
+
+   public:
+    using word_type = Word;
+
+    // Position of the field of StrongT.
+    template <typename StrongT>
+    static constexpr unsigned shift =
+        details::shift_of<StrongT, Fields...>();
+
+    template <typename StrongT>
+    static constexpr unsigned bits = details::bits_of<StrongT, Fields...>();
+
+    // Bits of the field of StrongT in place.
+    template <typename StrongT>
+    static constexpr Word mask =
+        static_cast<Word>(details::low_mask_v<Word, bits<StrongT>>
+                          << shift<StrongT>);
+
+    constexpr packed() noexcept : word_{} {}
+
+    constexpr explicit packed(typename Fields::type... aValues) noexcept
+        : word_{}
+    {
+        (set(aValues), ...);
+    }
+
+    static constexpr packed from_word(Word aWord) noexcept
+    {
+        packed result;
+        result.word_ = aWord;
+        return result;
+    }
+
+    constexpr Word word() const noexcept { return word_; }
+
+    template <typename StrongT>
+    constexpr StrongT get() const noexcept
+    {
+        check_field<StrongT>();
+        using T = underlying_type<StrongT>;
+        constexpr Word kMax = details::low_mask_v<Word, bits<StrongT>>;
+        return StrongT(static_cast<T>((word_ >> shift<StrongT>) & kMax));
+    }
+
+    // aValue must fit in the bits of its field.
+    template <typename StrongT>
+    constexpr void set(StrongT aValue) noexcept
+    {
+        check_field<StrongT>();
+        const Word value = static_cast<Word>(aValue.get());
+        assert((value <= details::low_mask_v<Word, bits<StrongT>>) &&
+               "Value does not fit in its field.");
+        word_ = static_cast<Word>((word_ & static_cast<Word>(~mask<StrongT>)) |
+                                  ((value << shift<StrongT>) & mask<StrongT>));
+    }
+
+    friend constexpr bool operator==(const packed& aLhs,
+                                     const packed& aRhs) noexcept
+    {
+        return aLhs.word_ == aRhs.word_;
+    }
+
+    friend constexpr bool operator!=(const packed& aLhs,
+                                     const packed& aRhs) noexcept
+    {
+        return aLhs.word_ != aRhs.word_;
+    }
+
+   private:
+    Word word_;
+};
+
+template <typename T>
+struct is_packed : std::false_type
+{
+};
+
+template <typename Word, typename... Fields>
+struct is_packed<packed<Word, Fields...>> : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool is_packed_v = is_packed<T>::value;
+
+namespace simd::details
+{
+template <typename StrongT, typename PackedT>
+void unpack_scalar(const PackedT* aIn, StrongT* aOut,
+                   std::size_t aCount) noexcept
+{
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        aOut[i] = aIn[i].template get<StrongT>();
+    }
+}
+
+#if STRONG_TYPE_SIMD_X86
+// Narrows lanes of aIn to lanes of To halving their width at every step:
+// direct conversion from 64- to 8- or 16-bit lanes is not recognized as a
+// sequence of packs and is done lane by lane.
+template <typename To, std::size_t Lanes, typename From>
+STRONG_TYPE_SIMD_INLINE void narrow(
+    const vector_t<From, Lanes * sizeof(From)>& aIn,
+    vector_t<To, Lanes * sizeof(To)>& aOut) noexcept
+{
+    if constexpr (sizeof(From) == sizeof(To))
+    {
+        aOut = __builtin_convertvector(aIn, vector_t<To, Lanes * sizeof(To)>);
+    }
+    else
+    {
+        using Half = strong::details::unsigned_of_size_t<sizeof(From) / 2>;
+        const auto half =
+            __builtin_convertvector(aIn, vector_t<Half, Lanes * sizeof(Half)>);
+        narrow<To, Lanes, Half>(half, aOut);
+    }
+}
+
+// Every iteration extracts the field from four vectors of words.
+template <std::size_t Bytes, typename StrongT, typename PackedT>
+STRONG_TYPE_SIMD_INLINE void unpack_body(const PackedT* aIn, StrongT* aOut,
+                                         std::size_t aCount) noexcept
+{
+    using Word = typename PackedT::word_type;
+    using T = underlying_type<StrongT>;
+    constexpr std::size_t kLanes = 4 * Bytes / sizeof(Word);
+    constexpr unsigned kShift = PackedT::template shift<StrongT>;
+    constexpr Word kMask =
+        strong::details::low_mask_v<Word, PackedT::template bits<StrongT>>;
+
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        vector_t<Word, kLanes * sizeof(Word)> words;
+        __builtin_memcpy(&words, aIn + i, sizeof(words));
+        words = (words >> kShift) & kMask;
+        vector_t<T, kLanes * sizeof(T)> values;
+        narrow<T, kLanes, Word>(words, values);
+        __builtin_memcpy(static_cast<void*>(aOut + i), &values,
+                         sizeof(values));
+    }
+    unpack_scalar(aIn + i, aOut + i, aCount - i);
+}
+
+template <typename StrongT, typename PackedT>
+void unpack_sse2(const PackedT* aIn, StrongT* aOut,
+                 std::size_t aCount) noexcept
+{
+    unpack_body<16>(aIn, aOut, aCount);
+}
+
+template <typename StrongT, typename PackedT>
+STRONG_TYPE_TARGET("avx2")
+void unpack_avx2(const PackedT* aIn, StrongT* aOut,
+                 std::size_t aCount) noexcept
+{
+    unpack_body<32>(aIn, aOut, aCount);
+}
+
+template <typename StrongT, typename PackedT>
+STRONG_TYPE_TARGET("avx512f,avx512bw")
+void unpack_avx512(const PackedT* aIn, StrongT* aOut,
+                   std::size_t aCount) noexcept
+{
+    unpack_body<64>(aIn, aOut, aCount);
+}
+#endif
+}  // namespace simd::details
+
+namespace simd
+{
+// aOut[i] = aIn[i].get<StrongT>() for a range of packed words. A field is
+// one shift and one mask of a word, so words are processed in vector
+// registers (SSE2, AVX2, AVX-512) and narrowed to the field type.
+template <typename StrongT, typename InRange, typename OutRange>
+void unpack(const InRange& aIn, OutRange&& aOut,
+            target aTarget = best_target()) noexcept
+{
+    using PackedT = details::range_value_t<const InRange>;
+    static_assert(is_packed_v<PackedT>, "Input must be packed words.");
+    static_assert(std::is_same_v<StrongT, details::range_value_t<OutRange>>,
+                  "Output must be values of StrongT.");
+    static_assert(sizeof(PackedT) == sizeof(typename PackedT::word_type),
+                  "packed must have the layout of its word.");
+    const span<const PackedT> in(aIn);
+    const span<StrongT> out(aOut);
+    assert(in.size() == out.size() && "Ranges must have the same size.");
+#if STRONG_TYPE_SIMD_X86
+    switch (details::clamp(aTarget))
+    {
+        case target::avx512:
+            return details::unpack_avx512(in.data(), out.data(), out.size());
+        case target::avx2:
+            return details::unpack_avx2(in.data(), out.data(), out.size());
+        case target::sse2:
+            return details::unpack_sse2(in.data(), out.data(), out.size());
+        default:
+            break;
+    }
+#endif
+    (void)aTarget;
+    details::unpack_scalar(in.data(), out.data(), out.size());
+}
+}  // namespace simd
+}  // namespace strong
+
+#endif /* strong_type_packed_h */
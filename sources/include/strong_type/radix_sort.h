@@ -0,0 +1,387 @@
+#ifndef strong_type_radix_sort_h
+#define strong_type_radix_sort_h
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "span.h"
+#include "strong_type.h"
+
+namespace strong
+{
+// Unsigned sort key of StrongT: comparing keys as unsigned integers must
+// order values like StrongT does. The default covers strong types with an
+// integral underlying type: the value itself for unsigned types, with the
+// sign bit flipped for signed ones. Specialize it for strong types that
+// sort differently:
+// template <> struct strong::radix_key<Version>
+// {
+//     using type = std::uint32_t;
+//     static type get(const Version& aValue) noexcept;
+// };
+template <typename StrongT, typename = void>
+struct radix_key
+{
+};
+
+template <typename StrongT>
+struct radix_key<
+    StrongT,
+    std::enable_if_t<std::is_integral_v<typename is_strong<StrongT>::type> &&
+                     !std::is_same_v<typename is_strong<StrongT>::type, bool>>>
+{
+    using type = std::make_unsigned_t<underlying_type<StrongT>>;
+
+    static constexpr type get(const StrongT& aValue) noexcept
+    {
+        constexpr type kFlip =
+            std::is_signed_v<underlying_type<StrongT>>
+                ? static_cast<type>(type{1}
+                                    << (std::numeric_limits<type>::digits - 1))
+                : type{0};
+        return static_cast<type>(static_cast<type>(aValue.get()) ^ kFlip);
+    }
+};
+
+template <typename StrongT, typename = void>
+inline constexpr bool is_radix_sortable_v = false;
+
+template <typename StrongT>
+inline constexpr bool is_radix_sortable_v<
+    StrongT, std::void_t<typename radix_key<StrongT>::type>> = true;
+
+namespace details
+{
+inline constexpr unsigned kRadixDigitBits = 8;
+inline constexpr std::size_t kRadixBuckets = std::size_t{1}
+                                             << kRadixDigitBits;
+// Threads are not worth starting for fewer elements each.
+inline constexpr std::size_t kRadixMinPerThread = std::size_t{1} << 16;
+
+using radix_histogram = std::array<std::size_t, kRadixBuckets>;
+
+template <typename StrongT>
+inline constexpr unsigned radix_passes_v =
+    static_cast<unsigned>(sizeof(typename radix_key<StrongT>::type));
+
+template <typename StrongT>
+using radix_histograms = std::array<radix_histogram, radix_passes_v<StrongT>>;
+
+template <typename StrongT>
+std::size_t radix_digit(const StrongT& aValue, unsigned aPass) noexcept
+{
+    const auto key =
+        static_cast<std::uint64_t>(radix_key<StrongT>::get(aValue));
+    return static_cast<std::size_t>((key >> (aPass * kRadixDigitBits)) &
+                                    (kRadixBuckets - 1));
+}
+
+// Histograms of every digit of aKeys[aBegin, aEnd), in one read.
+template <typename StrongT>
+void radix_count(const StrongT* aKeys, std::size_t aBegin, std::size_t aEnd,
+                 radix_histograms<StrongT>& aCounts) noexcept
+{
+    for (std::size_t i = aBegin; i < aEnd; ++i)
+    {
+        for (unsigned pass = 0; pass < radix_passes_v<StrongT>; ++pass)
+        {
+            ++aCounts[pass][radix_digit(aKeys[i], pass)];
+        }
+    }
+}
+
+// Stable scatter of [aBegin, aEnd) by the digit of aPass; aOffsets holds
+// the first output position of every digit and is advanced.
+template <typename StrongT, typename V>
+void radix_scatter(StrongT* aIn, V* aInValues, StrongT* aOut, V* aOutValues,
+                   std::size_t aBegin, std::size_t aEnd, unsigned aPass,
+                   radix_histogram& aOffsets)
+{
+    for (std::size_t i = aBegin; i < aEnd; ++i)
+    {
+        const std::size_t to = aOffsets[radix_digit(aIn[i], aPass)]++;
+        aOut[to] = aIn[i];
+        if constexpr (!std::is_void_v<V>)
+        {
+            aOutValues[to] = std::move(aInValues[i]);
+        }
+    }
+}
+
+// Threads that are joined on destruction, also during stack unwinding:
+// destroying a joinable std::thread calls std::terminate.
+class joining_threads
+{
+   public:
+    explicit joining_threads(std::size_t aCapacity)
+    {
+        threads_.reserve(aCapacity);
+    }
+    joining_threads(const joining_threads&) = delete;
+    joining_threads& operator=(const joining_threads&) = delete;
+    ~joining_threads()
+    {
+        for (auto& thread: threads_)
+        {
+            thread.join();
+        }
+    }
+
+    template <typename... Args>
+    void start(Args&&... aArgs)
+    {
+        threads_.emplace_back(std::forward<Args>(aArgs)...);
+    }
+
+   private:
+    std::vector<std::thread> threads_;
+};
+
+// Calls aFunction(t) for t in [0, aThreads), on aThreads - 1 new threads
+// and the calling one. Started threads are always joined before
+// radix_parallel returns or throws. An exception of aFunction on a new
+// thread is caught there and rethrown on the calling one after the join;
+// if several calls throw, the one of the lowest t propagates.
+template <typename Function>
+void radix_parallel(std::size_t aThreads, const Function& aFunction)
+{
+    std::vector<std::exception_ptr> errors(aThreads);
+    {
+        joining_threads workers(aThreads - 1);
+        for (std::size_t t = 1; t < aThreads; ++t)
+        {
+            workers.start(
+                [&aFunction, &errors, t]
+                {
+                    try
+                    {
+                        aFunction(t);
+                    }
+                    catch (...)
+                    {
+                        errors[t] = std::current_exception();
+                    }
+                });
+        }
+        aFunction(std::size_t{0});
+    }
+    for (const auto& error: errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+}  // namespace details
+
+// Stable LSD radix sort of strong keys, optionally carrying values of type
+// V along. Keys are sorted one byte per pass, from the lowest byte; passes
+// where all keys have the same byte are skipped, so small ids in wide
+// types cost only the passes of their significant bytes. The scratch
+// buffers are kept between calls: reuse one sorter for many batches.
+//
+// With aThreads > 1, every pass is split into chunks of at least 64K
+// elements: each thread counts its chunk, then scatters it to offsets
+// computed from all counts. Threads are started per phase, which pays off
+// for large batches only. If moving a value throws, on any thread, the
+// exception propagates from sort() once all threads are joined, and the
+// order of keys and values is unspecified.
+template <typename StrongT, typename V = void>
+class radix_sorter
+{
+    static_assert(is_radix_sortable_v<StrongT>,
+                  "StrongT needs an integral underlying type or a "
+                  "strong::radix_key specialization.");
+
+   public:
+    using key_type = StrongT;
+    using mapped_type = V;
+
+    explicit radix_sorter(std::size_t aThreads = 1) noexcept
+        : threads_(std::max<std::size_t>(aThreads, 1))
+    {
+    }
+
+    std::size_t threads() const noexcept { return threads_; }
+
+    // Sorts a range of StrongT: a span, vector or array.
+    template <typename KeyRange>
+    void sort(KeyRange&& aKeys)
+    {
+        static_assert(
+            std::is_same_v<StrongT, details::range_value_t<KeyRange>>,
+            "Keys must be values of StrongT.");
+        const span<StrongT> keys(aKeys);
+        sort_impl<void>(keys.data(), nullptr, keys.size());
+    }
+
+    // Sorts aKeys and applies the same permutation to aValues.
+    template <typename KeyRange, typename ValueRange>
+    void sort(KeyRange&& aKeys, ValueRange&& aValues)
+    {
+        static_assert(!std::is_void_v<V>,
+                      "Sorting values needs a sorter with a value type.");
+        static_assert(
+            std::is_same_v<StrongT, details::range_value_t<KeyRange>>,
+            "Keys must be values of StrongT.");
+        static_assert(std::is_same_v<V, details::range_value_t<ValueRange>>,
+                      "Values must be values of V.");
+        const span<StrongT> keys(aKeys);
+        const span<V> values(aValues);
+        assert(keys.size() == values.size() &&
+               "Ranges must have the same size.");
+        sort_impl<V>(keys.data(), values.data(), keys.size());
+    }
+
+   private:
+    static constexpr unsigned kPasses = details::radix_passes_v<StrongT>;
+
+    using value_buffer =
+        std::conditional_t<std::is_void_v<V>, unsigned char, V>;
+
+    template <typename U>
+    void sort_impl(StrongT* aKeys, U* aValues, std::size_t aSize)
+    {
+        if (aSize < 2)
+        {
+            return;
+        }
+        const std::size_t threads = std::min(
+            threads_,
+            std::max<std::size_t>(aSize / details::kRadixMinPerThread, 1));
+        // First element of the chunk of aThread.
+        const auto chunk = [aSize, threads](std::size_t aThread)
+        {
+            return aSize / threads * aThread +
+                   std::min(aThread, aSize % threads);
+        };
+
+        std::vector<details::radix_histograms<StrongT>> counts(threads);
+        details::radix_parallel(
+            threads,
+            [&](std::size_t aThread)
+            {
+                counts[aThread] = {};
+                details::radix_count(aKeys, chunk(aThread),
+                                     chunk(aThread + 1), counts[aThread]);
+            });
+        details::radix_histograms<StrongT> totals{};
+        for (const auto& count: counts)
+        {
+            for (unsigned pass = 0; pass < kPasses; ++pass)
+            {
+                for (std::size_t digit = 0; digit < details::kRadixBuckets;
+                     ++digit)
+                {
+                    totals[pass][digit] += count[pass][digit];
+                }
+            }
+        }
+
+        keys_.resize(aSize);
+        if constexpr (!std::is_void_v<U>)
+        {
+            values_.resize(aSize);
+        }
+        StrongT* fromKeys = aKeys;
+        StrongT* toKeys = keys_.data();
+        U* fromValues = aValues;
+        U* toValues = nullptr;
+        if constexpr (!std::is_void_v<U>)
+        {
+            toValues = values_.data();
+        }
+        // Counts of the chunks are those of the input; they stay valid for
+        // later passes only with a single chunk.
+        bool counted = true;
+        for (unsigned pass = 0; pass < kPasses; ++pass)
+        {
+            if (std::find(totals[pass].begin(), totals[pass].end(), aSize) !=
+                totals[pass].end())
+            {
+                continue;
+            }
+            if (!counted)
+            {
+                details::radix_parallel(
+                    threads,
+                    [&](std::size_t aThread)
+                    {
+                        auto& count = counts[aThread][pass];
+                        count = {};
+                        for (std::size_t i = chunk(aThread);
+                             i < chunk(aThread + 1); ++i)
+                        {
+                            ++count[details::radix_digit(fromKeys[i], pass)];
+                        }
+                    });
+            }
+            counted = threads == 1;
+
+            std::vector<details::radix_histogram> offsets(threads);
+            std::size_t next = 0;
+            for (std::size_t digit = 0; digit < details::kRadixBuckets;
+                 ++digit)
+            {
+                for (std::size_t t = 0; t < threads; ++t)
+                {
+                    offsets[t][digit] = next;
+                    next += counts[t][pass][digit];
+                }
+            }
+            details::radix_parallel(
+                threads,
+                [&](std::size_t aThread)
+                {
+                    details::radix_scatter(fromKeys, fromValues, toKeys,
+                                           toValues, chunk(aThread),
+                                           chunk(aThread + 1), pass,
+                                           offsets[aThread]);
+                });
+            std::swap(fromKeys, toKeys);
+            std::swap(fromValues, toValues);
+        }
+
+        if (fromKeys != aKeys)
+        {
+            std::copy(fromKeys, fromKeys + aSize, aKeys);
+            if constexpr (!std::is_void_v<U>)
+            {
+                std::move(fromValues, fromValues + aSize, aValues);
+            }
+        }
+    }
+
+    std::size_t threads_;
+    std::vector<StrongT> keys_;
+    std::vector<value_buffer> values_;
+};
+
+// Sorts a range of strong keys with a temporary radix_sorter.
+template <typename KeyRange>
+void radix_sort(KeyRange&& aKeys)
+{
+    radix_sorter<details::range_value_t<KeyRange>>().sort(aKeys);
+}
+
+// Sorts aKeys and applies the same permutation to aValues.
+template <typename KeyRange, typename ValueRange>
+void radix_sort(KeyRange&& aKeys, ValueRange&& aValues)
+{
+    radix_sorter<details::range_value_t<KeyRange>,
+                 details::range_value_t<ValueRange>>()
+        .sort(aKeys, aValues);
+}
+}  // namespace strong
+
+#endif /* strong_type_radix_sort_h */
@@ -0,0 +1,518 @@
+#ifndef strong_type_serialize_h
+#define strong_type_serialize_h
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/uio.h>) && \
+    __has_include(<unistd.h>) && __has_include(<fcntl.h>)
+#define STRONG_TYPE_HAS_POSIX_IO 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#else
+#define STRONG_TYPE_HAS_POSIX_IO 0
+#endif
+
+#include "endian.h"
+#include "span.h"
+#include "strong_type.h"
+#include "varint.h"
+
+namespace strong
+{
+// Encoding of the values of a column.
+enum class encoding : std::uint8_t
+{
+    // Bytes of the values as they are in memory: written with one memcpy
+    // or writev, read back as a span without copying.
+    raw = 0,
+    // Differences of consecutive values, zigzag and LEB128 varint
+    // encoded: 1 or 2 bytes per value for sequence numbers and timestamps.
+    delta_varint = 1
+};
+
+// Columns are a 32-byte header followed by the payload, padded to 16 bytes
+// so that the next header and every raw payload in a buffer or a mapped
+// file starting at a 16-byte boundary are aligned. Integers are in native
+// byte order: store big_endian/little_endian fields to share files between
+// machines of different byte order.
+struct column_header
+{
+    static constexpr std::uint32_t kMagic = 0x4c435453;  // "STCL"
+
+    std::uint32_t magic;
+    encoding format;
+    std::uint8_t element_size;
+    std::uint16_t reserved;
+    std::uint64_t count;
+    std::uint64_t payload_size;
+    std::uint64_t padding;
+};
+
+static_assert(sizeof(column_header) == 32);
+
+inline constexpr std::size_t kColumnAlignment = 16;
+
+// Strong types and their big_endian/little_endian storage.
+template <typename StrongT>
+inline constexpr bool is_serializable_v =
+    (is_strong_v<StrongT> || is_endian_value_v<StrongT>) &&
+    std::is_trivially_copyable_v<StrongT> &&
+    sizeof(StrongT) <= std::numeric_limits<std::uint8_t>::max() &&
+    alignof(StrongT) <= kColumnAlignment;
+
+template <typename StrongT, typename = void>
+inline constexpr bool is_delta_encodable_v = false;
+
+// Strong integers: deltas of sequence numbers, timestamps, sorted ids.
+template <typename StrongT>
+inline constexpr bool is_delta_encodable_v<
+    StrongT,
+    std::enable_if_t<std::is_integral_v<typename is_strong<StrongT>::type>>> =
+    !std::is_same_v<underlying_type<StrongT>, bool>;
+
+// Position and error of a read, like std::from_chars_result: ptr is past the
+// column on success and at its header on failure. errc::invalid_argument
+// means the column is not a column of StrongT or cannot be read that way,
+// errc::illegal_byte_sequence that it is truncated or corrupt.
+struct column_result
+{
+    const std::byte* ptr;
+    std::errc ec;
+};
+
+namespace details
+{
+constexpr std::size_t column_padding(std::size_t aSize) noexcept
+{
+    return (kColumnAlignment - aSize % kColumnAlignment) % kColumnAlignment;
+}
+
+template <typename StrongT>
+column_header make_header(encoding aFormat, std::size_t aCount,
+                          std::size_t aPayloadSize) noexcept
+{
+    return column_header{column_header::kMagic,
+                         aFormat,
+                         static_cast<std::uint8_t>(sizeof(StrongT)),
+                         0,
+                         aCount,
+                         aPayloadSize,
+                         0};
+}
+
+template <typename StrongT>
+using delta_t = std::make_unsigned_t<underlying_type<StrongT>>;
+
+template <typename StrongT>
+std::size_t encode_deltas(const StrongT* aValues, std::size_t aCount,
+                          std::byte* aOut) noexcept
+{
+    using U = delta_t<StrongT>;
+    constexpr unsigned kSignBit = std::numeric_limits<U>::digits - 1;
+    std::byte* out = aOut;
+    U previous = 0;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        const auto value = static_cast<U>(aValues[i].get());
+        const auto delta = static_cast<U>(value - previous);
+        previous = value;
+        // Zigzag: small negative deltas get small codes too.
+        const auto sign =
+            static_cast<U>(U{0} - static_cast<U>(delta >> kSignBit));
+        out = write_varint(
+            static_cast<U>(static_cast<U>(delta << 1) ^ sign), out);
+    }
+    return static_cast<std::size_t>(out - aOut);
+}
+
+template <typename StrongT>
+bool decode_deltas(const std::byte* aIn, std::size_t aSize,
+                   StrongT* aValues, std::size_t aCount) noexcept
+{
+    using U = delta_t<StrongT>;
+    const std::byte* const last = aIn + aSize;
+    U previous = 0;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        U code = 0;
+        if (!read_varint(aIn, last, code))
+        {
+            return false;
+        }
+        const auto delta = static_cast<U>(static_cast<U>(code >> 1) ^
+                                          static_cast<U>(U{0} - (code & 1)));
+        previous = static_cast<U>(previous + delta);
+        aValues[i] = StrongT(static_cast<underlying_type<StrongT>>(previous));
+    }
+    return aIn == last;
+}
+
+// Header of the column at the beginning of aIn and its payload, checked
+// against StrongT.
+template <typename StrongT>
+std::errc read_header(span<const std::byte> aIn, column_header& aHeader,
+                      span<const std::byte>& aPayload) noexcept
+{
+    if (aIn.size() < sizeof(column_header))
+    {
+        return std::errc::illegal_byte_sequence;
+    }
+    std::memcpy(&aHeader, aIn.data(), sizeof(column_header));
+    if (aHeader.magic != column_header::kMagic)
+    {
+        return std::errc::illegal_byte_sequence;
+    }
+    if (aHeader.element_size != sizeof(StrongT))
+    {
+        return std::errc::invalid_argument;
+    }
+    const std::size_t available = aIn.size() - sizeof(column_header);
+    if (aHeader.payload_size > available ||
+        column_padding(aHeader.payload_size) >
+            available - aHeader.payload_size)
+    {
+        return std::errc::illegal_byte_sequence;
+    }
+    aPayload = aIn.subspan(sizeof(column_header),
+                           static_cast<std::size_t>(aHeader.payload_size));
+    return std::errc();
+}
+
+// Whether a raw payload of aSize bytes holds exactly aCount values. aCount
+// comes from the header and is not multiplied, so it cannot overflow.
+template <typename StrongT>
+constexpr bool is_raw_payload_of(std::uint64_t aCount,
+                                 std::size_t aSize) noexcept
+{
+    return aSize % sizeof(StrongT) == 0 && aCount == aSize / sizeof(StrongT);
+}
+}  // namespace details
+
+// Appends a column of aValues to aOut. Raw columns are one memcpy; delta
+// encoding needs strong integers and is meant for monotonic sequences.
+template <typename Range>
+void serialize(const Range& aValues, std::vector<std::byte>& aOut,
+               encoding aFormat = encoding::raw)
+{
+    using StrongT = details::range_value_t<const Range>;
+    static_assert(is_serializable_v<StrongT>,
+                  "Values must be trivially copyable strong types.");
+    const span<const StrongT> values(aValues);
+    const std::size_t start = aOut.size();
+    std::size_t payloadSize = values.size_bytes();
+    if (aFormat == encoding::delta_varint)
+    {
+        if constexpr (is_delta_encodable_v<StrongT>)
+        {
+            payloadSize =
+                values.size() *
+                details::max_varint_size_v<details::delta_t<StrongT>>;
+        }
+        else
+        {
+            assert(false && "Delta encoding needs strong integers.");
+            aFormat = encoding::raw;
+        }
+    }
+    aOut.resize(start + sizeof(column_header) + payloadSize +
+                kColumnAlignment);
+    std::byte* payload = aOut.data() + start + sizeof(column_header);
+    if constexpr (is_delta_encodable_v<StrongT>)
+    {
+        if (aFormat == encoding::delta_varint)
+        {
+            payloadSize = details::encode_deltas(values.data(),
+                                                 values.size(), payload);
+        }
+    }
+    if (aFormat == encoding::raw && !values.empty())
+    {
+        std::memcpy(payload, values.data(), payloadSize);
+    }
+    const column_header header =
+        details::make_header<StrongT>(aFormat, values.size(), payloadSize);
+    std::memcpy(aOut.data() + start, &header, sizeof(header));
+    const std::size_t padding = details::column_padding(payloadSize);
+    std::memset(payload + payloadSize, 0, padding);
+    aOut.resize(start + sizeof(column_header) + payloadSize + padding);
+}
+
+// Reads the column at the beginning of aIn into aValues, whatever its
+// encoding.
+template <typename StrongT>
+column_result deserialize(span<const std::byte> aIn,
+                          std::vector<StrongT>& aValues)
+{
+    static_assert(is_serializable_v<StrongT>,
+                  "Values must be trivially copyable strong types.");
+    column_header header;
+    span<const std::byte> payload;
+    const std::errc error = details::read_header<StrongT>(aIn, header, payload);
+    if (error != std::errc())
+    {
+        return {aIn.data(), error};
+    }
+    const auto count = static_cast<std::size_t>(header.count);
+    if (header.format == encoding::raw)
+    {
+        if (!details::is_raw_payload_of<StrongT>(header.count, payload.size()))
+        {
+            return {aIn.data(), std::errc::illegal_byte_sequence};
+        }
+        aValues.resize(count);
+        if (count != 0)
+        {
+            std::memcpy(aValues.data(), payload.data(), payload.size());
+        }
+    }
+    else if constexpr (is_delta_encodable_v<StrongT>)
+    {
+        // Every value takes at least one byte.
+        if (header.format != encoding::delta_varint ||
+            header.count > payload.size())
+        {
+            return {aIn.data(), std::errc::illegal_byte_sequence};
+        }
+        aValues.resize(count);
+        if (!details::decode_deltas(payload.data(), payload.size(),
+                                    aValues.data(), count))
+        {
+            return {aIn.data(), std::errc::illegal_byte_sequence};
+        }
+    }
+    else
+    {
+        return {aIn.data(), std::errc::invalid_argument};
+    }
+    return {payload.data() + payload.size() +
+                details::column_padding(payload.size()),
+            std::errc()};
+}
+
+// Points aView at the values of the raw column at the beginning of aIn,
+// without copying: aView is valid as long as the bytes of aIn are. Fails
+// with errc::invalid_argument for other encodings and misaligned buffers.
+template <typename StrongT>
+column_result view_column(span<const std::byte> aIn,
+                          span<const StrongT>& aView) noexcept
+{
+    static_assert(is_serializable_v<StrongT>,
+                  "Values must be trivially copyable strong types.");
+    column_header header;
+    span<const std::byte> payload;
+    const std::errc error = details::read_header<StrongT>(aIn, header, payload);
+    if (error != std::errc())
+    {
+        return {aIn.data(), error};
+    }
+    if (header.format != encoding::raw ||
+        reinterpret_cast<std::uintptr_t>(payload.data()) % alignof(StrongT) !=
+            0)
+    {
+        return {aIn.data(), std::errc::invalid_argument};
+    }
+    if (!details::is_raw_payload_of<StrongT>(header.count, payload.size()))
+    {
+        return {aIn.data(), std::errc::illegal_byte_sequence};
+    }
+    aView = span<const StrongT>(
+        reinterpret_cast<const StrongT*>(payload.data()),
+        static_cast<std::size_t>(header.count));
+    return {payload.data() + payload.size() +
+                details::column_padding(payload.size()),
+            std::errc()};
+}
+
+// Reads consecutive columns of a buffer or a mapped_file.
+class column_reader
+{
+   public:
+    explicit column_reader(span<const std::byte> aBytes) noexcept
+        : bytes_(aBytes)
+    {
+    }
+
+    bool at_end() const noexcept { return bytes_.empty(); }
+
+    // Next column as a span into the bytes, see view_column.
+    template <typename StrongT>
+    std::errc read(span<const StrongT>& aView) noexcept
+    {
+        return advance(view_column(bytes_, aView));
+    }
+
+    // Next column copied or decoded into aValues, see deserialize.
+    template <typename StrongT>
+    std::errc read(std::vector<StrongT>& aValues)
+    {
+        return advance(deserialize(bytes_, aValues));
+    }
+
+   private:
+    std::errc advance(column_result aResult) noexcept
+    {
+        if (aResult.ec == std::errc())
+        {
+            bytes_ = bytes_.last(bytes_.size() -
+                                 static_cast<std::size_t>(aResult.ptr -
+                                                          bytes_.data()));
+        }
+        return aResult.ec;
+    }
+
+    span<const std::byte> bytes_;
+};
+
+#if STRONG_TYPE_HAS_POSIX_IO
+// Read-only memory mapping of a whole file. Pages are loaded on first
+// access, and raw columns read through column_reader are views into them.
+class mapped_file
+{
+   public:
+    // Maps the file at aPath, std::nullopt if it cannot be opened or mapped.
+    static std::optional<mapped_file> open(const char* aPath) noexcept
+    {
+        const int fd = ::open(aPath, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return std::nullopt;
+        }
+        struct stat status;
+        std::optional<mapped_file> result;
+        if (::fstat(fd, &status) == 0)
+        {
+            const auto size = static_cast<std::size_t>(status.st_size);
+            void* address = size == 0 ? nullptr
+                                      : ::mmap(nullptr, size, PROT_READ,
+                                               MAP_PRIVATE, fd, 0);
+            if (address != MAP_FAILED)
+            {
+                result.emplace(mapped_file(address, size));
+            }
+        }
+        ::close(fd);
+        return result;
+    }
+
+    mapped_file(mapped_file&& aOther) noexcept
+        : address_(std::exchange(aOther.address_, nullptr)),
+          size_(std::exchange(aOther.size_, 0))
+    {
+    }
+
+    mapped_file& operator=(mapped_file&& aOther) noexcept
+    {
+        std::swap(address_, aOther.address_);
+        std::swap(size_, aOther.size_);
+        return *this;
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    ~mapped_file()
+    {
+        if (address_ != nullptr)
+        {
+            ::munmap(address_, size_);
+        }
+    }
+
+    span<const std::byte> bytes() const noexcept
+    {
+        return span<const std::byte>(static_cast<const std::byte*>(address_),
+                                     size_);
+    }
+
+   private:
+    mapped_file(void* aAddress, std::size_t aSize) noexcept
+        : address_(aAddress), size_(aSize)
+    {
+    }
+
+    void* address_;
+    std::size_t size_;
+};
+
+// Writes raw columns of aColumns to aFd with writev: headers are built on
+// the stack and values are written from the ranges themselves, without
+// copying. Returns the error of write, if any.
+template <typename... Ranges>
+std::errc write_columns(int aFd, const Ranges&... aColumns) noexcept
+{
+    static_assert((is_serializable_v<details::range_value_t<const Ranges>> &&
+                   ...),
+                  "Values must be trivially copyable strong types.");
+    static_assert(sizeof...(Ranges) > 0, "No columns to write.");
+    static const std::byte kZeros[kColumnAlignment] = {};
+    constexpr std::size_t kColumns = sizeof...(Ranges);
+    column_header headers[kColumns];
+    iovec parts[3 * kColumns];
+    std::size_t column = 0;
+    const auto add = [&](const auto& aColumn)
+    {
+        using StrongT =
+            details::range_value_t<std::remove_reference_t<decltype(aColumn)>>;
+        const span<const StrongT> values(aColumn);
+        headers[column] = details::make_header<StrongT>(
+            encoding::raw, values.size(), values.size_bytes());
+        parts[3 * column] = {&headers[column], sizeof(column_header)};
+        parts[3 * column + 1] = {const_cast<StrongT*>(values.data()),
+                                 values.size_bytes()};
+        parts[3 * column + 2] = {const_cast<std::byte*>(kZeros),
+                                 details::column_padding(values.size_bytes())};
+        ++column;
+    };
+    (add(aColumns), ...);
+
+    iovec* part = parts;
+    std::size_t left = 3 * kColumns;
+    while (left != 0)
+    {
+        const ssize_t written =
+            ::writev(aFd, part, static_cast<int>(std::min<std::size_t>(
+                                    left, IOV_MAX)));
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return static_cast<std::errc>(errno);
+        }
+        // Skips what was written, possibly a part of one iovec.
+        auto remaining = static_cast<std::size_t>(written);
+        while (left != 0 && remaining >= part->iov_len)
+        {
+            remaining -= part->iov_len;
+            ++part;
+            --left;
+        }
+        if (left != 0)
+        {
+            part->iov_base = static_cast<char*>(part->iov_base) + remaining;
+            part->iov_len -= remaining;
+        }
+    }
+    return std::errc();
+}
+#endif
+}  // namespace strong
+
+#endif /* strong_type_serialize_h */
@@ -0,0 +1,123 @@
+#ifndef strong_type_sharded_counter_h
+#define strong_type_sharded_counter_h
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#include "atomic.h"
+#include "strong_type.h"
+
+namespace strong
+{
+namespace details
+{
+inline std::atomic<std::size_t> next_thread_slot{0};
+
+// Small dense number of the calling thread, assigned on first use.
+inline std::size_t this_thread_slot() noexcept
+{
+    thread_local const std::size_t slot =
+        next_thread_slot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+inline std::size_t round_up_to_power_of_two(std::size_t aValue) noexcept
+{
+    std::size_t result = 1;
+    while (result < aValue)
+    {
+        result *= 2;
+    }
+    return result;
+}
+}  // namespace details
+
+// Counter split into cache line sized shards. Each thread increments its own
+// shard with relaxed RMW, so increments from different threads do not
+// contend; snapshot() sums all shards. Snapshot taken while other threads
+// increment is not linearizable: it sees some subset of concurrent
+// increments.
+template <typename StrongT>
+class sharded_counter
+{
+    static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+    static_assert(has_op_v<StrongT, plus> ||
+                      has_op_v<StrongT, plus_assignment>,
+                  "StrongT must have plus or plus_assignment.");
+    using T = underlying_type<StrongT>;
+    static_assert(std::is_integral_v<T>, "Invalid underlying type.");
+
+    struct alignas(cache_line_size) shard
+    {
+        std::atomic<T> value{};
+    };
+
+   public:
+    using value_type = StrongT;
+
+    // Number of shards used by default: hardware threads rounded up to a
+    // power of two.
+    static std::size_t default_shard_count() noexcept
+    {
+        const std::size_t threads = std::thread::hardware_concurrency();
+        return details::round_up_to_power_of_two(threads ? threads : 1);
+    }
+
+    sharded_counter() : sharded_counter(default_shard_count()) {}
+
+    // aShardCount is rounded up to a power of two.
+    explicit sharded_counter(std::size_t aShardCount)
+        : mask_(details::round_up_to_power_of_two(aShardCount) - 1),
+          shards_(std::make_unique<shard[]>(mask_ + 1))
+    {
+    }
+
+    sharded_counter(const sharded_counter&) = delete;
+    sharded_counter& operator=(const sharded_counter&) = delete;
+
+    std::size_t shard_count() const noexcept { return mask_ + 1; }
+
+    void add(StrongT aDelta) noexcept
+    {
+        shards_[details::this_thread_slot() & mask_].value.fetch_add(
+            aDelta.get(), std::memory_order_relaxed);
+    }
+
+    StrongT snapshot() const noexcept
+    {
+        StrongT total{};
+        for (std::size_t i = 0; i <= mask_; ++i)
+        {
+            const StrongT value(
+                shards_[i].value.load(std::memory_order_relaxed));
+            if constexpr (has_op_v<StrongT, plus_assignment>)
+            {
+                total += value;
+            }
+            else
+            {
+                total = total + value;
+            }
+        }
+        return total;
+    }
+
+    // Not atomic with respect to concurrent add().
+    void reset() noexcept
+    {
+        for (std::size_t i = 0; i <= mask_; ++i)
+        {
+            shards_[i].value.store(T{}, std::memory_order_relaxed);
+        }
+    }
+
+   private:
+    std::size_t mask_;
+    std::unique_ptr<shard[]> shards_;
+};
+}  // namespace strong
+
+#endif /* strong_type_sharded_counter_h */
@@ -0,0 +1,966 @@
+#ifndef strong_type_simd_h
+#define strong_type_simd_h
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "span.h"
+#include "strong_type.h"
+
+// Explicit SSE2/AVX2/AVX-512 kernels are available for x86-64 with GCC and
+// Clang. Every other platform uses scalar loops.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(_MSC_VER)
+#define STRONG_TYPE_SIMD_X86 1
+#include <immintrin.h>
+#define STRONG_TYPE_SIMD_INLINE __attribute__((always_inline)) inline
+#define STRONG_TYPE_TARGET(features) __attribute__((target(features)))
+#else
+#define STRONG_TYPE_SIMD_X86 0
+#endif
+
+namespace strong::simd
+{
+// Instruction sets in ascending order of capabilities.
+enum class target
+{
+    scalar,
+    sse2,
+    avx2,
+    avx512
+};
+
+// Element-wise operations and the mixins they require:
+// add - plus, sub - minus, mul - multiplication, bit_and - bitwise_and,
+// bit_or - bitwise_or, bit_xor - bitwise_xor, min/max - comparisons,
+// saturating_add - saturating_plus, saturating_sub - saturating_minus.
+enum class op
+{
+    add,
+    sub,
+    mul,
+    bit_and,
+    bit_or,
+    bit_xor,
+    min,
+    max,
+    saturating_add,
+    saturating_sub
+};
+
+// Reductions and the mixins they require: sum - plus, min/max - comparisons.
+enum class reduction
+{
+    sum,
+    min,
+    max
+};
+
+namespace details
+{
+inline target detect_target() noexcept
+{
+#if STRONG_TYPE_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    {
+        return target::avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return target::avx2;
+    }
+    return target::sse2;
+#else
+    return target::scalar;
+#endif
+}
+}  // namespace details
+
+// The most capable instruction set supported by the CPU and by the build.
+inline target best_target() noexcept
+{
+    static const target kBest = details::detect_target();
+    return kBest;
+}
+
+inline bool is_supported(target aTarget) noexcept
+{
+    return static_cast<int>(aTarget) <= static_cast<int>(best_target());
+}
+
+namespace details
+{
+using strong::details::range_value_t;
+
+template <typename T>
+inline constexpr bool is_vectorizable_v =
+    std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+// Integral arithmetic wraps around like vector instructions do.
+using strong::details::wrapping_t;
+
+template <op Op, typename StrongT>
+inline constexpr bool is_op_enabled_v =
+    Op == op::add       ? has_op_v<StrongT, plus>
+    : Op == op::sub     ? has_op_v<StrongT, minus>
+    : Op == op::mul     ? has_op_v<StrongT, multiplication>
+    : Op == op::bit_and ? has_op_v<StrongT, bitwise_and>
+    : Op == op::bit_or  ? has_op_v<StrongT, bitwise_or>
+    : Op == op::bit_xor ? has_op_v<StrongT, bitwise_xor>
+    : Op == op::saturating_add ? has_op_v<StrongT, saturating_plus>
+    : Op == op::saturating_sub ? has_op_v<StrongT, saturating_minus>
+                               : has_op_v<StrongT, comparisons>;
+
+template <op Op>
+inline constexpr bool is_saturating_v =
+    Op == op::saturating_add || Op == op::saturating_sub;
+
+template <reduction R, typename StrongT>
+inline constexpr bool is_reduction_enabled_v =
+    R == reduction::sum ? has_op_v<StrongT, plus>
+                        : has_op_v<StrongT, comparisons>;
+
+template <op Op, typename T>
+constexpr T apply(T aLhs, T aRhs) noexcept
+{
+    if constexpr (Op == op::min)
+    {
+        return aRhs < aLhs ? aRhs : aLhs;
+    }
+    else if constexpr (Op == op::max)
+    {
+        return aLhs < aRhs ? aRhs : aLhs;
+    }
+    else if constexpr (Op == op::saturating_add)
+    {
+        return strong::details::saturating_add(aLhs, aRhs);
+    }
+    else if constexpr (Op == op::saturating_sub)
+    {
+        return strong::details::saturating_sub(aLhs, aRhs);
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        using W = wrapping_t<T>;
+        const auto lhs = static_cast<W>(aLhs);
+        const auto rhs = static_cast<W>(aRhs);
+        if constexpr (Op == op::add)
+        {
+            return static_cast<T>(static_cast<W>(lhs + rhs));
+        }
+        else if constexpr (Op == op::sub)
+        {
+            return static_cast<T>(static_cast<W>(lhs - rhs));
+        }
+        else if constexpr (Op == op::mul)
+        {
+            return static_cast<T>(static_cast<W>(lhs * rhs));
+        }
+        else if constexpr (Op == op::bit_and)
+        {
+            return static_cast<T>(lhs & rhs);
+        }
+        else if constexpr (Op == op::bit_or)
+        {
+            return static_cast<T>(lhs | rhs);
+        }
+        else
+        {
+            return static_cast<T>(lhs ^ rhs);
+        }
+    }
+    else
+    {
+        static_assert(Op == op::add || Op == op::sub || Op == op::mul,
+                      "Bitwise operations require integral underlying type.");
+        if constexpr (Op == op::add)
+        {
+            return aLhs + aRhs;
+        }
+        else if constexpr (Op == op::sub)
+        {
+            return aLhs - aRhs;
+        }
+        else
+        {
+            return aLhs * aRhs;
+        }
+    }
+}
+
+template <reduction R, typename T>
+constexpr T combine(T aLhs, T aRhs) noexcept
+{
+    if constexpr (R == reduction::sum)
+    {
+        return apply<op::add>(aLhs, aRhs);
+    }
+    else if constexpr (R == reduction::min)
+    {
+        return apply<op::min>(aLhs, aRhs);
+    }
+    else
+    {
+        return apply<op::max>(aLhs, aRhs);
+    }
+}
+
+template <bool Left, typename T>
+constexpr T shift(T aValue, unsigned aCount) noexcept
+{
+    if constexpr (Left)
+    {
+        using W = wrapping_t<T>;
+        return static_cast<T>(static_cast<W>(static_cast<W>(aValue) << aCount));
+    }
+    else
+    {
+        return static_cast<T>(aValue >> aCount);
+    }
+}
+
+template <op Op, bool Broadcast, typename StrongT>
+void transform_scalar(const StrongT* aLhs, const StrongT* aRhs,
+                      const StrongT* aScalar, StrongT* aOut,
+                      std::size_t aCount) noexcept
+{
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        const StrongT& rhs = Broadcast ? *aScalar : aRhs[i];
+        aOut[i] = StrongT(apply<Op>(aLhs[i].get(), rhs.get()));
+    }
+}
+
+template <bool Left, typename StrongT>
+void shift_scalar(const StrongT* aIn, unsigned aCount, StrongT* aOut,
+                  std::size_t aSize) noexcept
+{
+    for (std::size_t i = 0; i < aSize; ++i)
+    {
+        aOut[i] = StrongT(shift<Left>(aIn[i].get(), aCount));
+    }
+}
+
+template <reduction R, typename StrongT>
+StrongT reduce_scalar(const StrongT* aIn, std::size_t aCount) noexcept
+{
+    using T = underlying_type<StrongT>;
+    T result = aCount > 0 ? aIn[0].get() : T{};
+    for (std::size_t i = 1; i < aCount; ++i)
+    {
+        result = combine<R>(result, aIn[i].get());
+    }
+    return StrongT(result);
+}
+
+#if STRONG_TYPE_SIMD_X86
+template <typename T, std::size_t Bytes>
+struct vector
+{
+    typedef T type __attribute__((vector_size(Bytes)));
+};
+
+template <typename T, std::size_t Bytes>
+using vector_t = typename vector<T, Bytes>::type;
+
+// Vectors are never passed by value: vector arguments of functions compiled
+// without AVX have different ABI. Bodies below are always inlined into the
+// target-specific entry points and get compiled for their instruction set.
+// Saturating addition and subtraction of lanes of any width built from
+// wrapping arithmetic and lane masks.
+template <op Op, typename V>
+STRONG_TYPE_SIMD_INLINE void saturate_vector(const V& aLhs, const V& aRhs,
+                                             V& aResult) noexcept
+{
+    using E = std::remove_cv_t<std::remove_reference_t<decltype(aLhs[0])>>;
+    using U = std::make_unsigned_t<E>;
+    using UV = vector_t<U, sizeof(V)>;
+    constexpr bool kAdd = Op == op::saturating_add;
+
+    UV lhs;
+    UV rhs;
+    __builtin_memcpy(&lhs, &aLhs, sizeof(V));
+    __builtin_memcpy(&rhs, &aRhs, sizeof(V));
+    const UV wrapped = kAdd ? lhs + rhs : lhs - rhs;
+    UV mask;
+    if constexpr (std::is_unsigned_v<E>)
+    {
+        // Sum that wrapped around is less than aLhs, difference is greater.
+        if constexpr (kAdd)
+        {
+            const auto lanes = wrapped < lhs;
+            __builtin_memcpy(&mask, &lanes, sizeof(V));
+            aResult = wrapped | mask;
+        }
+        else
+        {
+            const auto lanes = wrapped > lhs;
+            __builtin_memcpy(&mask, &lanes, sizeof(V));
+            aResult = wrapped & ~mask;
+        }
+    }
+    else
+    {
+        V result;
+        __builtin_memcpy(&result, &wrapped, sizeof(V));
+        // Sign bit of a lane is set where the signed operation overflowed.
+        const V overflow = kAdd ? (aLhs ^ result) & (aRhs ^ result)
+                                : (aLhs ^ aRhs) & (aLhs ^ result);
+        const auto lanes = overflow < 0;
+        __builtin_memcpy(&mask, &lanes, sizeof(V));
+        // Bound has the sign of aLhs: minimum for negative lanes, maximum
+        // for the others.
+        const V bound = (aLhs >> (8 * sizeof(E) - 1)) ^
+                        std::numeric_limits<E>::max();
+        UV bits;
+        __builtin_memcpy(&bits, &bound, sizeof(V));
+        const UV saturated = (bits & mask) | (wrapped & ~mask);
+        __builtin_memcpy(&aResult, &saturated, sizeof(V));
+    }
+}
+
+template <op Op, typename V>
+STRONG_TYPE_SIMD_INLINE void apply_vector(const V& aLhs, const V& aRhs,
+                                          V& aResult) noexcept
+{
+    if constexpr (Op == op::add)
+    {
+        aResult = aLhs + aRhs;
+    }
+    else if constexpr (Op == op::sub)
+    {
+        aResult = aLhs - aRhs;
+    }
+    else if constexpr (Op == op::mul)
+    {
+        aResult = aLhs * aRhs;
+    }
+    else if constexpr (Op == op::bit_and)
+    {
+        aResult = aLhs & aRhs;
+    }
+    else if constexpr (Op == op::bit_or)
+    {
+        aResult = aLhs | aRhs;
+    }
+    else if constexpr (Op == op::bit_xor)
+    {
+        aResult = aLhs ^ aRhs;
+    }
+    else if constexpr (is_saturating_v<Op>)
+    {
+        saturate_vector<Op>(aLhs, aRhs, aResult);
+    }
+    else
+    {
+        // Comparison yields a vector of signed lanes of the same width with
+        // all bits set where the condition holds.
+        V mask;
+        if constexpr (Op == op::min)
+        {
+            const auto lanes = aRhs < aLhs;
+            __builtin_memcpy(&mask, &lanes, sizeof(V));
+        }
+        else
+        {
+            const auto lanes = aLhs < aRhs;
+            __builtin_memcpy(&mask, &lanes, sizeof(V));
+        }
+        aResult = (aRhs & mask) | (aLhs & ~mask);
+    }
+}
+
+template <op Op, typename T>
+using lane_t =
+    std::conditional_t<Op == op::min || Op == op::max || is_saturating_v<Op>,
+                       T, std::make_unsigned_t<T>>;
+
+template <std::size_t Bytes, op Op, bool Broadcast, typename StrongT>
+STRONG_TYPE_SIMD_INLINE void transform_body(const StrongT* aLhs,
+                                            const StrongT* aRhs,
+                                            const StrongT* aScalar,
+                                            StrongT* aOut,
+                                            std::size_t aCount) noexcept
+{
+    using T = underlying_type<StrongT>;
+    using E = lane_t<Op, T>;
+    using V = vector_t<E, Bytes>;
+    constexpr std::size_t kLanes = Bytes / sizeof(T);
+
+    V rhs{};
+    if constexpr (Broadcast)
+    {
+        rhs = rhs + static_cast<E>(aScalar->get());
+    }
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        V lhs;
+        __builtin_memcpy(&lhs, aLhs + i, Bytes);
+        if constexpr (!Broadcast)
+        {
+            __builtin_memcpy(&rhs, aRhs + i, Bytes);
+        }
+        V result;
+        apply_vector<Op>(lhs, rhs, result);
+        __builtin_memcpy(static_cast<void*>(aOut + i), &result, Bytes);
+    }
+    for (; i < aCount; ++i)
+    {
+        const StrongT& rhsValue = Broadcast ? *aScalar : aRhs[i];
+        aOut[i] = StrongT(apply<Op>(aLhs[i].get(), rhsValue.get()));
+    }
+}
+
+template <std::size_t Bytes, bool Left, typename StrongT>
+STRONG_TYPE_SIMD_INLINE void shift_body(const StrongT* aIn, unsigned aCount,
+                                        StrongT* aOut,
+                                        std::size_t aSize) noexcept
+{
+    using T = underlying_type<StrongT>;
+    using E = std::conditional_t<Left, std::make_unsigned_t<T>, T>;
+    using V = vector_t<E, Bytes>;
+    constexpr std::size_t kLanes = Bytes / sizeof(T);
+
+    std::size_t i = 0;
+    for (; i + kLanes <= aSize; i += kLanes)
+    {
+        V value;
+        __builtin_memcpy(&value, aIn + i, Bytes);
+        if constexpr (Left)
+        {
+            value = value << aCount;
+        }
+        else
+        {
+            value = value >> aCount;
+        }
+        __builtin_memcpy(static_cast<void*>(aOut + i), &value, Bytes);
+    }
+    for (; i < aSize; ++i)
+    {
+        aOut[i] = StrongT(shift<Left>(aIn[i].get(), aCount));
+    }
+}
+
+template <std::size_t Bytes, reduction R, typename StrongT>
+STRONG_TYPE_SIMD_INLINE void reduce_body(const StrongT* aIn, std::size_t aCount,
+                                         StrongT& aResult) noexcept
+{
+    using T = underlying_type<StrongT>;
+    constexpr op kOp = R == reduction::sum   ? op::add
+                       : R == reduction::min ? op::min
+                                             : op::max;
+    using E = lane_t<kOp, T>;
+    using V = vector_t<E, Bytes>;
+    constexpr std::size_t kLanes = Bytes / sizeof(T);
+
+    if (aCount < 2 * kLanes)
+    {
+        aResult = reduce_scalar<R>(aIn, aCount);
+        return;
+    }
+    // Two independent accumulators hide latency of the combining operation.
+    V acc0;
+    V acc1;
+    __builtin_memcpy(&acc0, aIn, Bytes);
+    __builtin_memcpy(&acc1, aIn + kLanes, Bytes);
+    std::size_t i = 2 * kLanes;
+    for (; i + 2 * kLanes <= aCount; i += 2 * kLanes)
+    {
+        V value0;
+        V value1;
+        __builtin_memcpy(&value0, aIn + i, Bytes);
+        __builtin_memcpy(&value1, aIn + i + kLanes, Bytes);
+        apply_vector<kOp>(acc0, value0, acc0);
+        apply_vector<kOp>(acc1, value1, acc1);
+    }
+    apply_vector<kOp>(acc0, acc1, acc0);
+
+    E lanes[kLanes];
+    __builtin_memcpy(lanes, &acc0, Bytes);
+    T result = static_cast<T>(lanes[0]);
+    for (std::size_t lane = 1; lane < kLanes; ++lane)
+    {
+        result = combine<R>(result, static_cast<T>(lanes[lane]));
+    }
+    for (; i < aCount; ++i)
+    {
+        result = combine<R>(result, aIn[i].get());
+    }
+    aResult = StrongT(result);
+}
+
+// 8- and 16-bit lanes have dedicated saturating instructions (padds, paddus,
+// psubs and psubus). Intrinsics compile only inside functions built for
+// their instruction set, so every target has its own kernel.
+template <typename T>
+inline constexpr bool has_saturating_instructions_v =
+    is_vectorizable_v<T> && sizeof(T) <= 2;
+
+template <op Op, typename T>
+STRONG_TYPE_SIMD_INLINE __m128i saturate_lanes_sse2(__m128i aLhs,
+                                                    __m128i aRhs) noexcept
+{
+    constexpr bool kAdd = Op == op::saturating_add;
+    if constexpr (sizeof(T) == 1 && std::is_signed_v<T>)
+    {
+        return kAdd ? _mm_adds_epi8(aLhs, aRhs)
+                    : _mm_subs_epi8(aLhs, aRhs);
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        return kAdd ? _mm_adds_epu8(aLhs, aRhs)
+                    : _mm_subs_epu8(aLhs, aRhs);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return kAdd ? _mm_adds_epi16(aLhs, aRhs)
+                    : _mm_subs_epi16(aLhs, aRhs);
+    }
+    else
+    {
+        return kAdd ? _mm_adds_epu16(aLhs, aRhs)
+                    : _mm_subs_epu16(aLhs, aRhs);
+    }
+}
+
+template <op Op, bool Broadcast, typename StrongT>
+void saturate_sse2(const StrongT* aLhs, const StrongT* aRhs,
+                   const StrongT* aScalar, StrongT* aOut,
+                   std::size_t aCount) noexcept
+{
+    using T = underlying_type<StrongT>;
+    constexpr std::size_t kLanes = sizeof(__m128i) / sizeof(T);
+
+    __m128i rhs = _mm_setzero_si128();
+    if constexpr (Broadcast && sizeof(T) == 1)
+    {
+        rhs = _mm_set1_epi8(static_cast<char>(aScalar->get()));
+    }
+    else if constexpr (Broadcast)
+    {
+        rhs = _mm_set1_epi16(static_cast<short>(aScalar->get()));
+    }
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        const __m128i lhs =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(aLhs + i));
+        if constexpr (!Broadcast)
+        {
+            rhs = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(aRhs + i));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(aOut + i),
+                         saturate_lanes_sse2<Op, T>(lhs, rhs));
+    }
+    for (; i < aCount; ++i)
+    {
+        const StrongT& rhsValue = Broadcast ? *aScalar : aRhs[i];
+        aOut[i] = StrongT(apply<Op>(aLhs[i].get(), rhsValue.get()));
+    }
+}
+
+template <op Op, typename T>
+STRONG_TYPE_TARGET("avx2")
+STRONG_TYPE_SIMD_INLINE __m256i saturate_lanes_avx2(__m256i aLhs,
+                                                    __m256i aRhs) noexcept
+{
+    constexpr bool kAdd = Op == op::saturating_add;
+    if constexpr (sizeof(T) == 1 && std::is_signed_v<T>)
+    {
+        return kAdd ? _mm256_adds_epi8(aLhs, aRhs)
+                    : _mm256_subs_epi8(aLhs, aRhs);
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        return kAdd ? _mm256_adds_epu8(aLhs, aRhs)
+                    : _mm256_subs_epu8(aLhs, aRhs);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return kAdd ? _mm256_adds_epi16(aLhs, aRhs)
+                    : _mm256_subs_epi16(aLhs, aRhs);
+    }
+    else
+    {
+        return kAdd ? _mm256_adds_epu16(aLhs, aRhs)
+                    : _mm256_subs_epu16(aLhs, aRhs);
+    }
+}
+
+template <op Op, bool Broadcast, typename StrongT>
+STRONG_TYPE_TARGET("avx2")
+void saturate_avx2(const StrongT* aLhs, const StrongT* aRhs,
+                   const StrongT* aScalar, StrongT* aOut,
+                   std::size_t aCount) noexcept
+{
+    using T = underlying_type<StrongT>;
+    constexpr std::size_t kLanes = sizeof(__m256i) / sizeof(T);
+
+    __m256i rhs = _mm256_setzero_si256();
+    if constexpr (Broadcast && sizeof(T) == 1)
+    {
+        rhs = _mm256_set1_epi8(static_cast<char>(aScalar->get()));
+    }
+    else if constexpr (Broadcast)
+    {
+        rhs = _mm256_set1_epi16(static_cast<short>(aScalar->get()));
+    }
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        const __m256i lhs =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aLhs + i));
+        if constexpr (!Broadcast)
+        {
+            rhs = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(aRhs + i));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(aOut + i),
+                            saturate_lanes_avx2<Op, T>(lhs, rhs));
+    }
+    for (; i < aCount; ++i)
+    {
+        const StrongT& rhsValue = Broadcast ? *aScalar : aRhs[i];
+        aOut[i] = StrongT(apply<Op>(aLhs[i].get(), rhsValue.get()));
+    }
+}
+
+template <op Op, typename T>
+STRONG_TYPE_TARGET("avx512f,avx512bw")
+STRONG_TYPE_SIMD_INLINE __m512i saturate_lanes_avx512(__m512i aLhs,
+                                                      __m512i aRhs) noexcept
+{
+    constexpr bool kAdd = Op == op::saturating_add;
+    if constexpr (sizeof(T) == 1 && std::is_signed_v<T>)
+    {
+        return kAdd ? _mm512_adds_epi8(aLhs, aRhs)
+                    : _mm512_subs_epi8(aLhs, aRhs);
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        return kAdd ? _mm512_adds_epu8(aLhs, aRhs)
+                    : _mm512_subs_epu8(aLhs, aRhs);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return kAdd ? _mm512_adds_epi16(aLhs, aRhs)
+                    : _mm512_subs_epi16(aLhs, aRhs);
+    }
+    else
+    {
+        return kAdd ? _mm512_adds_epu16(aLhs, aRhs)
+                    : _mm512_subs_epu16(aLhs, aRhs);
+    }
+}
+
+template <op Op, bool Broadcast, typename StrongT>
+STRONG_TYPE_TARGET("avx512f,avx512bw")
+void saturate_avx512(const StrongT* aLhs, const StrongT* aRhs,
+                     const StrongT* aScalar, StrongT* aOut,
+                     std::size_t aCount) noexcept
+{
+    using T = underlying_type<StrongT>;
+    constexpr std::size_t kLanes = sizeof(__m512i) / sizeof(T);
+
+    __m512i rhs = _mm512_setzero_si512();
+    if constexpr (Broadcast && sizeof(T) == 1)
+    {
+        rhs = _mm512_set1_epi8(static_cast<char>(aScalar->get()));
+    }
+    else if constexpr (Broadcast)
+    {
+        rhs = _mm512_set1_epi16(static_cast<short>(aScalar->get()));
+    }
+    std::size_t i = 0;
+    for (; i + kLanes <= aCount; i += kLanes)
+    {
+        const __m512i lhs =
+            _mm512_loadu_si512(reinterpret_cast<const __m512i*>(aLhs + i));
+        if constexpr (!Broadcast)
+        {
+            rhs = _mm512_loadu_si512(
+                reinterpret_cast<const __m512i*>(aRhs + i));
+        }
+        _mm512_storeu_si512(reinterpret_cast<__m512i*>(aOut + i),
+                            saturate_lanes_avx512<Op, T>(lhs, rhs));
+    }
+    for (; i < aCount; ++i)
+    {
+        const StrongT& rhsValue = Broadcast ? *aScalar : aRhs[i];
+        aOut[i] = StrongT(apply<Op>(aLhs[i].get(), rhsValue.get()));
+    }
+}
+
+// Entry points compiled for every instruction set. SSE2 is the baseline of
+// x86-64 and needs no target attribute.
+template <op Op, bool Broadcast, typename StrongT>
+void transform_sse2(const StrongT* aLhs, const StrongT* aRhs,
+                    const StrongT* aScalar, StrongT* aOut,
+                    std::size_t aCount) noexcept
+{
+    if constexpr (is_saturating_v<Op> &&
+                  has_saturating_instructions_v<underlying_type<StrongT>>)
+    {
+        saturate_sse2<Op, Broadcast>(aLhs, aRhs, aScalar, aOut, aCount);
+    }
+    else
+    {
+        transform_body<16, Op, Broadcast>(aLhs, aRhs, aScalar, aOut,
+                                           aCount);
+    }
+}
+
+template <op Op, bool Broadcast, typename StrongT>
+STRONG_TYPE_TARGET("avx2")
+void transform_avx2(const StrongT* aLhs, const StrongT* aRhs,
+                    const StrongT* aScalar, StrongT* aOut,
+                    std::size_t aCount) noexcept
+{
+    if constexpr (is_saturating_v<Op> &&
+                  has_saturating_instructions_v<underlying_type<StrongT>>)
+    {
+        saturate_avx2<Op, Broadcast>(aLhs, aRhs, aScalar, aOut, aCount);
+    }
+    else
+    {
+        transform_body<32, Op, Broadcast>(aLhs, aRhs, aScalar, aOut,
+                                           aCount);
+    }
+}
+
+template <op Op, bool Broadcast, typename StrongT>
+STRONG_TYPE_TARGET("avx512f,avx512bw")
+void transform_avx512(const StrongT* aLhs, const StrongT* aRhs,
+                      const StrongT* aScalar, StrongT* aOut,
+                      std::size_t aCount) noexcept
+{
+    if constexpr (is_saturating_v<Op> &&
+                  has_saturating_instructions_v<underlying_type<StrongT>>)
+    {
+        saturate_avx512<Op, Broadcast>(aLhs, aRhs, aScalar, aOut, aCount);
+    }
+    else
+    {
+        transform_body<64, Op, Broadcast>(aLhs, aRhs, aScalar, aOut,
+                                           aCount);
+    }
+}
+
+template <bool Left, typename StrongT>
+void shift_sse2(const StrongT* aIn, unsigned aCount, StrongT* aOut,
+                std::size_t aSize) noexcept
+{
+    shift_body<16, Left>(aIn, aCount, aOut, aSize);
+}
+
+template <bool Left, typename StrongT>
+STRONG_TYPE_TARGET("avx2")
+void shift_avx2(const StrongT* aIn, unsigned aCount, StrongT* aOut,
+                std::size_t aSize) noexcept
+{
+    shift_body<32, Left>(aIn, aCount, aOut, aSize);
+}
+
+template <bool Left, typename StrongT>
+STRONG_TYPE_TARGET("avx512f,avx512bw")
+void shift_avx512(const StrongT* aIn, unsigned aCount, StrongT* aOut,
+                  std::size_t aSize) noexcept
+{
+    shift_body<64, Left>(aIn, aCount, aOut, aSize);
+}
+
+template <reduction R, typename StrongT>
+void reduce_sse2(const StrongT* aIn, std::size_t aCount,
+                 StrongT& aResult) noexcept
+{
+    reduce_body<16, R>(aIn, aCount, aResult);
+}
+
+template <reduction R, typename StrongT>
+STRONG_TYPE_TARGET("avx2")
+void reduce_avx2(const StrongT* aIn, std::size_t aCount,
+                 StrongT& aResult) noexcept
+{
+    reduce_body<32, R>(aIn, aCount, aResult);
+}
+
+template <reduction R, typename StrongT>
+STRONG_TYPE_TARGET("avx512f,avx512bw")
+void reduce_avx512(const StrongT* aIn, std::size_t aCount,
+                   StrongT& aResult) noexcept
+{
+    reduce_body<64, R>(aIn, aCount, aResult);
+}
+#endif
+
+inline target clamp(target aTarget) noexcept
+{
+    return is_supported(aTarget) ? aTarget : best_target();
+}
+
+template <op Op, bool Broadcast, typename StrongT>
+void dispatch_transform(const StrongT* aLhs, const StrongT* aRhs,
+                        const StrongT* aScalar, StrongT* aOut,
+                        std::size_t aCount, target aTarget) noexcept
+{
+    static_assert(is_op_enabled_v<Op, StrongT>,
+                  "StrongT does not have mixin required by the operation.");
+#if STRONG_TYPE_SIMD_X86
+    if constexpr (is_vectorizable_v<underlying_type<StrongT>>)
+    {
+        switch (clamp(aTarget))
+        {
+            case target::avx512:
+                return transform_avx512<Op, Broadcast>(aLhs, aRhs, aScalar,
+                                                       aOut, aCount);
+            case target::avx2:
+                return transform_avx2<Op, Broadcast>(aLhs, aRhs, aScalar,
+                                                     aOut, aCount);
+            case target::sse2:
+                return transform_sse2<Op, Broadcast>(aLhs, aRhs, aScalar,
+                                                     aOut, aCount);
+            default:
+                break;
+        }
+    }
+#endif
+    (void)aTarget;
+    transform_scalar<Op, Broadcast>(aLhs, aRhs, aScalar, aOut, aCount);
+}
+
+template <bool Left, typename StrongT>
+void dispatch_shift(const StrongT* aIn, unsigned aCount, StrongT* aOut,
+                    std::size_t aSize, target aTarget) noexcept
+{
+    static_assert(Left ? has_op_v<StrongT, bitwise_left_shift>
+                       : has_op_v<StrongT, bitwise_right_shift>,
+                  "StrongT does not have mixin required by the operation.");
+    static_assert(std::is_integral_v<underlying_type<StrongT>>,
+                  "Shifts require integral underlying type.");
+    assert(aCount < 8 * sizeof(underlying_type<StrongT>) &&
+           "Shift count must be less than width of the type.");
+#if STRONG_TYPE_SIMD_X86
+    if constexpr (is_vectorizable_v<underlying_type<StrongT>>)
+    {
+        switch (clamp(aTarget))
+        {
+            case target::avx512:
+                return shift_avx512<Left>(aIn, aCount, aOut, aSize);
+            case target::avx2:
+                return shift_avx2<Left>(aIn, aCount, aOut, aSize);
+            case target::sse2:
+                return shift_sse2<Left>(aIn, aCount, aOut, aSize);
+            default:
+                break;
+        }
+    }
+#endif
+    (void)aTarget;
+    shift_scalar<Left>(aIn, aCount, aOut, aSize);
+}
+}  // namespace details
+
+// Element-wise aOut[i] = aLhs[i] <Op> aRhs[i]. Ranges are anything
+// convertible to strong::span of the same strong type: spans, vectors,
+// arrays. aOut may be the same range as aLhs or aRhs.
+template <op Op, typename LhsRange, typename RhsRange, typename OutRange>
+std::enable_if_t<!is_strong_v<RhsRange>> transform(
+    const LhsRange& aLhs, const RhsRange& aRhs, OutRange&& aOut,
+    target aTarget = best_target()) noexcept
+{
+    using StrongT = details::range_value_t<OutRange>;
+    const span<const StrongT> lhs(aLhs);
+    const span<const StrongT> rhs(aRhs);
+    const span<StrongT> out(aOut);
+    assert(lhs.size() == out.size() && rhs.size() == out.size() &&
+           "Ranges must have the same size.");
+    details::dispatch_transform<Op, false, StrongT>(
+        lhs.data(), rhs.data(), nullptr, out.data(), out.size(), aTarget);
+}
+
+// Element-wise aOut[i] = aLhs[i] <Op> aRhs.
+template <op Op, typename LhsRange, typename StrongT, typename OutRange>
+std::enable_if_t<is_strong_v<StrongT>> transform(
+    const LhsRange& aLhs, const StrongT& aRhs, OutRange&& aOut,
+    target aTarget = best_target()) noexcept
+{
+    static_assert(std::is_same_v<StrongT, details::range_value_t<OutRange>>,
+                  "Scalar operand must have the type of range elements.");
+    const span<const StrongT> lhs(aLhs);
+    const span<StrongT> out(aOut);
+    assert(lhs.size() == out.size() && "Ranges must have the same size.");
+    details::dispatch_transform<Op, true, StrongT>(
+        lhs.data(), nullptr, &aRhs, out.data(), out.size(), aTarget);
+}
+
+// Element-wise aOut[i] = aIn[i] << aCount.
+template <typename InRange, typename OutRange>
+void shift_left(const InRange& aIn, unsigned aCount, OutRange&& aOut,
+                target aTarget = best_target()) noexcept
+{
+    using StrongT = details::range_value_t<OutRange>;
+    const span<const StrongT> in(aIn);
+    const span<StrongT> out(aOut);
+    assert(in.size() == out.size() && "Ranges must have the same size.");
+    details::dispatch_shift<true>(in.data(), aCount, out.data(), out.size(),
+                                  aTarget);
+}
+
+// Element-wise aOut[i] = aIn[i] >> aCount. Shift is arithmetic for signed
+// underlying types.
+template <typename InRange, typename OutRange>
+void shift_right(const InRange& aIn, unsigned aCount, OutRange&& aOut,
+                 target aTarget = best_target()) noexcept
+{
+    using StrongT = details::range_value_t<OutRange>;
+    const span<const StrongT> in(aIn);
+    const span<StrongT> out(aOut);
+    assert(in.size() == out.size() && "Ranges must have the same size.");
+    details::dispatch_shift<false>(in.data(), aCount, out.data(), out.size(),
+                                   aTarget);
+}
+
+// Sum, minimum or maximum of all elements. Sum of an empty range is zero,
+// minimum and maximum require non-empty range.
+template <reduction R, typename Range>
+details::range_value_t<const Range> reduce(
+    const Range& aIn, target aTarget = best_target()) noexcept
+{
+    using StrongT = details::range_value_t<const Range>;
+    static_assert(details::is_reduction_enabled_v<R, StrongT>,
+                  "StrongT does not have mixin required by the reduction.");
+    const span<const StrongT> in(aIn);
+    assert((R == reduction::sum || !in.empty()) &&
+           "Minimum and maximum of empty range are undefined.");
+#if STRONG_TYPE_SIMD_X86
+    if constexpr (details::is_vectorizable_v<underlying_type<StrongT>>)
+    {
+        StrongT result;
+        switch (details::clamp(aTarget))
+        {
+            case target::avx512:
+                details::reduce_avx512<R>(in.data(), in.size(), result);
+                return result;
+            case target::avx2:
+                details::reduce_avx2<R>(in.data(), in.size(), result);
+                return result;
+            case target::sse2:
+                details::reduce_sse2<R>(in.data(), in.size(), result);
+                return result;
+            default:
+                break;
+        }
+    }
+#endif
+    (void)aTarget;
+    return details::reduce_scalar<R>(in.data(), in.size());
+}
+}  // namespace strong::simd
+
+#endif /* strong_type_simd_h */
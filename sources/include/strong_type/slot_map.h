@@ -0,0 +1,321 @@
+#ifndef strong_type_slot_map_h
+#define strong_type_slot_map_h
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "packed.h"
+#include "strong_type.h"
+
+namespace strong
+{
+// Number of low bits of HandleT that hold the slot index; the rest hold the
+// generation. Half of the handle by default, specialize to trade generations
+// for slots:
+//   template <>
+//   struct strong::slot_index_bits<EntityId>
+//       : std::integral_constant<unsigned, 24> {};
+template <typename HandleT>
+struct slot_index_bits
+    : std::integral_constant<
+          unsigned,
+          std::numeric_limits<underlying_type<HandleT>>::digits / 2>
+{
+};
+
+// Pool of values of type V addressed by handles of type HandleT, a strong type
+// over an unsigned integral type.
+//
+// Values live in a dense array, so iteration touches only live values.
+// Handles pack the index of a slot and its generation; a slot holds the
+// position of its value in the dense array and the generation of the handle
+// that may access it. Erase moves the last value into the hole, bumps the
+// generation of the slot and pushes it onto a free list threaded through the
+// slots, so insert, erase and lookup are O(1) and handles of erased values
+// are detected as stale. Generations of used slots are odd and of free slots
+// even, so no handle matches a free slot and HandleT{0} is never valid.
+// Generations wrap around after 2^(generation bits - 1) reuses of a slot.
+// Memory is only allocated when the arrays grow: call reserve() to avoid
+// that entirely.
+template <typename HandleT, typename V>
+class slot_map
+{
+    static_assert(is_strong_v<HandleT>, "Invalid HandleT.");
+    using U = underlying_type<HandleT>;
+    static_assert(std::is_unsigned_v<U> && !std::is_same_v<U, bool>,
+                  "HandleT must be a strong type over an unsigned type.");
+
+    static constexpr unsigned kIndexBits = slot_index_bits<HandleT>::value;
+    static constexpr unsigned kGenerationBits =
+        std::numeric_limits<U>::digits - kIndexBits;
+    static_assert(kIndexBits > 0 && kGenerationBits > 0,
+                  "Handle must have both index and generation bits.");
+
+    using index_t = strong_type<struct slot_index_tag, U>;
+    using generation_t = strong_type<struct slot_generation_tag, U>;
+    using handle_bits = packed<U, field<index_t, kIndexBits>,
+                               field<generation_t, kGenerationBits>>;
+
+    // Largest index is reserved for the end of the free list.
+    static constexpr U kNoSlot = details::low_mask_v<U, kIndexBits>;
+    static constexpr U kMaxGeneration = details::low_mask_v<U, kGenerationBits>;
+
+    struct slot
+    {
+        // Position in the dense array of a used slot, next free slot of a
+        // free one.
+        U position;
+        U generation;
+    };
+
+   public:
+    using handle_type = HandleT;
+    using value_type = V;
+    using size_type = std::size_t;
+    using iterator = V*;
+    using const_iterator = const V*;
+
+    slot_map() = default;
+
+    explicit slot_map(size_type aCount) { reserve(aCount); }
+
+    bool empty() const noexcept { return values_.empty(); }
+    size_type size() const noexcept { return values_.size(); }
+
+    // Largest number of values a slot_map with HandleT can hold.
+    static constexpr size_type max_size() noexcept
+    {
+        return static_cast<size_type>(kNoSlot);
+    }
+
+    // Throws std::length_error if aCount is above max_size().
+    void reserve(size_type aCount)
+    {
+        if (aCount > max_size())
+        {
+            throw std::length_error("strong::slot_map: too many values");
+        }
+        values_.reserve(aCount);
+        owners_.reserve(aCount);
+        slots_.reserve(aCount);
+    }
+
+    // Stores a value constructed from aArgs and returns its handle. Throws
+    // std::length_error if the map already holds max_size() values. If an
+    // exception is thrown, the map is unchanged.
+    template <typename... Args>
+    HandleT emplace(Args&&... aArgs)
+    {
+        const bool newSlot = free_head_ == kNoSlot;
+        if (newSlot && slots_.size() >= max_size())
+        {
+            throw std::length_error("strong::slot_map: too many values");
+        }
+        // Bookkeeping grows before the value is constructed and is updated
+        // only after that, when nothing can throw any more.
+        reserve_one_more(owners_);
+        if (newSlot)
+        {
+            reserve_one_more(slots_);
+        }
+        values_.emplace_back(std::forward<Args>(aArgs)...);
+
+        U index = free_head_;
+        if (newSlot)
+        {
+            index = static_cast<U>(slots_.size());
+            slots_.push_back(slot{0, 1});
+        }
+        else
+        {
+            free_head_ = slots_[index].position;
+            slots_[index].generation = next_generation(slots_[index]);
+        }
+        slot& used = slots_[index];
+        used.position = static_cast<U>(values_.size() - 1);
+        owners_.push_back(index);
+        return make_handle(index, used.generation);
+    }
+
+    HandleT insert(const V& aValue) { return emplace(aValue); }
+    HandleT insert(V&& aValue) { return emplace(std::move(aValue)); }
+
+    bool contains(const HandleT& aHandle) const noexcept
+    {
+        return find_slot(aHandle) != nullptr;
+    }
+
+    // Value of aHandle, nullptr if the handle is stale or invalid.
+    V* find(const HandleT& aHandle) noexcept
+    {
+        const slot* used = find_slot(aHandle);
+        return used == nullptr ? nullptr : &values_[used->position];
+    }
+
+    const V* find(const HandleT& aHandle) const noexcept
+    {
+        const slot* used = find_slot(aHandle);
+        return used == nullptr ? nullptr : &values_[used->position];
+    }
+
+    V& operator[](const HandleT& aHandle) noexcept
+    {
+        V* value = find(aHandle);
+        assert(value != nullptr && "Handle is stale or invalid.");
+        return *value;
+    }
+
+    const V& operator[](const HandleT& aHandle) const noexcept
+    {
+        const V* value = find(aHandle);
+        assert(value != nullptr && "Handle is stale or invalid.");
+        return *value;
+    }
+
+    // Destroys the value of aHandle. Returns false if the handle is stale or
+    // invalid.
+    bool erase(const HandleT& aHandle)
+    {
+        const slot* erased = find_slot(aHandle);
+        if (erased == nullptr)
+        {
+            return false;
+        }
+        const U position = erased->position;
+        const U index = owners_[position];
+        const U last = static_cast<U>(values_.size() - 1);
+        if (position != last)
+        {
+            values_[position] = std::move(values_[last]);
+            owners_[position] = owners_[last];
+            slots_[owners_[position]].position = position;
+        }
+        values_.pop_back();
+        owners_.pop_back();
+        release(index);
+        return true;
+    }
+
+    // Erases all values and invalidates all handles; slots are kept for
+    // reuse.
+    void clear() noexcept
+    {
+        for (const U index: owners_)
+        {
+            release(index);
+        }
+        values_.clear();
+        owners_.clear();
+    }
+
+    // Handle of the value at aPosition of the dense array.
+    HandleT handle_at(size_type aPosition) const noexcept
+    {
+        assert(aPosition < size() && "Position is out of range.");
+        const U index = owners_[aPosition];
+        return make_handle(index, slots_[index].generation);
+    }
+
+    // Calls aFunction(HandleT, V&) for every value in dense order.
+    template <typename F>
+    void for_each(F&& aFunction)
+    {
+        for (size_type i = 0; i < values_.size(); ++i)
+        {
+            aFunction(handle_at(i), values_[i]);
+        }
+    }
+
+    template <typename F>
+    void for_each(F&& aFunction) const
+    {
+        for (size_type i = 0; i < values_.size(); ++i)
+        {
+            aFunction(handle_at(i), values_[i]);
+        }
+    }
+
+    // Dense values in unspecified order, invalidated by insert and erase.
+    V* data() noexcept { return values_.data(); }
+    const V* data() const noexcept { return values_.data(); }
+
+    iterator begin() noexcept { return values_.data(); }
+    const_iterator begin() const noexcept { return values_.data(); }
+    iterator end() noexcept { return values_.data() + values_.size(); }
+    const_iterator end() const noexcept
+    {
+        return values_.data() + values_.size();
+    }
+
+   private:
+    static HandleT make_handle(U aIndex, U aGeneration) noexcept
+    {
+        return HandleT(handle_bits(index_t(aIndex), generation_t(aGeneration))
+                           .word());
+    }
+
+    // Makes sure that the next push_back into aVector does not allocate.
+    template <typename T>
+    static void reserve_one_more(std::vector<T>& aVector)
+    {
+        if (aVector.size() == aVector.capacity())
+        {
+            aVector.reserve(aVector.empty() ? 1 : 2 * aVector.size());
+        }
+    }
+
+    const slot* find_slot(const HandleT& aHandle) const noexcept
+    {
+        const auto bits = handle_bits::from_word(aHandle.get());
+        const U index = bits.template get<index_t>().get();
+        if (index >= slots_.size())
+        {
+            return nullptr;
+        }
+        const slot& used = slots_[index];
+        return used.generation == bits.template get<generation_t>().get()
+                   ? &used
+                   : nullptr;
+    }
+
+    static U next_generation(const slot& aSlot) noexcept
+    {
+        return static_cast<U>((aSlot.generation + 1u) & kMaxGeneration);
+    }
+
+    // Invalidates handles of slot aIndex and pushes it onto the free list.
+    void release(U aIndex) noexcept
+    {
+        slot& freed = slots_[aIndex];
+        freed.generation = next_generation(freed);
+        freed.position = free_head_;
+        free_head_ = aIndex;
+    }
+
+    std::vector<V> values_;
+    // owners_[i] is the slot of values_[i].
+    std::vector<U> owners_;
+    std::vector<slot> slots_;
+    U free_head_ = kNoSlot;
+};
+
+template <typename T>
+struct is_slot_map : std::false_type
+{
+};
+
+template <typename HandleT, typename V>
+struct is_slot_map<slot_map<HandleT, V>> : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool is_slot_map_v = is_slot_map<T>::value;
+}  // namespace strong
+
+#endif /* strong_type_slot_map_h */
@@ -0,0 +1,353 @@
+#ifndef strong_type_soa_vector_h
+#define strong_type_soa_vector_h
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "span.h"
+#include "strong_type.h"
+
+namespace strong
+{
+namespace details
+{
+template <typename Tag, typename... Fields>
+inline constexpr std::size_t count_of_tag_v =
+    (std::size_t{0} + ... +
+     std::size_t{std::is_same_v<Tag, tag_type<Fields>>});
+
+// Position of the field with Tag among Fields.
+template <typename Tag, typename Field, typename... Fields>
+constexpr std::size_t position_of_tag() noexcept
+{
+    if constexpr (std::is_same_v<Tag, tag_type<Field>>)
+    {
+        return 0;
+    }
+    else
+    {
+        static_assert(sizeof...(Fields) > 0, "No field has this Tag.");
+        return 1 + position_of_tag<Tag, Fields...>();
+    }
+}
+}  // namespace details
+
+// Struct of arrays: one contiguous column per field, where Fields are
+// strong types and their Tags name the columns. Scans that read one or two
+// fields of many rows touch only those columns, and col<Tag>() is a span
+// that can be passed to the bulk algorithms of strong::simd:
+//
+// using events = strong::soa_vector<EventId, Timestamp, Size>;
+// events table;
+// table.push_back(EventId{1}, Timestamp{100}, Size{42});
+// const Size total = strong::simd::reduce<strong::simd::reduction::sum>(
+//     table.col<SizeTag>());
+//
+// Rows are reached through proxies: table[i].get<TimestampTag>() is a
+// reference into the Timestamp column. All columns always have the same
+// length: if push_back or resize throws, the container is unchanged.
+template <typename... Fields>
+class soa_vector
+{
+    static_assert(sizeof...(Fields) > 0, "soa_vector needs fields.");
+    static_assert((is_strong_v<Fields> && ...),
+                  "Fields must be strong types.");
+    static_assert(
+        ((details::count_of_tag_v<tag_type<Fields>, Fields...> == 1) && ...),
+        "Tags of fields must be distinct.");
+
+    template <typename Tag>
+    static constexpr std::size_t kColumn =
+        details::position_of_tag<Tag, Fields...>();
+
+   public:
+    using value_type = std::tuple<Fields...>;
+    using size_type = std::size_t;
+
+    template <typename Tag>
+    using field_type = std::tuple_element_t<kColumn<Tag>, value_type>;
+
+    // Proxy of row aRow: get<Tag>() refers to the field in its column.
+    // Const is the constness of the container, like for iterators.
+    template <bool Const>
+    class basic_row
+    {
+        using owner_type =
+            std::conditional_t<Const, const soa_vector, soa_vector>;
+
+       public:
+        basic_row(owner_type& aOwner, size_type aRow) noexcept
+            : owner_(&aOwner), row_(aRow)
+        {
+        }
+
+        basic_row(const basic_row&) noexcept = default;
+
+        // Conversion of a mutable row to a read-only one.
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_row(const basic_row<false>& aRow) noexcept
+            : owner_(aRow.owner_), row_(aRow.row_)
+        {
+        }
+
+        template <typename Tag>
+        auto& get() const noexcept
+        {
+            return std::get<kColumn<Tag>>(owner_->columns_)[row_];
+        }
+
+        size_type index() const noexcept { return row_; }
+
+        operator value_type() const
+        {
+            return value_type(get<tag_type<Fields>>()...);
+        }
+
+        // Assigns all fields of the row, e.g. table[i] = table[j].
+        template <bool C = Const, typename = std::enable_if_t<!C>>
+        const basic_row& operator=(const value_type& aValue) const
+        {
+            ((get<tag_type<Fields>>() = std::get<Fields>(aValue)), ...);
+            return *this;
+        }
+
+        const basic_row& operator=(const basic_row& aOther) const
+        {
+            static_assert(!Const, "Rows of const soa_vector are read-only.");
+            return *this = static_cast<value_type>(aOther);
+        }
+
+       private:
+        friend class basic_row<true>;
+
+        owner_type* owner_;
+        size_type row_;
+    };
+
+    using reference = basic_row<false>;
+    using const_reference = basic_row<true>;
+
+    template <bool Const>
+    class basic_iterator
+    {
+        using owner_type =
+            std::conditional_t<Const, const soa_vector, soa_vector>;
+
+       public:
+        using value_type = soa_vector::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = basic_row<Const>;
+        using pointer = void;
+        using iterator_category = std::input_iterator_tag;
+
+        basic_iterator(owner_type& aOwner, size_type aRow) noexcept
+            : owner_(&aOwner), row_(aRow)
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            return reference(*owner_, row_);
+        }
+
+        basic_iterator& operator++() noexcept
+        {
+            ++row_;
+            return *this;
+        }
+
+        bool operator==(const basic_iterator& aOther) const noexcept
+        {
+            return row_ == aOther.row_;
+        }
+
+        bool operator!=(const basic_iterator& aOther) const noexcept
+        {
+            return row_ != aOther.row_;
+        }
+
+       private:
+        owner_type* owner_;
+        size_type row_;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    soa_vector() = default;
+
+    size_type size() const noexcept { return std::get<0>(columns_).size(); }
+    bool empty() const noexcept { return size() == 0; }
+
+    void reserve(size_type aCapacity)
+    {
+        std::apply([aCapacity](auto&... aColumns)
+                   { (aColumns.reserve(aCapacity), ...); },
+                   columns_);
+    }
+
+    // Appends value-initialized rows or drops the last ones. Columns are
+    // grown one by one: if one throws, the grown ones are cut back.
+    void resize(size_type aSize)
+    {
+        const size_type oldSize = size();
+        if (aSize <= oldSize)
+        {
+            std::apply([aSize](auto&... aColumns)
+                       { (aColumns.resize(aSize), ...); },
+                       columns_);
+            return;
+        }
+        reserve(aSize);
+        std::apply(
+            [aSize, oldSize](auto&... aColumns)
+            {
+                std::size_t grown = 0;
+                try
+                {
+                    ((aColumns.resize(aSize), ++grown), ...);
+                }
+                catch (...)
+                {
+                    std::size_t column = 0;
+                    ((column++ < grown ? aColumns.resize(oldSize) : void()),
+                     ...);
+                    throw;
+                }
+            },
+            columns_);
+    }
+
+    void clear() noexcept
+    {
+        std::apply([](auto&... aColumns) { (aColumns.clear(), ...); },
+                   columns_);
+    }
+
+    reference push_back(const Fields&... aFields)
+    {
+        push_back_impl(std::index_sequence_for<Fields...>{}, aFields...);
+        return back();
+    }
+
+    reference push_back(const value_type& aValue)
+    {
+        return std::apply([this](const Fields&... aFields)
+                          { return push_back(aFields...); },
+                          aValue);
+    }
+
+    void pop_back() noexcept
+    {
+        assert(!empty() && "soa_vector is empty.");
+        std::apply([](auto&... aColumns) { (aColumns.pop_back(), ...); },
+                   columns_);
+    }
+
+    // Removes row aRow by moving the last row into its place: O(1), but
+    // the order of rows changes.
+    void swap_remove(size_type aRow) noexcept
+    {
+        assert(aRow < size() && "Row is out of range.");
+        std::apply(
+            [aRow](auto&... aColumns)
+            {
+                ((aColumns[aRow] = std::move(aColumns.back()),
+                  aColumns.pop_back()),
+                 ...);
+            },
+            columns_);
+    }
+
+    // Contiguous column of the field with Tag.
+    template <typename Tag>
+    span<field_type<Tag>> col() noexcept
+    {
+        return span<field_type<Tag>>(std::get<kColumn<Tag>>(columns_));
+    }
+
+    template <typename Tag>
+    span<const field_type<Tag>> col() const noexcept
+    {
+        return span<const field_type<Tag>>(
+            std::get<kColumn<Tag>>(columns_));
+    }
+
+    reference operator[](size_type aRow) noexcept
+    {
+        assert(aRow < size() && "Row is out of range.");
+        return reference(*this, aRow);
+    }
+
+    const_reference operator[](size_type aRow) const noexcept
+    {
+        assert(aRow < size() && "Row is out of range.");
+        return const_reference(*this, aRow);
+    }
+
+    reference back() noexcept { return (*this)[size() - 1]; }
+    const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+    iterator begin() noexcept { return iterator(*this, 0); }
+    iterator end() noexcept { return iterator(*this, size()); }
+    const_iterator begin() const noexcept { return const_iterator(*this, 0); }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(*this, size());
+    }
+
+   private:
+    // Columns get room for the row before any of them grows, so only
+    // copies of fields can throw; the columns they were appended to are
+    // cut back then.
+    template <std::size_t... Columns>
+    void push_back_impl(std::index_sequence<Columns...>,
+                        const Fields&... aFields)
+    {
+        (reserve_one_more(std::get<Columns>(columns_)), ...);
+        std::size_t pushed = 0;
+        try
+        {
+            ((std::get<Columns>(columns_).push_back(aFields), ++pushed), ...);
+        }
+        catch (...)
+        {
+            ((Columns < pushed ? std::get<Columns>(columns_).pop_back()
+                               : void()),
+             ...);
+            throw;
+        }
+    }
+
+    template <typename T>
+    static void reserve_one_more(std::vector<T>& aColumn)
+    {
+        if (aColumn.size() == aColumn.capacity())
+        {
+            aColumn.reserve(aColumn.empty() ? 1 : 2 * aColumn.size());
+        }
+    }
+
+    std::tuple<std::vector<Fields>...> columns_;
+};
+
+template <typename T>
+struct is_soa_vector : std::false_type
+{
+};
+
+template <typename... Fields>
+struct is_soa_vector<soa_vector<Fields...>> : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool is_soa_vector_v = is_soa_vector<T>::value;
+}  // namespace strong
+
+#endif /* strong_type_soa_vector_h */
@@ -0,0 +1,117 @@
+#ifndef strong_type_span_h
+#define strong_type_span_h
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace strong
+{
+// Non-owning view of a contiguous sequence, a subset of C++20 std::span
+// available in C++17. Bulk algorithms of the library take their ranges as
+// span.
+template <typename T>
+class span
+{
+   public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    constexpr span() noexcept = default;
+
+    constexpr span(T* aData, std::size_t aSize) noexcept
+        : data_(aData), size_(aSize)
+    {
+    }
+
+    template <std::size_t N>
+    constexpr span(T (&aArray)[N]) noexcept : data_(aArray), size_(N)
+    {
+    }
+
+    template <typename Container,
+              typename = std::enable_if_t<
+                  !std::is_array_v<Container> &&
+                  std::is_convertible_v<
+                      std::remove_pointer_t<decltype(
+                          std::declval<Container&>().data())> (*)[],
+                      T (*)[]> &&
+                  std::is_convertible_v<
+                      decltype(std::declval<Container&>().size()),
+                      std::size_t>>>
+    constexpr span(Container& aContainer) noexcept
+        : data_(aContainer.data()), size_(aContainer.size())
+    {
+    }
+
+    template <typename U, typename = std::enable_if_t<
+                              std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr span(const span<U>& aOther) noexcept
+        : data_(aOther.data()), size_(aOther.size())
+    {
+    }
+
+    constexpr T* data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr std::size_t size_bytes() const noexcept
+    {
+        return size_ * sizeof(T);
+    }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr iterator begin() const noexcept { return data_; }
+    constexpr iterator end() const noexcept { return data_ + size_; }
+
+    constexpr T& operator[](std::size_t aIndex) const noexcept
+    {
+        assert(aIndex < size_ && "Index is out of range.");
+        return data_[aIndex];
+    }
+
+    constexpr span first(std::size_t aCount) const noexcept
+    {
+        assert(aCount <= size_ && "Count is out of range.");
+        return {data_, aCount};
+    }
+
+    constexpr span last(std::size_t aCount) const noexcept
+    {
+        assert(aCount <= size_ && "Count is out of range.");
+        return {data_ + (size_ - aCount), aCount};
+    }
+
+    constexpr span subspan(std::size_t aOffset,
+                           std::size_t aCount) const noexcept
+    {
+        assert(aOffset <= size_ && aCount <= size_ - aOffset &&
+               "Subspan is out of range.");
+        return {data_ + aOffset, aCount};
+    }
+
+   private:
+    T* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+template <typename T, std::size_t N>
+span(T (&)[N]) -> span<T>;
+
+template <typename Container>
+span(Container&) -> span<std::remove_pointer_t<
+    decltype(std::declval<Container&>().data())>>;
+
+namespace details
+{
+// Element type of a range convertible to span.
+template <typename Range>
+using range_value_t = std::remove_cv_t<
+    std::remove_pointer_t<decltype(std::declval<Range&>().data())>>;
+}  // namespace details
+}  // namespace strong
+
+#endif /* strong_type_span_h */
@@ -1,34 +1,276 @@
 #ifndef strong_type_h
 #define strong_type_h
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
 #include <type_traits>
 #include <utility>
 
+// MSVC applies empty base optimization only to the first empty base unless
+// the class is marked with __declspec(empty_bases).
+#if defined(_MSC_VER)
+#define STRONG_TYPE_EMPTY_BASES __declspec(empty_bases)
+#else
+#define STRONG_TYPE_EMPTY_BASES
+#endif
+
+// Qualifier that promises the compiler a pointer is the only way to reach
+// its object.
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#define STRONG_TYPE_RESTRICT __restrict
+#else
+#define STRONG_TYPE_RESTRICT
+#endif
+
+// Whether the compiler takes assumptions without branching on them. GCC
+// before 13 has only if (!c) __builtin_unreachable(), and such branches
+// keep loops over values loaded from memory from being vectorized.
+#if defined(__clang__) || defined(_MSC_VER) || \
+    (defined(__GNUC__) && __GNUC__ >= 13)
+#define STRONG_TYPE_HAS_ASSUME 1
+#else
+#define STRONG_TYPE_HAS_ASSUME 0
+#endif
+
 namespace strong
 {
+template <typename Tag, typename T, T Min, T Max>
+struct bounded_tag;
+
+namespace details
+{
+// Tells the optimizer that aCondition holds, if STRONG_TYPE_HAS_ASSUME. The
+// behaviour is undefined if it does not.
+constexpr void assume([[maybe_unused]] bool aCondition) noexcept
+{
+#if defined(__clang__)
+    __builtin_assume(aCondition);
+#elif defined(_MSC_VER)
+    __assume(aCondition);
+#elif STRONG_TYPE_HAS_ASSUME
+    __attribute__((assume(aCondition)));
+#endif
+}
+
+// Selects the constructor of strong_type that does not check the bounds of
+// the tag, for code that has proven the value to be within them.
+struct unchecked_t
+{
+    explicit unchecked_t() = default;
+};
+
+inline constexpr unchecked_t unchecked{};
+
+// Whether Tag is a bounded_tag, the tag of bounded types (see bounded.h),
+// whose values are checked against its range.
+template <typename Tag>
+inline constexpr bool has_bounds_v = false;
+
+template <typename Tag, typename T, T Min, T Max>
+inline constexpr bool has_bounds_v<bounded_tag<Tag, T, Min, Max>> = true;
+
+template <typename Tag, typename T>
+constexpr bool in_bounds(const T& aValue) noexcept
+{
+    static_assert(std::is_integral_v<T>,
+                  "Bounds are supported for integral types only.");
+    static_assert(std::is_same_v<std::remove_cv_t<decltype(Tag::min)>, T> &&
+                      std::is_same_v<std::remove_cv_t<decltype(Tag::max)>, T>,
+                  "Bounds must have the underlying type.");
+    // Comparisons with the limits of T are skipped: they are always true
+    // and compilers warn about them.
+    bool result = true;
+    if constexpr (Tag::min != std::numeric_limits<T>::min())
+    {
+        result = result && !(aValue < Tag::min);
+    }
+    if constexpr (Tag::max != std::numeric_limits<T>::max())
+    {
+        result = result && !(Tag::max < aValue);
+    }
+    return result;
+}
+
+// Whether operation Op writes the value of a strong type in place (+=, ++,
+// <<= ...). Such writes are not checked against the bounds of bounded
+// types, so bounded types reject these operations.
+template <template <typename> typename Op>
+inline constexpr bool writes_in_place_v = false;
+
+// Class with the same bases and the same data member as strong_type, in
+// the same order. Unlike strong_type it is complete inside the body of
+// strong_type, which lets the class check its own layout.
+template <typename T, typename... Bases>
+struct STRONG_TYPE_EMPTY_BASES layout_model : Bases...
+{
+    T value_;
+};
+
+// Whether the value-initialized T is within the bounds of Tag, if any.
+template <typename Tag, typename T>
+constexpr bool default_in_bounds() noexcept
+{
+    if constexpr (has_bounds_v<Tag>)
+    {
+        return in_bounds<Tag>(T{});
+    }
+    else
+    {
+        return true;
+    }
+}
+
+// Empty base of strong_type whose default constructor is deleted if the
+// value-initialized T is out of bounds, which deletes the defaulted default
+// constructor of strong_type and otherwise leaves it trivial. The other
+// constructors of strong_type construct it from unchecked. It is a
+// template of Tag and T so that a strong type over another strong type
+// does not have two bases of one type, which would defeat the empty base
+// optimization.
+template <typename Tag, typename T, bool = default_in_bounds<Tag, T>()>
+struct default_constructor_guard
+{
+    default_constructor_guard() = default;
+    explicit constexpr default_constructor_guard(unchecked_t) noexcept {}
+};
+
+template <typename Tag, typename T>
+struct default_constructor_guard<Tag, T, false>
+{
+    default_constructor_guard() = delete;
+    explicit constexpr default_constructor_guard(unchecked_t) noexcept {}
+};
+
+// Construction of a bounded value outside of its bounds. Terminates the
+// program at run time and makes the expression ill-formed in constant
+// evaluation.
+[[noreturn]] inline void on_out_of_bounds() noexcept { std::abort(); }
+}  // namespace details
+
 template <typename Tag, typename T, template <typename> typename... Ops>
-class strong_type : public Ops<strong_type<Tag, T, Ops...>>...
+class STRONG_TYPE_EMPTY_BASES strong_type
+    : details::default_constructor_guard<Tag, T>,
+      public Ops<strong_type<Tag, T, Ops...>>...
 {
+    using default_guard = details::default_constructor_guard<Tag, T>;
+
    public:
     using value_type = T;
     strong_type() = default;
     explicit constexpr strong_type(T const& value) noexcept(
         std::is_nothrow_copy_constructible_v<T>)
-        : value_(value)
+        : default_guard(details::unchecked), value_(value)
     {
+        check_bounds();
     }
     explicit constexpr strong_type(T&& value) noexcept(
         std::is_nothrow_move_constructible_v<T>)
-        : value_(std::move(value))
+        : default_guard(details::unchecked), value_(std::move(value))
+    {
+        check_bounds();
+    }
+    // Skips the bounds check of bounded types, see details::unchecked_t.
+    template <typename U = T,
+              typename = std::enable_if_t<details::has_bounds_v<Tag> &&
+                                          std::is_same_v<U, T>>>
+    constexpr strong_type(details::unchecked_t, U const& value) noexcept(
+        std::is_nothrow_copy_constructible_v<T>)
+        : default_guard(details::unchecked), value_(value)
+    {
+    }
+    explicit constexpr operator T&() noexcept
     {
+        assume_bounds();
+        return value_;
+    }
+    explicit constexpr operator const T&() const noexcept
+    {
+        assume_bounds();
+        return value_;
     }
-    explicit constexpr operator T&() noexcept { return value_; }
-    explicit constexpr operator const T&() const noexcept { return value_; }
 
-    constexpr T& get() { return value_; }
-    constexpr T const& get() const { return value_; }
+    constexpr T& get()
+    {
+        assume_bounds();
+        return value_;
+    }
+    constexpr T const& get() const
+    {
+        assume_bounds();
+        return value_;
+    }
 
    private:
+    // If the tag is a bounded_tag, construction checks that the value is
+    // within them and reads pass them to the optimizer, which drops checks
+    // and branches they make redundant (with compilers that take
+    // assumptions without branching). Values written through get() must
+    // stay within the bounds too; debug builds assert it on every read.
+    constexpr void check_bounds() const noexcept
+    {
+        if constexpr (details::has_bounds_v<Tag>)
+        {
+            if (!details::in_bounds<Tag>(value_))
+            {
+                details::on_out_of_bounds();
+            }
+        }
+    }
+
+    constexpr void assume_bounds() const noexcept
+    {
+        if constexpr (details::has_bounds_v<Tag>)
+        {
+            assert(details::in_bounds<Tag>(value_) &&
+                   "Value is out of the bounds of its tag.");
+#if STRONG_TYPE_HAS_ASSUME
+            details::assume(details::in_bounds<Tag>(value_));
+#endif
+        }
+    }
+
+    // strong_type must be a drop-in replacement for T in arrays and in
+    // memcpy-based code: same size and alignment and the same triviality
+    // whatever set of operations is mixed in. strong_type is incomplete
+    // here, so the checks are made on a class with the same bases and
+    // member, which is instantiated together with strong_type.
+    using layout =
+        details::layout_model<T, default_guard, Ops<strong_type>...>;
+    static_assert((std::is_empty_v<Ops<strong_type>> && ...),
+                  "Operations must not have data members.");
+    static_assert(!details::has_bounds_v<Tag> ||
+                      !(details::writes_in_place_v<Ops> || ...),
+                  "Bounded types do not support in-place operations: their "
+                  "results would not be checked against the bounds.");
+    static_assert(sizeof(layout) == sizeof(T),
+                  "strong_type must have the same size as T.");
+    static_assert(alignof(layout) == alignof(T),
+                  "strong_type must have the same alignment as T.");
+    static_assert(std::is_trivially_copyable_v<layout> ==
+                      std::is_trivially_copyable_v<T>,
+                  "strong_type must be trivially copyable if T is.");
+    static_assert(std::is_trivially_copy_constructible_v<layout> ==
+                      std::is_trivially_copy_constructible_v<T>,
+                  "strong_type must be trivially copy constructible if T is.");
+    static_assert(std::is_trivially_move_constructible_v<layout> ==
+                      std::is_trivially_move_constructible_v<T>,
+                  "strong_type must be trivially move constructible if T is.");
+    static_assert(std::is_trivially_copy_assignable_v<layout> ==
+                      std::is_trivially_copy_assignable_v<T>,
+                  "strong_type must be trivially copy assignable if T is.");
+    static_assert(std::is_trivially_move_assignable_v<layout> ==
+                      std::is_trivially_move_assignable_v<T>,
+                  "strong_type must be trivially move assignable if T is.");
+    static_assert(std::is_trivially_destructible_v<layout> ==
+                      std::is_trivially_destructible_v<T>,
+                  "strong_type must be trivially destructible if T is.");
+    static_assert(std::is_standard_layout_v<layout> ==
+                      std::is_standard_layout_v<T>,
+                  "strong_type must have standard layout if T has.");
+
     T value_;
 };
 
@@ -38,6 +280,12 @@ T underlying_type_impl(strong_type<Tag, T, Ops...>);
 template <typename T>
 using underlying_type = decltype(underlying_type_impl(std::declval<T>()));
 
+template <typename Tag, typename T, template <typename> typename... Ops>
+Tag tag_type_impl(strong_type<Tag, T, Ops...>);
+
+template <typename T>
+using tag_type = decltype(tag_type_impl(std::declval<T>()));
+
 template <typename T>
 struct is_strong : std::false_type
 {
@@ -55,6 +303,14 @@ inline constexpr bool is_strong_v = is_strong<T>::value;
 template <typename T>
 using is_strong_t = typename is_strong<T>::type;
 
+template <typename StrongT, template <typename> typename Op>
+struct has_op : std::is_base_of<Op<StrongT>, StrongT>
+{
+};
+
+template <typename StrongT, template <typename> typename Op>
+inline constexpr bool has_op_v = has_op<StrongT, Op>::value;
+
 template <typename T>
 constexpr decltype(auto) getValue(T&& aValue) noexcept
 {
@@ -70,14 +326,328 @@ constexpr decltype(auto) getValue(T&& aValue) noexcept
 
 namespace details
 {
+// std::is_pointer that also accepts restrict-qualified pointers.
+template <typename T>
+struct is_pointer : std::is_pointer<T>
+{
+};
+
+template <typename T>
+struct is_pointer<T* STRONG_TYPE_RESTRICT> : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool is_pointer_v = is_pointer<T>::value;
+
+// Alignment of pointees that the tag of a strong pointer declares:
+//   struct BufferTag { static constexpr std::size_t alignment = 64; };
+// 0 if it declares none.
+template <typename Tag, typename = void>
+inline constexpr std::size_t pointee_alignment_v = 0;
+
+template <typename Tag>
+inline constexpr std::size_t
+    pointee_alignment_v<Tag, std::void_t<decltype(Tag::alignment)>> =
+        Tag::alignment;
+
+// Pointer held by StrongT for the pointer mixins. If the tag declares an
+// alignment, the compiler is told about it (and debug builds check it), so
+// loops over the pointer vectorize with aligned loads and without peeling.
+// Other underlying types (smart pointers, iterators) are returned as is.
+template <typename StrongT>
+constexpr decltype(auto) pointer_of(const StrongT& aValue) noexcept
+{
+    if constexpr (is_pointer_v<underlying_type<StrongT>>)
+    {
+        using pointer = std::remove_cv_t<decltype(&*aValue.get())>;
+        constexpr std::size_t kAlignment =
+            pointee_alignment_v<tag_type<StrongT>>;
+        if constexpr (kAlignment > 1)
+        {
+            static_assert((kAlignment & (kAlignment - 1)) == 0,
+                          "Alignment must be a power of two.");
+            assert(reinterpret_cast<std::uintptr_t>(aValue.get()) %
+                           kAlignment ==
+                       0 &&
+                   "Pointer is not aligned as its tag declares.");
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<pointer>(
+                __builtin_assume_aligned(aValue.get(), kAlignment));
+#else
+            return static_cast<pointer>(aValue.get());
+#endif
+        }
+        else
+        {
+            return static_cast<pointer>(aValue.get());
+        }
+    }
+    else
+    {
+        return aValue.get();
+    }
+}
+
 template <typename StrongT>
 inline constexpr StrongT advance(const StrongT& aLhs,
                                  std::ptrdiff_t aCount) noexcept
 {
     static_assert(strong::is_strong_v<StrongT>, "Invalid StrongT.");
     using value_type = strong::underlying_type<StrongT>;
-    static_assert(std::is_pointer_v<value_type>);
-    return StrongT(aLhs.get() + aCount);
+    static_assert(is_pointer_v<value_type>);
+    return StrongT(pointer_of(aLhs) + aCount);
+}
+
+// Integral arithmetic in the unsigned type at least as wide as unsigned int:
+// it wraps around instead of overflowing and is not subject to promotion to
+// signed int.
+template <typename T>
+using wrapping_t =
+    std::conditional_t<(sizeof(T) < sizeof(unsigned)), unsigned,
+                       std::make_unsigned_t<T>>;
+
+// Unsigned integer type of Size bytes.
+template <std::size_t Size>
+struct unsigned_of_size;
+
+template <>
+struct unsigned_of_size<1>
+{
+    using type = std::uint8_t;
+};
+
+template <>
+struct unsigned_of_size<2>
+{
+    using type = std::uint16_t;
+};
+
+template <>
+struct unsigned_of_size<4>
+{
+    using type = std::uint32_t;
+};
+
+template <>
+struct unsigned_of_size<8>
+{
+    using type = std::uint64_t;
+};
+
+template <std::size_t Size>
+using unsigned_of_size_t = typename unsigned_of_size<Size>::type;
+
+template <typename T>
+constexpr T wrapping_add(T aLhs, T aRhs) noexcept
+{
+    using W = wrapping_t<T>;
+    return static_cast<T>(
+        static_cast<W>(static_cast<W>(aLhs) + static_cast<W>(aRhs)));
+}
+
+template <typename T>
+constexpr T wrapping_sub(T aLhs, T aRhs) noexcept
+{
+    using W = wrapping_t<T>;
+    return static_cast<T>(
+        static_cast<W>(static_cast<W>(aLhs) - static_cast<W>(aRhs)));
+}
+
+template <typename T>
+constexpr T wrapping_mul(T aLhs, T aRhs) noexcept
+{
+    using W = wrapping_t<T>;
+    return static_cast<T>(
+        static_cast<W>(static_cast<W>(aLhs) * static_cast<W>(aRhs)));
+}
+
+// Overflow checks in plain C++ for compilers without overflow builtins. They
+// store wrapped result of the operation in aResult and return true if the
+// exact result does not fit in T.
+template <typename T>
+constexpr bool add_overflow_portable(T aLhs, T aRhs, T& aResult) noexcept
+{
+    aResult = wrapping_add(aLhs, aRhs);
+    if constexpr (std::is_signed_v<T>)
+    {
+        return aRhs > 0 ? aLhs > std::numeric_limits<T>::max() - aRhs
+                        : aLhs < std::numeric_limits<T>::min() - aRhs;
+    }
+    else
+    {
+        return aResult < aLhs;
+    }
+}
+
+template <typename T>
+constexpr bool sub_overflow_portable(T aLhs, T aRhs, T& aResult) noexcept
+{
+    aResult = wrapping_sub(aLhs, aRhs);
+    if constexpr (std::is_signed_v<T>)
+    {
+        return aRhs > 0 ? aLhs < std::numeric_limits<T>::min() + aRhs
+                        : aLhs > std::numeric_limits<T>::max() + aRhs;
+    }
+    else
+    {
+        return aLhs < aRhs;
+    }
+}
+
+template <typename T>
+constexpr bool mul_overflow_portable(T aLhs, T aRhs, T& aResult) noexcept
+{
+    aResult = wrapping_mul(aLhs, aRhs);
+    constexpr T kMax = std::numeric_limits<T>::max();
+    constexpr T kMin = std::numeric_limits<T>::min();
+    if (aLhs == 0 || aRhs == 0)
+    {
+        return false;
+    }
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (aLhs > 0)
+        {
+            return aRhs > 0 ? aLhs > kMax / aRhs : aRhs < kMin / aLhs;
+        }
+        return aRhs > 0 ? aLhs < kMin / aRhs : aLhs < kMax / aRhs;
+    }
+    else
+    {
+        return aLhs > kMax / aRhs;
+    }
+}
+
+template <typename T>
+constexpr bool add_overflow(T aLhs, T aRhs, T& aResult) noexcept
+{
+    static_assert(std::is_integral_v<T>, "Invalid T.");
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_add_overflow(aLhs, aRhs, &aResult);
+#else
+    return add_overflow_portable(aLhs, aRhs, aResult);
+#endif
+}
+
+template <typename T>
+constexpr bool sub_overflow(T aLhs, T aRhs, T& aResult) noexcept
+{
+    static_assert(std::is_integral_v<T>, "Invalid T.");
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_sub_overflow(aLhs, aRhs, &aResult);
+#else
+    return sub_overflow_portable(aLhs, aRhs, aResult);
+#endif
+}
+
+template <typename T>
+constexpr bool mul_overflow(T aLhs, T aRhs, T& aResult) noexcept
+{
+    static_assert(std::is_integral_v<T>, "Invalid T.");
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_mul_overflow(aLhs, aRhs, &aResult);
+#else
+    return mul_overflow_portable(aLhs, aRhs, aResult);
+#endif
+}
+
+// Overflow of checked arithmetic. Terminates the program at run time and
+// makes the expression ill-formed in constant evaluation.
+[[noreturn]] inline void on_overflow() noexcept { std::abort(); }
+
+template <typename T>
+constexpr T checked_add(T aLhs, T aRhs) noexcept
+{
+    T result{};
+    if (add_overflow(aLhs, aRhs, result))
+    {
+        on_overflow();
+    }
+    return result;
+}
+
+template <typename T>
+constexpr T checked_sub(T aLhs, T aRhs) noexcept
+{
+    T result{};
+    if (sub_overflow(aLhs, aRhs, result))
+    {
+        on_overflow();
+    }
+    return result;
+}
+
+template <typename T>
+constexpr T checked_mul(T aLhs, T aRhs) noexcept
+{
+    T result{};
+    if (mul_overflow(aLhs, aRhs, result))
+    {
+        on_overflow();
+    }
+    return result;
+}
+
+// Saturating addition and subtraction detect overflow with comparisons of
+// the wrapped result instead of overflow flags, so loops over them are
+// vectorized; the selection compiles to conditional moves or blends.
+template <typename T>
+constexpr T saturating_add(T aLhs, T aRhs) noexcept
+{
+    static_assert(std::is_integral_v<T>, "Invalid T.");
+    const T result = wrapping_add(aLhs, aRhs);
+    if constexpr (std::is_signed_v<T>)
+    {
+        // Sum overflows only if both operands have the sign of aLhs and the
+        // result does not.
+        const bool overflow = ((aLhs ^ result) & (aRhs ^ result)) < 0;
+        const T bound = aLhs < 0 ? std::numeric_limits<T>::min()
+                                 : std::numeric_limits<T>::max();
+        return overflow ? bound : result;
+    }
+    else
+    {
+        return result < aLhs ? std::numeric_limits<T>::max() : result;
+    }
+}
+
+template <typename T>
+constexpr T saturating_sub(T aLhs, T aRhs) noexcept
+{
+    static_assert(std::is_integral_v<T>, "Invalid T.");
+    const T result = wrapping_sub(aLhs, aRhs);
+    if constexpr (std::is_signed_v<T>)
+    {
+        // Difference overflows only if operands have different signs and
+        // the result does not have the sign of aLhs.
+        const bool overflow = ((aLhs ^ aRhs) & (aLhs ^ result)) < 0;
+        const T bound = aLhs < 0 ? std::numeric_limits<T>::min()
+                                 : std::numeric_limits<T>::max();
+        return overflow ? bound : result;
+    }
+    else
+    {
+        return result > aLhs ? T{0} : result;
+    }
+}
+
+template <typename T>
+constexpr T saturating_mul(T aLhs, T aRhs) noexcept
+{
+    T result{};
+    const bool overflow = mul_overflow(aLhs, aRhs, result);
+    if constexpr (std::is_signed_v<T>)
+    {
+        const T bound = (aLhs < 0) != (aRhs < 0)
+                            ? std::numeric_limits<T>::min()
+                            : std::numeric_limits<T>::max();
+        return overflow ? bound : result;
+    }
+    else
+    {
+        return overflow ? std::numeric_limits<T>::max() : result;
+    }
 }
 }  // namespace details
 
@@ -137,10 +707,6 @@ struct assignment
     constexpr StrongT& operator=(const StrongT& aValue) noexcept
     {
         static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
-        if (this == &aValue)
-        {
-            return *this;
-        }
         StrongT& ref = static_cast<StrongT&>(*this);
         ref.get() = aValue.get();
         return ref;
@@ -332,6 +898,111 @@ struct multiplication_assignment
     }
 };
 
+// Overflow policies for integral underlying types. Use one of them instead of
+// plus, minus or multiplication:
+//  - checked_* terminate the program on overflow;
+//  - saturating_* clamp the result to the range of the underlying type;
+//  - wrapping_* wrap around modulo 2^N, for signed types too.
+
+template <typename StrongT>
+struct checked_plus
+{
+    friend constexpr StrongT operator+(const StrongT& aLhs,
+                                       const StrongT& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(details::checked_add(aLhs.get(), aRhs.get()));
+    }
+};
+
+template <typename StrongT>
+struct checked_minus
+{
+    friend constexpr StrongT operator-(const StrongT& aLhs,
+                                       const StrongT& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(details::checked_sub(aLhs.get(), aRhs.get()));
+    }
+};
+
+template <typename StrongT>
+struct checked_multiplication
+{
+    friend constexpr StrongT operator*(const StrongT& aLhs,
+                                       const StrongT& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(details::checked_mul(aLhs.get(), aRhs.get()));
+    }
+};
+
+template <typename StrongT>
+struct saturating_plus
+{
+    friend constexpr StrongT operator+(const StrongT& aLhs,
+                                       const StrongT& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(details::saturating_add(aLhs.get(), aRhs.get()));
+    }
+};
+
+template <typename StrongT>
+struct saturating_minus
+{
+    friend constexpr StrongT operator-(const StrongT& aLhs,
+                                       const StrongT& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(details::saturating_sub(aLhs.get(), aRhs.get()));
+    }
+};
+
+template <typename StrongT>
+struct saturating_multiplication
+{
+    friend constexpr StrongT operator*(const StrongT& aLhs,
+                                       const StrongT& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(details::saturating_mul(aLhs.get(), aRhs.get()));
+    }
+};
+
+template <typename StrongT>
+struct wrapping_plus
+{
+    friend constexpr StrongT operator+(const StrongT& aLhs,
+                                       const StrongT& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(details::wrapping_add(aLhs.get(), aRhs.get()));
+    }
+};
+
+template <typename StrongT>
+struct wrapping_minus
+{
+    friend constexpr StrongT operator-(const StrongT& aLhs,
+                                       const StrongT& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(details::wrapping_sub(aLhs.get(), aRhs.get()));
+    }
+};
+
+template <typename StrongT>
+struct wrapping_multiplication
+{
+    friend constexpr StrongT operator*(const StrongT& aLhs,
+                                       const StrongT& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(details::wrapping_mul(aLhs.get(), aRhs.get()));
+    }
+};
+
 template <typename StrongT>
 struct bitwise_not
 {
@@ -471,16 +1142,19 @@ struct bitwise_right_shift_assignment
 template <typename StrongT>
 struct indirection
 {
-    friend constexpr auto& operator*(StrongT aValue) { return *(aValue.get()); }
+    friend constexpr auto& operator*(StrongT aValue)
+    {
+        return *details::pointer_of(aValue);
+    }
 };
 
 template <typename StrongT>
 struct subscription
 {
-    constexpr auto& operator[](std::size_t aIndex)
+    constexpr auto& operator[](std::size_t aIndex) const
     {
-        StrongT& ref = static_cast<StrongT&>(*this);
-        return *(ref.get() + aIndex);
+        const StrongT& ref = static_cast<const StrongT&>(*this);
+        return *(details::pointer_of(ref) + aIndex);
     }
 };
 
@@ -536,7 +1210,7 @@ struct pointer_minus_pointer
     {
         static_assert(strong::is_strong_v<StrongT>, "Invalid StrongT.");
         using value_type = strong::underlying_type<StrongT>;
-        static_assert(std::is_pointer_v<value_type>);
+        static_assert(details::is_pointer_v<value_type>);
         return aLhs.get() - aRhs.get();
     }
 };
@@ -564,6 +1238,38 @@ struct pointer_minus_assignment
         return aLhs;
     }
 };
+
+namespace details
+{
+template <>
+inline constexpr bool writes_in_place_v<plus_assignment> = true;
+template <>
+inline constexpr bool writes_in_place_v<minus_assignment> = true;
+template <>
+inline constexpr bool writes_in_place_v<pre_increment> = true;
+template <>
+inline constexpr bool writes_in_place_v<post_increment> = true;
+template <>
+inline constexpr bool writes_in_place_v<pre_decrement> = true;
+template <>
+inline constexpr bool writes_in_place_v<post_decrement> = true;
+template <>
+inline constexpr bool writes_in_place_v<modulo_assignment> = true;
+template <>
+inline constexpr bool writes_in_place_v<division_assignment> = true;
+template <>
+inline constexpr bool writes_in_place_v<multiplication_assignment> = true;
+template <>
+inline constexpr bool writes_in_place_v<bitwise_and_assignment> = true;
+template <>
+inline constexpr bool writes_in_place_v<bitwise_or_assignment> = true;
+template <>
+inline constexpr bool writes_in_place_v<bitwise_xor_assignment> = true;
+template <>
+inline constexpr bool writes_in_place_v<bitwise_left_shift_assignment> = true;
+template <>
+inline constexpr bool writes_in_place_v<bitwise_right_shift_assignment> = true;
+}  // namespace details
 }  // namespace strong
 
 #endif /* strong_type_h */
@@ -0,0 +1,269 @@
+#ifndef strong_type_tagged_ptr_h
+#define strong_type_tagged_ptr_h
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "atomic.h"
+
+// Number of high pointer bits that are not part of virtual addresses. 64-bit
+// x86 and ARM use 48-bit user space addresses; define it as 0 (or 7 with
+// 57-bit virtual addresses) if the process maps memory above that.
+#ifndef STRONG_TYPE_POINTER_FREE_HIGH_BITS
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || \
+    defined(_M_ARM64)
+#define STRONG_TYPE_POINTER_FREE_HIGH_BITS 16
+#else
+#define STRONG_TYPE_POINTER_FREE_HIGH_BITS 0
+#endif
+#endif
+
+namespace strong
+{
+namespace details
+{
+constexpr unsigned log2(std::size_t aValue) noexcept
+{
+    unsigned result = 0;
+    for (; aValue > 1; aValue >>= 1)
+    {
+        ++result;
+    }
+    return result;
+}
+}  // namespace details
+
+// Pointer to T with a TagBits-bit tag (e.g. an ABA counter or a mark bit)
+// stored in one pointer-sized word. The low log2(alignof(T)) bits of the tag
+// go into the alignment bits of the pointer, the rest into the high bits
+// that are not part of virtual addresses. Tag values are taken modulo
+// 2^TagBits, so counters simply wrap around. Dereference, subscript and
+// pointer arithmetic mask the tag out and keep it unchanged. Tag names the
+// pointer type like the tag of a strong_type.
+//
+// tagged_ptr is not a strong_type with the indirection, subscription and
+// pointer arithmetic mixins: those work on get(), which returns the
+// underlying value, while here the underlying value is the tagged word and
+// get() has to return the masked pointer.
+template <typename Tag, typename T, unsigned TagBits>
+class tagged_ptr
+{
+    using word_t = std::uintptr_t;
+    static constexpr unsigned kDigits = std::numeric_limits<word_t>::digits;
+    static constexpr unsigned kLowBits = details::log2(alignof(T));
+    static constexpr unsigned kHighBits = STRONG_TYPE_POINTER_FREE_HIGH_BITS;
+    static_assert(TagBits > 0 && TagBits <= kLowBits + kHighBits,
+                  "Not enough unused pointer bits for TagBits.");
+
+    static constexpr unsigned kLowTagBits =
+        TagBits < kLowBits ? TagBits : kLowBits;
+    static constexpr unsigned kHighTagBits = TagBits - kLowTagBits;
+    static constexpr word_t kLowTagMask = (word_t{1} << kLowTagBits) - 1;
+    static constexpr word_t kHighTagMask =
+        kHighTagBits == 0 ? word_t{0}
+                          : ~word_t{0} << (kDigits - kHighTagBits);
+    static constexpr word_t kPointerMask = ~(kLowTagMask | kHighTagMask);
+
+   public:
+    using element_type = T;
+    using tag_value_type = word_t;
+
+    static constexpr unsigned tag_bits = TagBits;
+    static constexpr word_t max_tag = (word_t{1} << TagBits) - 1;
+
+    constexpr tagged_ptr() noexcept : word_{0} {}
+
+    explicit tagged_ptr(T* aPointer, word_t aTag = 0) noexcept
+        : word_{compose(aPointer, aTag)}
+    {
+    }
+
+    static constexpr tagged_ptr from_word(word_t aWord) noexcept
+    {
+        tagged_ptr result;
+        result.word_ = aWord;
+        return result;
+    }
+
+    constexpr word_t word() const noexcept { return word_; }
+
+    T* get() const noexcept
+    {
+        return reinterpret_cast<T*>(word_ & kPointerMask);
+    }
+
+    constexpr word_t tag() const noexcept
+    {
+        if constexpr (kHighTagBits == 0)
+        {
+            return word_ & kLowTagMask;
+        }
+        else
+        {
+            return (word_ & kLowTagMask) |
+                   ((word_ & kHighTagMask) >> (kDigits - TagBits));
+        }
+    }
+
+    tagged_ptr with_pointer(T* aPointer) const noexcept
+    {
+        return tagged_ptr(aPointer, tag());
+    }
+
+    tagged_ptr with_tag(word_t aTag) const noexcept
+    {
+        return tagged_ptr(get(), aTag);
+    }
+
+    explicit operator bool() const noexcept { return get() != nullptr; }
+
+    T& operator*() const noexcept { return *get(); }
+    T* operator->() const noexcept { return get(); }
+    T& operator[](std::ptrdiff_t aIndex) const noexcept
+    {
+        return get()[aIndex];
+    }
+
+    friend tagged_ptr operator+(const tagged_ptr& aLhs,
+                                std::ptrdiff_t aOffset) noexcept
+    {
+        return aLhs.with_pointer(aLhs.get() + aOffset);
+    }
+
+    friend tagged_ptr operator-(const tagged_ptr& aLhs,
+                                std::ptrdiff_t aOffset) noexcept
+    {
+        return aLhs.with_pointer(aLhs.get() - aOffset);
+    }
+
+    friend std::ptrdiff_t operator-(const tagged_ptr& aLhs,
+                                    const tagged_ptr& aRhs) noexcept
+    {
+        return aLhs.get() - aRhs.get();
+    }
+
+    tagged_ptr& operator+=(std::ptrdiff_t aOffset) noexcept
+    {
+        return *this = *this + aOffset;
+    }
+
+    tagged_ptr& operator-=(std::ptrdiff_t aOffset) noexcept
+    {
+        return *this = *this - aOffset;
+    }
+
+    // Equal if both the pointers and the tags are equal.
+    friend constexpr bool operator==(const tagged_ptr& aLhs,
+                                     const tagged_ptr& aRhs) noexcept
+    {
+        return aLhs.word_ == aRhs.word_;
+    }
+
+    friend constexpr bool operator!=(const tagged_ptr& aLhs,
+                                     const tagged_ptr& aRhs) noexcept
+    {
+        return aLhs.word_ != aRhs.word_;
+    }
+
+   private:
+    static word_t compose(T* aPointer, word_t aTag) noexcept
+    {
+        const auto address = reinterpret_cast<word_t>(aPointer);
+        assert((address & ~kPointerMask) == 0 &&
+               "Pointer is misaligned or outside of the address range.");
+        word_t word = address | (aTag & kLowTagMask);
+        if constexpr (kHighTagBits != 0)
+        {
+            word |= (aTag << (kDigits - TagBits)) & kHighTagMask;
+        }
+        return word;
+    }
+
+    word_t word_;
+};
+
+template <typename T>
+struct is_tagged_ptr : std::false_type
+{
+};
+
+template <typename Tag, typename T, unsigned TagBits>
+struct is_tagged_ptr<tagged_ptr<Tag, T, TagBits>> : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool is_tagged_ptr_v = is_tagged_ptr<T>::value;
+
+// Atomic tagged_ptr: a single-word CAS swaps the pointer and its tag at
+// once, which is enough for ABA-safe lock-free stacks and lists that bump
+// the tag on every update, without a double-word CAS.
+template <typename Tag, typename T, unsigned TagBits>
+class atomic<tagged_ptr<Tag, T, TagBits>>
+{
+    using word_t = std::uintptr_t;
+
+   public:
+    using value_type = tagged_ptr<Tag, T, TagBits>;
+
+    static constexpr bool is_always_lock_free =
+        std::atomic<word_t>::is_always_lock_free;
+
+    constexpr atomic() noexcept : value_{0} {}
+    constexpr explicit atomic(value_type aValue) noexcept
+        : value_(aValue.word())
+    {
+    }
+
+    atomic(const atomic&) = delete;
+    atomic& operator=(const atomic&) = delete;
+
+    bool is_lock_free() const noexcept { return value_.is_lock_free(); }
+
+    value_type load(std::memory_order aOrder) const noexcept
+    {
+        return value_type::from_word(value_.load(aOrder));
+    }
+
+    void store(value_type aValue, std::memory_order aOrder) noexcept
+    {
+        value_.store(aValue.word(), aOrder);
+    }
+
+    value_type exchange(value_type aValue, std::memory_order aOrder) noexcept
+    {
+        return value_type::from_word(value_.exchange(aValue.word(), aOrder));
+    }
+
+    bool compare_exchange_weak(value_type& aExpected, value_type aDesired,
+                               std::memory_order aSuccess,
+                               std::memory_order aFailure) noexcept
+    {
+        word_t expected = aExpected.word();
+        const bool exchanged = value_.compare_exchange_weak(
+            expected, aDesired.word(), aSuccess, aFailure);
+        aExpected = value_type::from_word(expected);
+        return exchanged;
+    }
+
+    bool compare_exchange_strong(value_type& aExpected, value_type aDesired,
+                                 std::memory_order aSuccess,
+                                 std::memory_order aFailure) noexcept
+    {
+        word_t expected = aExpected.word();
+        const bool exchanged = value_.compare_exchange_strong(
+            expected, aDesired.word(), aSuccess, aFailure);
+        aExpected = value_type::from_word(expected);
+        return exchanged;
+    }
+
+   private:
+    std::atomic<word_t> value_;
+};
+}  // namespace strong
+
+#endif /* strong_type_tagged_ptr_h */
@@ -0,0 +1,304 @@
+#ifndef strong_type_tsc_h
+#define strong_type_tsc_h
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <type_traits>
+
+#include "strong_type.h"
+
+// Counter read by tsc_clock: the time stamp counter on x86-64, the virtual
+// counter on ARM64 and steady_clock in nanoseconds elsewhere.
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define STRONG_TYPE_TSC_X86 1
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#define STRONG_TYPE_TSC_X86 1
+#include <intrin.h>
+#else
+#define STRONG_TYPE_TSC_X86 0
+#endif
+
+#if !STRONG_TYPE_TSC_X86 && defined(__aarch64__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define STRONG_TYPE_TSC_ARM64 1
+#else
+#define STRONG_TYPE_TSC_ARM64 0
+#endif
+
+namespace strong
+{
+// Number of ticks of tsc_clock. Signed: the difference of timestamps taken
+// in any order is a duration.
+using tsc_duration =
+    strong_type<struct tsc_duration_tag, std::int64_t, plus, minus,
+                plus_assignment, minus_assignment, multiplication, division,
+                comparisons>;
+
+// Arithmetic of timestamps: the difference of two timestamps is a duration,
+// and a timestamp moved by a duration is a timestamp. Timestamps are not
+// added together.
+template <typename StrongT>
+struct tsc_timestamp_arithmetic
+{
+    friend constexpr tsc_duration operator-(const StrongT& aLhs,
+                                            const StrongT& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return tsc_duration(static_cast<std::int64_t>(aLhs.get() - aRhs.get()));
+    }
+
+    friend constexpr StrongT operator+(const StrongT& aLhs,
+                                       const tsc_duration& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(aLhs.get() + static_cast<std::uint64_t>(aRhs.get()));
+    }
+
+    friend constexpr StrongT operator-(const StrongT& aLhs,
+                                       const tsc_duration& aRhs) noexcept
+    {
+        static_assert(is_strong_v<StrongT>, "Invalid StrongT.");
+        return StrongT(aLhs.get() - static_cast<std::uint64_t>(aRhs.get()));
+    }
+};
+
+// Reading of tsc_clock in ticks.
+using tsc_timestamp =
+    strong_type<struct tsc_timestamp_tag, std::uint64_t, comparisons,
+                tsc_timestamp_arithmetic>;
+
+// Clock that reads the cycle counter of the CPU: an instruction of about 20
+// cycles, without the call into the vDSO and the conversion of
+// steady_clock::now(). Timestamps are raw ticks; they are converted to
+// nanoseconds with tsc_calibration when they are reported.
+//
+// On x86-64 the counter must be invariant (constant_tsc and nonstop_tsc in
+// /proc/cpuinfo), which all x86-64 CPUs of the last decade are: it then
+// runs at a constant rate in every power state and is synchronized between
+// cores, so timestamps taken on different cores can be compared.
+struct tsc_clock
+{
+    // Reads the counter. The read may be reordered with neighbouring
+    // instructions: take the start of a measured region with it.
+    static tsc_timestamp now() noexcept
+    {
+#if STRONG_TYPE_TSC_X86
+        return tsc_timestamp(__rdtsc());
+#elif STRONG_TYPE_TSC_ARM64
+        std::uint64_t ticks;
+        __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+        return tsc_timestamp(ticks);
+#else
+        return steady_now();
+#endif
+    }
+
+    // Reads the counter after all preceding instructions have executed:
+    // take the end of a measured region with it.
+    static tsc_timestamp now_ordered() noexcept
+    {
+#if STRONG_TYPE_TSC_X86
+        unsigned int processor;
+        return tsc_timestamp(__rdtscp(&processor));
+#elif STRONG_TYPE_TSC_ARM64
+        std::uint64_t ticks;
+        __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0"
+                             : "=r"(ticks)
+                             :
+                             : "memory");
+        return tsc_timestamp(ticks);
+#else
+        return steady_now();
+#endif
+    }
+
+   private:
+    static tsc_timestamp steady_now() noexcept
+    {
+        const auto time = std::chrono::steady_clock::now().time_since_epoch();
+        return tsc_timestamp(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(time)
+                .count()));
+    }
+};
+
+// Rate of tsc_clock and its offset from steady_clock, measured once per
+// process. Conversion of ticks to nanoseconds is a fixed point
+// multiplication, not a division.
+class tsc_calibration
+{
+   public:
+    // Calibration of the process. It is measured on the first call, which
+    // takes about 10 ms: call instance() during startup so that the first
+    // tsc_cast or tsc_ticks on a hot path does not pay for it.
+    static const tsc_calibration& instance() noexcept
+    {
+        static const tsc_calibration calibration = measure();
+        return calibration;
+    }
+
+    // Calibration of a counter with the given rate whose reading aBase was
+    // taken at aSteadyBase.
+    tsc_calibration(std::uint64_t aTicksPerSecond, tsc_timestamp aBase,
+                    std::chrono::steady_clock::time_point aSteadyBase) noexcept
+        : ticksPerSecond_(aTicksPerSecond),
+          wholeNanoseconds_(kNanosecondsPerSecond / aTicksPerSecond),
+          // Fraction of a nanosecond per tick in units of 2^-32, rounded.
+          fractionNanoseconds_(
+              ((kNanosecondsPerSecond % aTicksPerSecond << 32) +
+               aTicksPerSecond / 2) /
+              aTicksPerSecond),
+          base_(aBase),
+          steadyBase_(aSteadyBase)
+    {
+    }
+
+    std::uint64_t ticks_per_second() const noexcept { return ticksPerSecond_; }
+
+    std::int64_t nanoseconds(tsc_duration aDuration) const noexcept
+    {
+        const std::int64_t ticks = aDuration.get();
+        const std::uint64_t magnitude =
+            ticks < 0 ? 0 - static_cast<std::uint64_t>(ticks)
+                      : static_cast<std::uint64_t>(ticks);
+        const std::uint64_t high = magnitude >> 32;
+        const std::uint64_t low = magnitude & 0xFFFFFFFFu;
+        const std::uint64_t result =
+            magnitude * wholeNanoseconds_ + high * fractionNanoseconds_ +
+            ((low * fractionNanoseconds_ + (std::uint64_t{1} << 31)) >> 32);
+        return ticks < 0 ? -static_cast<std::int64_t>(result)
+                         : static_cast<std::int64_t>(result);
+    }
+
+    // Duration in ticks that is closest to aNanoseconds. Exact, but it
+    // divides: convert limits and deadlines once, outside of hot loops.
+    tsc_duration ticks(std::chrono::nanoseconds aNanoseconds) const noexcept
+    {
+        const std::int64_t ns = aNanoseconds.count();
+        const std::uint64_t magnitude =
+            ns < 0 ? 0 - static_cast<std::uint64_t>(ns)
+                   : static_cast<std::uint64_t>(ns);
+        const std::uint64_t result =
+            magnitude / kNanosecondsPerSecond * ticksPerSecond_ +
+            (magnitude % kNanosecondsPerSecond * ticksPerSecond_ +
+             kNanosecondsPerSecond / 2) /
+                kNanosecondsPerSecond;
+        return tsc_duration(ns < 0 ? -static_cast<std::int64_t>(result)
+                                   : static_cast<std::int64_t>(result));
+    }
+
+    // Point of steady_clock at which tsc_clock read aTimestamp.
+    std::chrono::steady_clock::time_point to_steady(
+        tsc_timestamp aTimestamp) const noexcept
+    {
+        return steadyBase_ + std::chrono::duration_cast<
+                                 std::chrono::steady_clock::duration>(
+                                 std::chrono::nanoseconds(
+                                     nanoseconds(aTimestamp - base_)));
+    }
+
+   private:
+    static constexpr std::uint64_t kNanosecondsPerSecond = 1000000000;
+
+    // A reading of steady_clock and the counter readings around it.
+    struct sample
+    {
+        tsc_timestamp before;
+        std::chrono::steady_clock::time_point steady;
+        tsc_timestamp after;
+    };
+
+    // Sample with the narrowest bracket of a few: the thread is not
+    // preempted between its readings.
+    static sample take_sample() noexcept
+    {
+        sample best{};
+        for (int attempt = 0; attempt < 16; ++attempt)
+        {
+            sample current{};
+            current.before = tsc_clock::now_ordered();
+            current.steady = std::chrono::steady_clock::now();
+            current.after = tsc_clock::now_ordered();
+            if (attempt == 0 ||
+                current.after - current.before < best.after - best.before)
+            {
+                best = current;
+            }
+        }
+        return best;
+    }
+
+    static tsc_timestamp middle(const sample& aSample) noexcept
+    {
+        return aSample.before +
+               tsc_duration((aSample.after - aSample.before).get() / 2);
+    }
+
+    static tsc_calibration measure() noexcept
+    {
+#if STRONG_TYPE_TSC_ARM64
+        std::uint64_t frequency;
+        __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(frequency));
+        const sample first = take_sample();
+        return tsc_calibration(frequency, middle(first), first.steady);
+#elif STRONG_TYPE_TSC_X86
+        // 10 ms between samples that are precise to tens of nanoseconds:
+        // the rate is off by a few parts per million.
+        const sample first = take_sample();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        const sample last = take_sample();
+        const auto ticks =
+            static_cast<std::uint64_t>((middle(last) - middle(first)).get());
+        // At least 1 ns, should steady_clock not have moved at all.
+        const auto ns = std::max<std::uint64_t>(
+            static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    last.steady - first.steady)
+                    .count()),
+            1);
+        return tsc_calibration(
+            std::max<std::uint64_t>(
+                (ticks / ns) * kNanosecondsPerSecond +
+                    ticks % ns * kNanosecondsPerSecond / ns,
+                1),
+            middle(first), first.steady);
+#else
+        const sample first = take_sample();
+        return tsc_calibration(kNanosecondsPerSecond, middle(first),
+                               first.steady);
+#endif
+    }
+
+    std::uint64_t ticksPerSecond_;
+    std::uint64_t wholeNanoseconds_;
+    std::uint64_t fractionNanoseconds_;
+    tsc_timestamp base_;
+    std::chrono::steady_clock::time_point steadyBase_;
+};
+
+// aDuration as a std::chrono duration, e.g.
+// strong::tsc_cast<std::chrono::microseconds>(end - start). Rounds towards
+// zero like std::chrono::duration_cast.
+template <typename Duration = std::chrono::nanoseconds>
+Duration tsc_cast(tsc_duration aDuration) noexcept
+{
+    return std::chrono::duration_cast<Duration>(std::chrono::nanoseconds(
+        tsc_calibration::instance().nanoseconds(aDuration)));
+}
+
+// Duration in ticks closest to aDuration, for comparisons with differences
+// of timestamps on hot paths.
+template <typename Rep, typename Period>
+tsc_duration tsc_ticks(std::chrono::duration<Rep, Period> aDuration) noexcept
+{
+    return tsc_calibration::instance().ticks(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(aDuration));
+}
+}  // namespace strong
+
+#endif /* strong_type_tsc_h */
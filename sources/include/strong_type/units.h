@@ -0,0 +1,245 @@
+#ifndef strong_type_units_h
+#define strong_type_units_h
+
+#include <cstdint>
+#include <numeric>
+#include <ratio>
+#include <type_traits>
+
+#include "strong_type.h"
+
+namespace strong::units
+{
+// Exponents of base dimensions: length, mass, time, data and count (of
+// items, events, requests...).
+template <int... Exponents>
+struct dimension
+{
+    static_assert(sizeof...(Exponents) == 5, "Invalid number of exponents.");
+};
+
+using dimensionless = dimension<0, 0, 0, 0, 0>;
+using length = dimension<1, 0, 0, 0, 0>;
+using mass = dimension<0, 1, 0, 0, 0>;
+using time = dimension<0, 0, 1, 0, 0>;
+using data = dimension<0, 0, 0, 1, 0>;
+using count = dimension<0, 0, 0, 0, 1>;
+
+template <typename Lhs, typename Rhs>
+struct dimension_product;
+
+template <int... Lhs, int... Rhs>
+struct dimension_product<dimension<Lhs...>, dimension<Rhs...>>
+{
+    using type = dimension<(Lhs + Rhs)...>;
+};
+
+template <typename Lhs, typename Rhs>
+using dimension_product_t = typename dimension_product<Lhs, Rhs>::type;
+
+template <typename Lhs, typename Rhs>
+struct dimension_quotient;
+
+template <int... Lhs, int... Rhs>
+struct dimension_quotient<dimension<Lhs...>, dimension<Rhs...>>
+{
+    using type = dimension<(Lhs - Rhs)...>;
+};
+
+template <typename Lhs, typename Rhs>
+using dimension_quotient_t = typename dimension_quotient<Lhs, Rhs>::type;
+
+// Tag of a quantity: its dimension and the size of one unit in base units
+// of that dimension (std::milli for milliseconds, std::kilo for kilobytes).
+template <typename Dimension, typename Ratio = std::ratio<1>>
+struct unit
+{
+    using dimension = Dimension;
+    using ratio = typename Ratio::type;
+};
+
+template <typename T>
+struct is_unit : std::false_type
+{
+};
+
+template <typename Dimension, typename Ratio>
+struct is_unit<unit<Dimension, Ratio>> : std::true_type
+{
+};
+
+// Strong type measured in Unit. Quantities of the same unit are added,
+// subtracted and compared; quantities of any units are multiplied and
+// divided, yielding a quantity of the derived unit.
+template <typename Unit, typename T>
+using quantity =
+    strong_type<Unit, T, comparisons, plus, plus_assignment, minus,
+                minus_assignment, unary_minus>;
+
+template <typename T, typename = void>
+struct is_quantity : std::false_type
+{
+};
+
+template <typename T>
+struct is_quantity<T, std::enable_if_t<is_strong_v<T>>>
+    : is_unit<tag_type<T>>
+{
+};
+
+template <typename T>
+inline constexpr bool is_quantity_v = is_quantity<T>::value;
+
+namespace details
+{
+// aValue * Ratio in the common type of T and std::intmax_t, with
+// multiplications and divisions by one skipped at compile time.
+template <typename Ratio, typename To, typename T>
+constexpr To scale(T aValue) noexcept
+{
+    using C = std::common_type_t<To, T, std::intmax_t>;
+    if constexpr (Ratio::num == 1 && Ratio::den == 1)
+    {
+        return static_cast<To>(aValue);
+    }
+    else if constexpr (Ratio::num == 1)
+    {
+        return static_cast<To>(static_cast<C>(aValue) /
+                               static_cast<C>(Ratio::den));
+    }
+    else if constexpr (Ratio::den == 1)
+    {
+        return static_cast<To>(static_cast<C>(aValue) *
+                               static_cast<C>(Ratio::num));
+    }
+    else
+    {
+        return static_cast<To>(static_cast<C>(aValue) *
+                               static_cast<C>(Ratio::num) /
+                               static_cast<C>(Ratio::den));
+    }
+}
+
+// Quantity of Unit with aValue, or the plain number when dimensions cancel
+// out (bytes / bytes).
+template <typename Unit, typename T>
+constexpr auto make_quantity(T aValue) noexcept
+{
+    if constexpr (std::is_same_v<typename Unit::dimension, dimensionless>)
+    {
+        return scale<typename Unit::ratio, T>(aValue);
+    }
+    else
+    {
+        return quantity<Unit, T>(aValue);
+    }
+}
+
+// Largest ratio that both ratios are whole multiples of, like the period of
+// std::common_type of two std::chrono::duration.
+template <typename Lhs, typename Rhs>
+using common_ratio_t =
+    typename std::ratio<std::gcd(Lhs::num, Rhs::num),
+                        std::lcm(Lhs::den, Rhs::den)>::type;
+
+template <typename LhsQ, typename RhsQ>
+inline constexpr bool are_quantities_v =
+    is_quantity_v<LhsQ> && is_quantity_v<RhsQ>;
+
+template <typename Q, typename T>
+inline constexpr bool is_scalable_v =
+    is_quantity_v<Q> && std::is_arithmetic_v<T>;
+}  // namespace details
+
+// Converts between units of the same dimension. Scale factor is a
+// compile-time constant; integral conversions truncate like
+// std::chrono::duration_cast.
+template <typename ToQ, typename FromQ>
+constexpr ToQ quantity_cast(const FromQ& aFrom) noexcept
+{
+    static_assert(is_quantity_v<ToQ> && is_quantity_v<FromQ>,
+                  "Invalid quantities.");
+    using From = tag_type<FromQ>;
+    using To = tag_type<ToQ>;
+    static_assert(
+        std::is_same_v<typename From::dimension, typename To::dimension>,
+        "Units must have the same dimension.");
+    using Ratio = std::ratio_divide<typename From::ratio, typename To::ratio>;
+    return ToQ(details::scale<Ratio, underlying_type<ToQ>>(aFrom.get()));
+}
+
+template <typename LhsQ, typename RhsQ,
+          std::enable_if_t<details::are_quantities_v<LhsQ, RhsQ>, int> = 0>
+constexpr auto operator*(const LhsQ& aLhs, const RhsQ& aRhs) noexcept
+{
+    using Lhs = tag_type<LhsQ>;
+    using Rhs = tag_type<RhsQ>;
+    using Unit = unit<
+        dimension_product_t<typename Lhs::dimension, typename Rhs::dimension>,
+        std::ratio_multiply<typename Lhs::ratio, typename Rhs::ratio>>;
+    return details::make_quantity<Unit>(aLhs.get() * aRhs.get());
+}
+
+template <typename LhsQ, typename RhsQ,
+          std::enable_if_t<details::are_quantities_v<LhsQ, RhsQ>, int> = 0>
+constexpr auto operator/(const LhsQ& aLhs, const RhsQ& aRhs) noexcept
+{
+    using Lhs = tag_type<LhsQ>;
+    using Rhs = tag_type<RhsQ>;
+    using Dimension =
+        dimension_quotient_t<typename Lhs::dimension, typename Rhs::dimension>;
+    if constexpr (std::is_same_v<Dimension, dimensionless>)
+    {
+        // Both operands are brought to the common ratio first, so that
+        // integral division does not truncate before the scale is applied
+        // (1 KB / 1000 B is 1, not 0).
+        using Common =
+            details::common_ratio_t<typename Lhs::ratio, typename Rhs::ratio>;
+        using T = decltype(aLhs.get() / aRhs.get());
+        return details::scale<std::ratio_divide<typename Lhs::ratio, Common>,
+                              T>(aLhs.get()) /
+               details::scale<std::ratio_divide<typename Rhs::ratio, Common>,
+                              T>(aRhs.get());
+    }
+    else
+    {
+        using Unit = unit<Dimension, std::ratio_divide<typename Lhs::ratio,
+                                                       typename Rhs::ratio>>;
+        return details::make_quantity<Unit>(aLhs.get() / aRhs.get());
+    }
+}
+
+template <typename Q, typename T,
+          std::enable_if_t<details::is_scalable_v<Q, T>, int> = 0>
+constexpr auto operator*(const Q& aLhs, T aRhs) noexcept
+{
+    return details::make_quantity<tag_type<Q>>(aLhs.get() * aRhs);
+}
+
+template <typename T, typename Q,
+          std::enable_if_t<details::is_scalable_v<Q, T>, int> = 0>
+constexpr auto operator*(T aLhs, const Q& aRhs) noexcept
+{
+    return details::make_quantity<tag_type<Q>>(aLhs * aRhs.get());
+}
+
+template <typename Q, typename T,
+          std::enable_if_t<details::is_scalable_v<Q, T>, int> = 0>
+constexpr auto operator/(const Q& aLhs, T aRhs) noexcept
+{
+    return details::make_quantity<tag_type<Q>>(aLhs.get() / aRhs);
+}
+
+template <typename T, typename Q,
+          std::enable_if_t<details::is_scalable_v<Q, T>, int> = 0>
+constexpr auto operator/(T aLhs, const Q& aRhs) noexcept
+{
+    using Rhs = tag_type<Q>;
+    using Unit =
+        unit<dimension_quotient_t<dimensionless, typename Rhs::dimension>,
+             std::ratio_divide<std::ratio<1>, typename Rhs::ratio>>;
+    return details::make_quantity<Unit>(aLhs / aRhs.get());
+}
+}  // namespace strong::units
+
+#endif /* strong_type_units_h */
@@ -0,0 +1,66 @@
+#ifndef strong_type_varint_h
+#define strong_type_varint_h
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace strong
+{
+namespace details
+{
+// Longest LEB128 varint of a T: 7 bits per byte.
+template <typename T>
+inline constexpr std::size_t max_varint_size_v =
+    (std::numeric_limits<T>::digits + 6) / 7;
+
+// Writes aValue as a LEB128 varint to aOut, which must have room for
+// max_varint_size_v<U> bytes, and returns the end of the varint.
+template <typename U>
+std::byte* write_varint(U aValue, std::byte* aOut) noexcept
+{
+    static_assert(std::is_unsigned_v<U>, "Varints encode unsigned values.");
+    while (aValue >= 0x80)
+    {
+        *aOut++ = static_cast<std::byte>(aValue | 0x80);
+        aValue = static_cast<U>(aValue >> 7);
+    }
+    *aOut++ = static_cast<std::byte>(aValue);
+    return aOut;
+}
+
+// Reads a LEB128 varint from [aIn, aLast) into aValue and moves aIn past
+// it. Fails on truncated varints and on varints whose value does not fit
+// in U, including those longer than max_varint_size_v<U> bytes.
+template <typename U>
+bool read_varint(const std::byte*& aIn, const std::byte* aLast,
+                 U& aValue) noexcept
+{
+    static_assert(std::is_unsigned_v<U>, "Varints encode unsigned values.");
+    constexpr unsigned kBits = std::numeric_limits<U>::digits;
+    U value = 0;
+    for (unsigned shift = 0; shift < kBits; shift += 7)
+    {
+        if (aIn == aLast)
+        {
+            return false;
+        }
+        const auto byte = static_cast<unsigned>(*aIn++);
+        const auto bits = static_cast<U>(byte & 0x7f);
+        if (kBits - shift < 7 && (bits >> (kBits - shift)) != 0)
+        {
+            return false;
+        }
+        value = static_cast<U>(value | static_cast<U>(bits << shift));
+        if (byte < 0x80)
+        {
+            aValue = value;
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace details
+}  // namespace strong
+
+#endif /* strong_type_varint_h */
@@ -0,0 +1,133 @@
+# Compares instruction streams of paired kernels.
+#
+# Usage:
+#   cmake -DOBJDUMP=<objdump> -DOBJECTS=<obj1|obj2|...> -P check_codegen.cmake
+#
+# Every function <name>_strong found in the objects is compared with
+# <name>_raw. Before comparison instruction streams are normalized: offsets,
+# symbol names and assembler comments are dropped, branch targets are made
+# relative to the beginning of the function, registers are renamed in the
+# order of their first use and operands of a register comparison that is
+# only tested for equality are sorted. Kernels that differ only in the
+# choice of registers therefore compare equal. Any other difference,
+# including the order of instructions, fails the check.
+
+cmake_minimum_required(VERSION 3.23)
+
+if(NOT OBJDUMP OR NOT OBJECTS)
+  message(FATAL_ERROR "OBJDUMP and OBJECTS must be defined.")
+endif()
+
+string(REPLACE "|" ";" OBJECTS "${OBJECTS}")
+
+# Renames registers of a function body to %r0, %r1, ... in the order of
+# their first use and sorts operands of "cmp" followed by an equality test.
+function(canonical_form body out_var)
+  # Terminate every register name so that %r8 is not a prefix of %r8d.
+  string(REGEX REPLACE "%([a-z0-9]+)" "%\\1%" body "${body}")
+  string(REGEX MATCHALL "%[a-z0-9]+%" registers "${body}")
+  list(REMOVE_DUPLICATES registers)
+  set(index 0)
+  foreach(register IN LISTS registers)
+    string(REPLACE "${register}" "@r${index}" body "${body}")
+    math(EXPR index "${index} + 1")
+  endforeach()
+  string(REPLACE "@r" "%r" body "${body}")
+  string(REGEX MATCHALL "  cmp %r[0-9]+,%r[0-9]+\n  (je|jne|sete|setne) "
+    compares "${body}")
+  foreach(compare IN LISTS compares)
+    if(compare MATCHES "^  cmp %r([0-9]+),%r([0-9]+)\n  ([a-z]+) $"
+        AND CMAKE_MATCH_1 GREATER CMAKE_MATCH_2)
+      set(sorted
+        "  cmp %r${CMAKE_MATCH_2},%r${CMAKE_MATCH_1}\n  ${CMAKE_MATCH_3} ")
+      string(REPLACE "${compare}" "${sorted}" body "${body}")
+    endif()
+  endforeach()
+  set(${out_var} "${body}" PARENT_SCOPE)
+endfunction()
+
+set(functions "")
+foreach(object IN LISTS OBJECTS)
+  execute_process(
+    COMMAND ${OBJDUMP} -d --no-show-raw-insn ${object}
+    OUTPUT_VARIABLE disassembly
+    ERROR_VARIABLE objdump_error
+    RESULT_VARIABLE objdump_result
+  )
+  if(NOT objdump_result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed for ${object}: ${objdump_error}")
+  endif()
+
+  # Protect semicolons of the listing from being treated as list separators.
+  string(REPLACE ";" "<semicolon>" disassembly "${disassembly}")
+  string(REPLACE "\n" ";" lines "${disassembly}")
+
+  set(current "")
+  foreach(line IN LISTS lines)
+    if(line MATCHES "^[0-9a-fA-F]+ <_?([A-Za-z0-9_.$]+)>:$")
+      set(current "${CMAKE_MATCH_1}")
+      list(APPEND functions "${current}")
+      set(body_${current} "")
+    elseif(current AND line MATCHES "^ *[0-9a-fA-F]+:[ \t]+(.*)$")
+      set(insn "${CMAKE_MATCH_1}")
+      # Assembler comments carry absolute addresses.
+      string(REGEX REPLACE "[ \t]*#.*$" "" insn "${insn}")
+      # Branch targets: "1f <fn+0x1f>" -> "+0x1f", "0 <fn>" -> "+0x0".
+      string(REGEX REPLACE "[0-9a-fA-F]+ <[^>+]*\\+(0x[0-9a-fA-F]+)>" "+\\1"
+        insn "${insn}")
+      string(REGEX REPLACE "[0-9a-fA-F]+ <[^>]*>" "+0x0" insn "${insn}")
+      string(REGEX REPLACE "[ \t]+" " " insn "${insn}")
+      string(STRIP "${insn}" insn)
+      if(NOT insn STREQUAL "")
+        string(APPEND body_${current} "  ${insn}\n")
+      endif()
+    elseif(line STREQUAL "")
+      set(current "")
+    endif()
+  endforeach()
+endforeach()
+
+# Alignment padding between functions is not part of the function itself.
+foreach(function IN LISTS functions)
+  string(REGEX REPLACE "(  (nop|xchg|data16|cs nop|int3)[^\n]*\n)+$" ""
+    body_${function} "${body_${function}}")
+endforeach()
+
+set(pairs 0)
+set(mismatches 0)
+foreach(function IN LISTS functions)
+  if(NOT function MATCHES "^(.+)_strong$")
+    continue()
+  endif()
+  set(kernel "${CMAKE_MATCH_1}")
+  if(NOT DEFINED body_${kernel}_raw)
+    message(SEND_ERROR "${function} has no ${kernel}_raw twin.")
+    continue()
+  endif()
+  math(EXPR pairs "${pairs} + 1")
+  set(raw "${body_${kernel}_raw}")
+  set(strong "${body_${kernel}_strong}")
+  if(strong STREQUAL raw)
+    message(STATUS "${kernel}: identical")
+    continue()
+  endif()
+  canonical_form("${raw}" raw_canonical)
+  canonical_form("${strong}" strong_canonical)
+  if(strong_canonical STREQUAL raw_canonical)
+    message(STATUS "${kernel}: identical after normalization")
+    continue()
+  endif()
+  math(EXPR mismatches "${mismatches} + 1")
+  message(SEND_ERROR
+    "${kernel}: instruction streams differ\n"
+    "--- ${kernel}_raw\n${raw}"
+    "--- ${kernel}_strong\n${strong}")
+endforeach()
+
+if(pairs EQUAL 0)
+  message(FATAL_ERROR "No <name>_raw/<name>_strong kernel pairs found.")
+endif()
+if(mismatches GREATER 0)
+  message(FATAL_ERROR "${mismatches} of ${pairs} kernel pairs differ.")
+endif()
+message(STATUS "All ${pairs} kernel pairs compile to the same code.")
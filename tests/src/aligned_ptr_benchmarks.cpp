@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+#include "strong_type/aligned_ptr.h"
+
+// a[i] * b[i] + c[i] over 64-byte aligned buffers: plain pointers ("raw"),
+// strong::restrict_ptr with 64-byte alignment ("strong") and plain pointers
+// with hand-written __restrict and __builtin_assume_aligned ("restrict").
+// Strong is expected to be faster than raw, since raw needs run-time overlap
+// checks and unaligned loads.
+
+namespace
+{
+using Input = strong::restrict_ptr<struct InputTag, const float, 64>;
+using Output = strong::restrict_ptr<struct OutputTag, float, 64>;
+
+struct free_deleter
+{
+    void operator()(float *aPointer) const noexcept { std::free(aPointer); }
+};
+
+using buffer = std::unique_ptr<float[], free_deleter>;
+
+buffer make_buffer(std::size_t aCount, float aValue)
+{
+    const std::size_t bytes = (aCount * sizeof(float) + 63) / 64 * 64;
+    buffer result(static_cast<float *>(std::aligned_alloc(64, bytes)));
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        result[i] = aValue + static_cast<float>(i % 7);
+    }
+    return result;
+}
+
+void fma_raw(float *aOut, const float *aLhs, const float *aRhs,
+             const float *aAddend, std::size_t aCount)
+{
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        aOut[i] = aLhs[i] * aRhs[i] + aAddend[i];
+    }
+}
+
+void fma_strong(Output aOut, Input aLhs, Input aRhs, Input aAddend,
+                std::size_t aCount)
+{
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        aOut[i] = aLhs[i] * aRhs[i] + aAddend[i];
+    }
+}
+
+void fma_restrict(float *__restrict aOut, const float *__restrict aLhs,
+                  const float *__restrict aRhs,
+                  const float *__restrict aAddend, std::size_t aCount)
+{
+    aOut = static_cast<float *>(__builtin_assume_aligned(aOut, 64));
+    aLhs = static_cast<const float *>(__builtin_assume_aligned(aLhs, 64));
+    aRhs = static_cast<const float *>(__builtin_assume_aligned(aRhs, 64));
+    aAddend =
+        static_cast<const float *>(__builtin_assume_aligned(aAddend, 64));
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        aOut[i] = aLhs[i] * aRhs[i] + aAddend[i];
+    }
+}
+
+enum class variant
+{
+    raw,
+    strong,
+    restricted
+};
+
+template <variant V>
+void BM_PointerFma(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto lhs = make_buffer(count, 1.0f);
+    const auto rhs = make_buffer(count, 2.0f);
+    const auto addend = make_buffer(count, 3.0f);
+    auto out = make_buffer(count, 0.0f);
+    for (auto _: aState)
+    {
+        float *outPtr = out.get();
+        const float *lhsPtr = lhs.get();
+        const float *rhsPtr = rhs.get();
+        const float *addendPtr = addend.get();
+        benchmark::DoNotOptimize(outPtr);
+        benchmark::DoNotOptimize(lhsPtr);
+        benchmark::DoNotOptimize(rhsPtr);
+        benchmark::DoNotOptimize(addendPtr);
+        if constexpr (V == variant::raw)
+        {
+            fma_raw(outPtr, lhsPtr, rhsPtr, addendPtr, count);
+        }
+        else if constexpr (V == variant::strong)
+        {
+            fma_strong(Output(outPtr), Input(lhsPtr), Input(rhsPtr),
+                       Input(addendPtr), count);
+        }
+        else
+        {
+            fma_restrict(outPtr, lhsPtr, rhsPtr, addendPtr, count);
+        }
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+constexpr std::int64_t kSmall = 1 << 10;
+constexpr std::int64_t kLarge = 1 << 16;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PointerFma, variant::raw)
+    ->Name("ratio/BM_PointerFma/raw")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_PointerFma, variant::strong)
+    ->Name("ratio/BM_PointerFma/strong")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_PointerFma, variant::restricted)
+    ->Name("BM_PointerFma/restrict")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
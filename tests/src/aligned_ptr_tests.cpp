@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "strong_type/aligned_ptr.h"
+
+namespace
+{
+using Samples = strong::aligned_ptr<struct SamplesTag, float, 32>;
+using ConstSamples = strong::aligned_ptr<struct SamplesTag, const float, 32>;
+using Output = strong::restrict_ptr<struct OutputTag, float>;
+using Input = strong::restrict_ptr<struct InputTag, const float, 32>;
+
+struct alignas(32) block
+{
+    float values[16];
+};
+
+// Kernel with non-aliasing arguments, see codegen_pointer_kernels.cpp for
+// its instructions.
+void add(Output aOut, Input aLhs, Input aRhs, std::size_t aCount)
+{
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        aOut[i] = aLhs[i] + aRhs[i];
+    }
+}
+}  // namespace
+
+TEST(AlignedPtrTests, LayoutOfPointer)
+{
+    static_assert(sizeof(Samples) == sizeof(float *));
+    static_assert(sizeof(Output) == sizeof(float *));
+    static_assert(std::is_trivially_copyable_v<Output>);
+    static_assert(strong::details::pointee_alignment_v<
+                      strong::tag_type<Samples>> == 32);
+    static_assert(strong::details::pointee_alignment_v<
+                      strong::tag_type<Output>> == alignof(float));
+    static_assert(strong::details::pointee_alignment_v<struct SamplesTag> ==
+                  0);
+    static_assert(
+        !std::is_same_v<Samples,
+                        strong::aligned_ptr<struct SamplesTag, float, 16>>,
+        "Alignment must be part of the type.");
+    static_assert(!std::is_convertible_v<float *, Samples>);
+}
+
+TEST(AlignedPtrTests, AccessAndArithmetic)
+{
+    block data{};
+    for (int i = 0; i < 16; ++i)
+    {
+        data.values[i] = static_cast<float>(i);
+    }
+    Samples samples(data.values);
+    ASSERT_FLOAT_EQ(*samples, 0.0f);
+    ASSERT_FLOAT_EQ(samples[5], 5.0f);
+    samples[5] = 50.0f;
+    ASSERT_FLOAT_EQ(data.values[5], 50.0f);
+
+    const Samples second = samples + 8;
+    ASSERT_FLOAT_EQ(*second, 8.0f);
+    ASSERT_EQ(second - samples, 8);
+    ASSERT_TRUE(samples < second);
+    ASSERT_EQ(second - 8, samples);
+    Samples moving = samples;
+    moving += 8;
+    ASSERT_EQ(moving, second);
+    moving -= 8;
+    ASSERT_EQ(moving, samples);
+
+    const ConstSamples readOnly(data.values);
+    ASSERT_FLOAT_EQ(readOnly[15], 15.0f);
+}
+
+TEST(AlignedPtrTests, RestrictKernel)
+{
+    block lhs{};
+    block rhs{};
+    float out[17] = {};
+    for (int i = 0; i < 16; ++i)
+    {
+        lhs.values[i] = static_cast<float>(i);
+        rhs.values[i] = static_cast<float>(2 * i);
+    }
+    add(Output(out + 1), Input(lhs.values), Input(rhs.values), 16);
+    ASSERT_FLOAT_EQ(out[0], 0.0f);
+    for (int i = 0; i < 16; ++i)
+    {
+        ASSERT_FLOAT_EQ(out[i + 1], static_cast<float>(3 * i));
+    }
+}
+
+#ifndef NDEBUG
+TEST(AlignedPtrTests, MisalignedAccessAsserts)
+{
+    block data{};
+    const Samples samples(data.values);
+    ASSERT_DEATH(static_cast<void>(*(samples + 1)), "aligned");
+    ASSERT_DEATH(static_cast<void>(Samples(data.values + 1)[0]), "aligned");
+}
+#endif
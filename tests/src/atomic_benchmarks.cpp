@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+
+#include "strong_type/atomic.h"
+
+// Relaxed increments of strong::atomic counters from several threads: one
+// shared counter, per-thread counters packed next to each other (false
+// sharing) and per-thread padded_atomic counters.
+
+namespace
+{
+using Counter =
+    strong::strong_type<struct CounterTag, std::uint64_t, strong::plus>;
+
+constexpr int kMaxThreads = 16;
+constexpr int kIncrements = 1 << 12;
+
+strong::atomic<Counter> gShared;
+strong::atomic<Counter> gPacked[kMaxThreads];
+strong::padded_atomic<Counter> gPadded[kMaxThreads];
+
+enum class layout
+{
+    shared,
+    packed,
+    padded
+};
+
+strong::atomic<Counter> &counter_for(layout aLayout, int aThread)
+{
+    switch (aLayout)
+    {
+        case layout::shared:
+            return gShared;
+        case layout::packed:
+            return gPacked[aThread];
+        default:
+            return gPadded[aThread];
+    }
+}
+
+void BM_AtomicIncrement(benchmark::State &aState, layout aLayout)
+{
+    auto &counter = counter_for(aLayout, aState.thread_index());
+    for (auto _: aState)
+    {
+        for (int i = 0; i < kIncrements; ++i)
+        {
+            counter.fetch_add(Counter{1}, std::memory_order_relaxed);
+        }
+    }
+    aState.SetItemsProcessed(aState.iterations() * kIncrements);
+}
+
+void threads(benchmark::internal::Benchmark *aBenchmark)
+{
+    for (int count = 1; count <= kMaxThreads; count *= 2)
+    {
+        aBenchmark->Threads(count);
+    }
+    aBenchmark->UseRealTime();
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_AtomicIncrement, shared, layout::shared)->Apply(threads);
+BENCHMARK_CAPTURE(BM_AtomicIncrement, packed, layout::packed)->Apply(threads);
+BENCHMARK_CAPTURE(BM_AtomicIncrement, padded, layout::padded)->Apply(threads);
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "strong_type/atomic.h"
+
+namespace
+{
+using Counter = strong::strong_type<struct CounterTag, std::uint64_t,
+                                    strong::plus, strong::minus,
+                                    strong::comparisons>;
+using Flags = strong::strong_type<struct FlagsTag, std::uint32_t,
+                                  strong::bitwise_and, strong::bitwise_or,
+                                  strong::bitwise_xor>;
+using Handle = strong::strong_type<struct HandleTag, std::uint32_t>;
+
+template <typename AtomicT, typename = void>
+struct has_fetch_add : std::false_type
+{
+};
+
+template <typename AtomicT>
+struct has_fetch_add<AtomicT,
+                     std::void_t<decltype(std::declval<AtomicT &>().fetch_add(
+                         std::declval<typename AtomicT::value_type>(),
+                         std::memory_order_relaxed))>> : std::true_type
+{
+};
+
+template <typename AtomicT, typename = void>
+struct has_fetch_or : std::false_type
+{
+};
+
+template <typename AtomicT>
+struct has_fetch_or<AtomicT,
+                    std::void_t<decltype(std::declval<AtomicT &>().fetch_or(
+                        std::declval<typename AtomicT::value_type>(),
+                        std::memory_order_relaxed))>> : std::true_type
+{
+};
+
+template <typename AtomicT, typename = void>
+struct has_compare_exchange : std::false_type
+{
+};
+
+template <typename AtomicT>
+struct has_compare_exchange<
+    AtomicT,
+    std::void_t<decltype(std::declval<AtomicT &>().compare_exchange_strong(
+        std::declval<typename AtomicT::value_type &>(),
+        std::declval<typename AtomicT::value_type>(),
+        std::memory_order_relaxed, std::memory_order_relaxed))>>
+    : std::true_type
+{
+};
+}  // namespace
+
+TEST(AtomicTests, OperationsFollowMixins)
+{
+    static_assert(has_fetch_add<strong::atomic<Counter>>::value,
+                  "fetch_add must be available with plus.");
+    static_assert(!has_fetch_or<strong::atomic<Counter>>::value,
+                  "fetch_or must not be available without bitwise_or.");
+    static_assert(has_compare_exchange<strong::atomic<Counter>>::value,
+                  "CAS must be available with comparisons.");
+    static_assert(has_fetch_or<strong::atomic<Flags>>::value,
+                  "fetch_or must be available with bitwise_or.");
+    static_assert(!has_fetch_add<strong::atomic<Flags>>::value,
+                  "fetch_add must not be available without plus.");
+    static_assert(!has_compare_exchange<strong::atomic<Flags>>::value,
+                  "CAS must not be available without comparisons.");
+    static_assert(!has_fetch_add<strong::atomic<Handle>>::value,
+                  "fetch_add must not be available without plus.");
+}
+
+TEST(AtomicTests, LayoutMatchesStdAtomic)
+{
+    static_assert(sizeof(strong::atomic<Counter>) ==
+                      sizeof(std::atomic<std::uint64_t>),
+                  "strong::atomic must not add storage.");
+    static_assert(strong::atomic<Counter>::is_always_lock_free ==
+                      std::atomic<std::uint64_t>::is_always_lock_free,
+                  "strong::atomic must be lock-free like std::atomic.");
+    static_assert(sizeof(strong::padded_atomic<Counter>) ==
+                      strong::cache_line_size,
+                  "padded_atomic must occupy a cache line.");
+    static_assert(alignof(strong::padded_atomic<Counter>) ==
+                      strong::cache_line_size,
+                  "padded_atomic must be aligned to a cache line.");
+    const strong::atomic<Counter> counter;
+    ASSERT_EQ(counter.is_lock_free(),
+              std::atomic<std::uint64_t>{}.is_lock_free());
+}
+
+TEST(AtomicTests, SingleThreadOperations)
+{
+    strong::atomic<Counter> counter(Counter{10});
+    ASSERT_EQ(counter.load(std::memory_order_relaxed), Counter{10});
+    ASSERT_EQ(counter.fetch_add(Counter{5}, std::memory_order_relaxed),
+              Counter{10});
+    ASSERT_EQ(counter.fetch_sub(Counter{3}, std::memory_order_relaxed),
+              Counter{15});
+    ASSERT_EQ(counter.exchange(Counter{1}, std::memory_order_relaxed),
+              Counter{12});
+
+    Counter expected{2};
+    ASSERT_FALSE(counter.compare_exchange_strong(expected, Counter{7},
+                                                 std::memory_order_relaxed,
+                                                 std::memory_order_relaxed));
+    ASSERT_EQ(expected, Counter{1});
+    ASSERT_TRUE(counter.compare_exchange_strong(expected, Counter{7},
+                                                std::memory_order_relaxed,
+                                                std::memory_order_relaxed));
+    ASSERT_EQ(counter.load(std::memory_order_relaxed), Counter{7});
+
+    strong::atomic<Flags> flags;
+    flags.store(Flags{0b1100}, std::memory_order_relaxed);
+    flags.fetch_or(Flags{0b0011}, std::memory_order_relaxed);
+    flags.fetch_and(Flags{0b0110}, std::memory_order_relaxed);
+    flags.fetch_xor(Flags{0b0101}, std::memory_order_relaxed);
+    ASSERT_EQ(flags.load(std::memory_order_relaxed).get(), 0b0011u);
+}
+
+TEST(AtomicTests, ConcurrentIncrements)
+{
+    constexpr std::size_t kThreads = 4;
+    constexpr std::uint64_t kIncrements = 10000;
+    strong::atomic<Counter> shared;
+    std::vector<strong::padded_atomic<Counter>> perThread(kThreads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back(
+            [&shared, &perThread, t]
+            {
+                for (std::uint64_t i = 0; i < kIncrements; ++i)
+                {
+                    shared.fetch_add(Counter{1}, std::memory_order_relaxed);
+                    perThread[t].fetch_add(Counter{1},
+                                           std::memory_order_relaxed);
+                    Counter expected = shared.load(std::memory_order_relaxed);
+                    while (!shared.compare_exchange_weak(
+                        expected, expected + Counter{1},
+                        std::memory_order_relaxed, std::memory_order_relaxed))
+                    {
+                    }
+                }
+            });
+    }
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(shared.load(std::memory_order_relaxed),
+              Counter{2 * kThreads * kIncrements});
+    for (const auto &counter: perThread)
+    {
+        ASSERT_EQ(counter.load(std::memory_order_relaxed),
+                  Counter{kIncrements});
+    }
+}
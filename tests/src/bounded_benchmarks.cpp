@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+#include "strong_type/bounded.h"
+
+// Weighted average (3 * a + b) / 4 of percentages: raw int32_t ("raw"),
+// strong::bounded with bounded_arithmetic ("strong") and a strong type with
+// checked_plus and checked_multiplication whose result is checked to be a
+// percentage again ("checked"). Bounds prove that nothing overflows and
+// that the result is a percentage, so the strong loop has no checks, and its
+// division is a shift since values are non-negative.
+
+namespace
+{
+using Percent = strong::bounded<struct PercentTag, int32_t, 0, 100,
+                                strong::bounded_arithmetic>;
+
+using CheckedPercent =
+    strong::strong_type<struct CheckedPercentTag, int32_t,
+                        strong::checked_plus, strong::checked_multiplication>;
+
+void average_raw(const int32_t *aLhs, const int32_t *aRhs, int32_t *aOut,
+                 std::size_t aCount)
+{
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        aOut[i] = (3 * aLhs[i] + aRhs[i]) / 4;
+    }
+}
+
+void average_strong(const Percent *aLhs, const Percent *aRhs, Percent *aOut,
+                    std::size_t aCount)
+{
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        aOut[i] = strong::bounded_cast<Percent>(
+            (aLhs[i] * strong::constant<3> + aRhs[i]) / strong::constant<4>);
+    }
+}
+
+void average_checked(const CheckedPercent *aLhs, const CheckedPercent *aRhs,
+                     CheckedPercent *aOut, std::size_t aCount)
+{
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        const int32_t value =
+            (aLhs[i] * CheckedPercent{3} + aRhs[i]).get() / 4;
+        if (value < 0 || value > 100)
+        {
+            std::abort();
+        }
+        aOut[i] = CheckedPercent{value};
+    }
+}
+
+enum class variant
+{
+    raw,
+    strong,
+    checked
+};
+
+template <typename T>
+std::vector<T> make_percentages(std::size_t aCount, std::size_t aSeed)
+{
+    std::vector<T> result;
+    result.reserve(aCount);
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        result.emplace_back(static_cast<int32_t>((i * aSeed + 7) % 101));
+    }
+    return result;
+}
+
+template <variant V>
+void BM_BoundedAverage(benchmark::State &aState)
+{
+    using value_type = std::conditional_t<
+        V == variant::raw, int32_t,
+        std::conditional_t<V == variant::strong, Percent, CheckedPercent>>;
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto lhs = make_percentages<value_type>(count, 13);
+    const auto rhs = make_percentages<value_type>(count, 29);
+    auto out = make_percentages<value_type>(count, 1);
+    for (auto _: aState)
+    {
+        const value_type *lhsPtr = lhs.data();
+        const value_type *rhsPtr = rhs.data();
+        value_type *outPtr = out.data();
+        benchmark::DoNotOptimize(lhsPtr);
+        benchmark::DoNotOptimize(rhsPtr);
+        benchmark::DoNotOptimize(outPtr);
+        if constexpr (V == variant::raw)
+        {
+            average_raw(lhsPtr, rhsPtr, outPtr, count);
+        }
+        else if constexpr (V == variant::strong)
+        {
+            average_strong(lhsPtr, rhsPtr, outPtr, count);
+        }
+        else
+        {
+            average_checked(lhsPtr, rhsPtr, outPtr, count);
+        }
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+constexpr std::int64_t kSmall = 1 << 10;
+constexpr std::int64_t kLarge = 1 << 16;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_BoundedAverage, variant::raw)
+    ->Name("ratio/BM_BoundedAverage/raw")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_BoundedAverage, variant::strong)
+    ->Name("ratio/BM_BoundedAverage/strong")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_BoundedAverage, variant::checked)
+    ->Name("BM_BoundedAverage/checked")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "strong_type/bounded.h"
+
+namespace
+{
+using Percent = strong::bounded<struct PercentTag, int32_t, 0, 100,
+                                strong::bounded_arithmetic,
+                                strong::comparisons>;
+
+using Shard = strong::bounded<struct ShardTag, uint32_t, 0, 15,
+                              strong::bounded_arithmetic, strong::modulo>;
+
+using Level = strong::bounded<struct LevelTag, int8_t, -100, 100,
+                              strong::bounded_arithmetic>;
+
+using Port = strong::bounded<struct PortTag, uint16_t, 1, 65535>;
+
+// Tags of plain strong types that happen to have min and max members.
+struct RangeTag
+{
+    static constexpr long min = 0;
+    static constexpr long max = 10;
+};
+
+struct LimitsTag
+{
+    static int min();
+    static int max();
+};
+
+// Bounds of the bounded type of an expression.
+template <typename StrongT>
+constexpr auto kBounds =
+    std::make_pair(strong::tag_type<std::remove_const_t<StrongT>>::min,
+                   strong::tag_type<std::remove_const_t<StrongT>>::max);
+}  // namespace
+
+TEST(BoundedTests, Construction)
+{
+    static_assert(strong::is_bounded_v<Percent>);
+    static_assert(!strong::is_bounded_v<int32_t>);
+    static_assert(sizeof(Percent) == sizeof(int32_t));
+    static_assert(std::is_trivially_copyable_v<Percent>);
+
+    constexpr Percent kHalf{50};
+    static_assert(kHalf.get() == 50);
+    static_assert(Percent{0}.get() == 0 && Percent{100}.get() == 100);
+
+    const int32_t tooMuch = 101;
+    ASSERT_DEATH(static_cast<void>(Percent{tooMuch}), "");
+    ASSERT_DEATH(static_cast<void>(Percent{-1}), "");
+}
+
+TEST(BoundedTests, DefaultConstructionNeedsDefaultInRange)
+{
+    static_assert(std::is_trivially_default_constructible_v<Percent>);
+    static_assert(std::is_trivially_default_constructible_v<Level>);
+    static_assert(!std::is_default_constructible_v<Port>);
+    static_assert(std::is_trivially_copyable_v<Port>);
+    static_assert(sizeof(Port) == sizeof(uint16_t));
+    static_assert(Port{80}.get() == 80);
+}
+
+TEST(BoundedTests, OnlyBoundedTagsHaveBounds)
+{
+    using Range = strong::strong_type<RangeTag, int>;
+    using Limits = strong::strong_type<LimitsTag, int>;
+    static_assert(!strong::details::has_bounds_v<RangeTag>);
+    static_assert(!strong::details::has_bounds_v<LimitsTag>);
+    static_assert(!std::is_constructible_v<
+                  Range, strong::details::unchecked_t, int>);
+    static_assert(
+        std::is_constructible_v<Port, strong::details::unchecked_t, uint16_t>);
+    ASSERT_EQ(Range{42}.get(), 42);
+    ASSERT_EQ(Limits{-1}.get(), -1);
+}
+
+TEST(BoundedTests, ResultBounds)
+{
+    constexpr Percent kLhs{30};
+    constexpr Percent kRhs{90};
+
+    constexpr auto kSum = kLhs + kRhs;
+    static_assert(kSum.get() == 120);
+    static_assert(kBounds<decltype(kSum)> == std::make_pair(0, 200));
+
+    constexpr auto kDifference = kLhs - kRhs;
+    static_assert(kDifference.get() == -60);
+    static_assert(kBounds<decltype(kDifference)> ==
+                  std::make_pair(-100, 100));
+
+    constexpr auto kProduct = kLhs * strong::constant<-3>;
+    static_assert(kProduct.get() == -90);
+    static_assert(kBounds<decltype(kProduct)> == std::make_pair(-300, 0));
+
+    constexpr auto kAverage = (kLhs + kRhs) / strong::constant<2>;
+    static_assert(kAverage.get() == 60);
+    static_assert(kBounds<decltype(kAverage)> == std::make_pair(0, 100));
+
+    constexpr auto kRemainder = kRhs % strong::constant<7>;
+    static_assert(kRemainder.get() == 6);
+    static_assert(kBounds<decltype(kRemainder)> == std::make_pair(0, 6));
+
+    constexpr auto kNegative = kDifference % strong::constant<7>;
+    static_assert(kNegative.get() == -4);
+    static_assert(kBounds<decltype(kNegative)> == std::make_pair(-6, 6));
+
+    // Results keep the Tag: they are not Percent, but convert back to it.
+    static_assert(!std::is_same_v<std::remove_const_t<decltype(kSum)>,
+                                  Percent>);
+    static_assert(strong::bounded_cast<Percent>(kAverage) == Percent{60});
+    static_assert(strong::bounded_clamp<Percent>(kSum) == Percent{100});
+    static_assert(strong::bounded_clamp<Percent>(kDifference) == Percent{0});
+}
+
+TEST(BoundedTests, RemainderOfSmallerValueIsTheValue)
+{
+    constexpr Shard kShard{9};
+    constexpr auto kSame = kShard % strong::constant<16u>;
+    static_assert(
+        std::is_same_v<std::remove_const_t<decltype(kSame)>, Shard>);
+    static_assert(kSame.get() == 9);
+    static_assert((kShard % 16u).get() == 9);
+    static_assert((kShard % strong::constant<4u>).get() == 1);
+}
+
+TEST(BoundedTests, OverflowIsCheckedOnlyIfPossible)
+{
+    // [-100, 100] * [-100, 100] does not fit in int8_t: the bounds are
+    // clamped and the product is checked.
+    constexpr Level kLevel{100};
+    static_assert(kBounds<decltype(kLevel * kLevel)> ==
+                  std::make_pair(int8_t{-128}, int8_t{127}));
+    static_assert((Level{10} * Level{-12}).get() == -120);
+    ASSERT_DEATH(static_cast<void>(kLevel * kLevel), "");
+
+    // [-100, 100] + 27 fits.
+    constexpr auto kRaised = kLevel + strong::constant<27>;
+    static_assert(kBounds<decltype(kRaised)> ==
+                  std::make_pair(int8_t{-73}, int8_t{127}));
+    static_assert(kRaised.get() == 127);
+}
+
+TEST(BoundedTests, NarrowingCastsAreChecked)
+{
+    const Percent lhs{80};
+    const auto sum = lhs + lhs;
+    ASSERT_EQ(sum.get(), 160);
+    ASSERT_DEATH(static_cast<void>(strong::bounded_cast<Percent>(sum)), "");
+    ASSERT_EQ(strong::bounded_clamp<Percent>(sum), Percent{100});
+}
+
+TEST(BoundedTests, InPlaceOperationsAreRejected)
+{
+    // Bounded types with these operations do not compile, see
+    // compile_fail/bounded_in_place.cpp.
+    static_assert(strong::details::writes_in_place_v<strong::plus_assignment>);
+    static_assert(strong::details::writes_in_place_v<strong::pre_increment>);
+    static_assert(strong::details::writes_in_place_v<strong::post_decrement>);
+    static_assert(strong::details::writes_in_place_v<
+                  strong::bitwise_left_shift_assignment>);
+    static_assert(!strong::details::writes_in_place_v<strong::plus>);
+    static_assert(
+        !strong::details::writes_in_place_v<strong::bounded_arithmetic>);
+
+    // Plain strong types keep them.
+    using Counter = strong::strong_type<struct CounterTag, int32_t,
+                                        strong::plus_assignment,
+                                        strong::pre_increment>;
+    Counter counter{1};
+    counter += Counter{2};
+    ASSERT_EQ((++counter).get(), 4);
+}
+
+#ifndef NDEBUG
+TEST(BoundedTests, OutOfBoundsWritesAssert)
+{
+    Percent percent{10};
+    percent.get() = 101;
+    ASSERT_DEATH(static_cast<void>(percent.get()), "bounds");
+}
+#endif
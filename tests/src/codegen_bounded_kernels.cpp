@@ -0,0 +1,115 @@
+// Paired kernels of strong::bounded for the codegen regression test: checks
+// that the bounds make redundant must disappear, so the kernels compile to
+// the same instructions as unchecked raw arithmetic, written the way one
+// would write it knowing the ranges. Binary kernels load their operands
+// first, see codegen_kernels.cpp.
+
+#include <cstddef>
+#include <cstdint>
+
+#include "strong_type/bounded.h"
+
+namespace
+{
+using Hash = strong::strong_type<struct HashTag, uint32_t>;
+
+using Shard = strong::bounded<struct ShardTag, uint32_t, 0, 15,
+                              strong::bounded_arithmetic, strong::modulo>;
+
+using Percent =
+    strong::bounded<struct PercentTag, int32_t, 0, 100,
+                    strong::bounded_arithmetic>;
+using PercentSum =
+    strong::bounded<struct PercentTag, int32_t, 0, 200,
+                    strong::bounded_arithmetic>;
+
+using Port = strong::bounded<struct PortTag, uint16_t, 1, 65535>;
+}  // namespace
+
+extern "C"
+{
+    // Construction check of a value that is in range by construction.
+    uint32_t codegen_bounded_shard_of_raw(uint32_t aHash)
+    {
+        return aHash % 16;
+    }
+
+    Shard codegen_bounded_shard_of_strong(Hash aHash)
+    {
+        return Shard(aHash.get() % 16);
+    }
+
+    // Remainder of a shard by the number of shards is the shard.
+    uint32_t codegen_bounded_shard_modulo_raw(uint32_t aShard)
+    {
+        return aShard;
+    }
+
+    Shard codegen_bounded_shard_modulo_strong(Shard aShard)
+    {
+        return aShard % strong::constant<16u>;
+    }
+
+    // The sum of two percentages cannot overflow: no overflow check, and no
+    // check of the bounds of the result.
+    void codegen_bounded_add_raw(int32_t const *aLhs, int32_t const *aRhs,
+                                 int32_t *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aOut[i] = aLhs[i] + aRhs[i];
+        }
+    }
+
+    void codegen_bounded_add_strong(Percent const *aLhs, Percent const *aRhs,
+                                    PercentSum *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aOut[i] = aLhs[i] + aRhs[i];
+        }
+    }
+
+    // Quotients of non-negative values need no rounding correction of
+    // signed division: the average is an unsigned shift.
+    void codegen_bounded_average_raw(int32_t const *aLhs,
+                                     int32_t const *aRhs, int32_t *aOut,
+                                     std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            const int32_t lhs = aLhs[i];
+            const int32_t rhs = aRhs[i];
+            aOut[i] =
+                static_cast<int32_t>(static_cast<uint32_t>(lhs + rhs) >> 1);
+        }
+    }
+
+    void codegen_bounded_average_strong(Percent const *aLhs,
+                                        Percent const *aRhs, Percent *aOut,
+                                        std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            const Percent lhs = aLhs[i];
+            const Percent rhs = aRhs[i];
+            aOut[i] = strong::bounded_cast<Percent>((lhs + rhs) /
+                                                    strong::constant<2>);
+        }
+    }
+
+    // Reads pass the bounds to the optimizer: a port is never 0. Only
+    // compilers with STRONG_TYPE_HAS_ASSUME do that, so GCC before 13 does
+    // not build (nor check) this pair.
+#if STRONG_TYPE_HAS_ASSUME
+    bool codegen_bounded_port_is_set_raw(uint16_t)
+    {
+        return true;
+    }
+
+    bool codegen_bounded_port_is_set_strong(Port aPort)
+    {
+        return aPort.get() != 0;
+    }
+#endif
+}
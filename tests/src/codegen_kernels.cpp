@@ -0,0 +1,326 @@
+// Paired kernels for the codegen regression test. Every function named
+// codegen_<name>_strong must compile to exactly the same instructions as its
+// twin codegen_<name>_raw. Kernels have C linkage so that their symbol names
+// are stable across compilers, and operate on arrays because that is where
+// abstraction overhead matters.
+//
+// Binary kernels load both operands before applying the operator. An
+// overloaded operator is a function call, and GCC evaluates its arguments
+// right to left, so aLhs[i] + aRhs[i] computes the addresses of the operands
+// in the opposite order to the built-in operator. That reorders run-time
+// overlap checks of the vectorized loops but says nothing about the cost of
+// strong_type.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "strong_type/strong_type.h"
+
+namespace
+{
+using Number = strong::strong_type<
+    struct NumberTag, std::uint32_t, strong::assignment, strong::comparisons,
+    strong::plus, strong::plus_assignment, strong::minus,
+    strong::multiplication, strong::pre_increment>;
+
+using Signed = strong::strong_type<struct SignedTag, std::int32_t,
+                                   strong::unary_minus, strong::division,
+                                   strong::modulo>;
+
+using Pointer = strong::strong_type<
+    struct PointerTag, std::uint32_t const *, strong::subscription,
+    strong::indirection, strong::pointer_plus_assignment,
+    strong::pointer_minus_pointer, strong::comparisons>;
+}  // namespace
+
+extern "C"
+{
+    void codegen_plus_raw(std::uint32_t const *aLhs, std::uint32_t const *aRhs,
+                          std::uint32_t *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            const std::uint32_t lhs = aLhs[i];
+            const std::uint32_t rhs = aRhs[i];
+            aOut[i] = lhs + rhs;
+        }
+    }
+
+    void codegen_plus_strong(Number const *aLhs, Number const *aRhs,
+                             Number *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            const Number lhs = aLhs[i];
+            const Number rhs = aRhs[i];
+            aOut[i] = lhs + rhs;
+        }
+    }
+
+    void codegen_minus_raw(std::uint32_t const *aLhs,
+                           std::uint32_t const *aRhs, std::uint32_t *aOut,
+                           std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            const std::uint32_t lhs = aLhs[i];
+            const std::uint32_t rhs = aRhs[i];
+            aOut[i] = lhs - rhs;
+        }
+    }
+
+    void codegen_minus_strong(Number const *aLhs, Number const *aRhs,
+                              Number *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            const Number lhs = aLhs[i];
+            const Number rhs = aRhs[i];
+            aOut[i] = lhs - rhs;
+        }
+    }
+
+    void codegen_multiplication_raw(std::uint32_t const *aLhs,
+                                    std::uint32_t const *aRhs,
+                                    std::uint32_t *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            const std::uint32_t lhs = aLhs[i];
+            const std::uint32_t rhs = aRhs[i];
+            aOut[i] = lhs * rhs;
+        }
+    }
+
+    void codegen_multiplication_strong(Number const *aLhs, Number const *aRhs,
+                                       Number *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            const Number lhs = aLhs[i];
+            const Number rhs = aRhs[i];
+            aOut[i] = lhs * rhs;
+        }
+    }
+
+    std::size_t codegen_less_raw(std::uint32_t const *aLhs,
+                                 std::uint32_t const *aRhs, std::size_t aCount)
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            result += aLhs[i] < aRhs[i] ? 1u : 0u;
+        }
+        return result;
+    }
+
+    std::size_t codegen_less_strong(Number const *aLhs, Number const *aRhs,
+                                    std::size_t aCount)
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            result += aLhs[i] < aRhs[i] ? 1u : 0u;
+        }
+        return result;
+    }
+
+    std::size_t codegen_equal_raw(std::uint32_t const *aLhs,
+                                  std::uint32_t const *aRhs,
+                                  std::size_t aCount)
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            result += aLhs[i] == aRhs[i] ? 1u : 0u;
+        }
+        return result;
+    }
+
+    std::size_t codegen_equal_strong(Number const *aLhs, Number const *aRhs,
+                                     std::size_t aCount)
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            result += aLhs[i] == aRhs[i] ? 1u : 0u;
+        }
+        return result;
+    }
+
+    // A self-assignment check in operator= would show up here as a compare
+    // and a branch in every iteration.
+    void codegen_assignment_raw(std::uint32_t const *aSrc,
+                                std::uint32_t const *aIndices,
+                                std::uint32_t *aDst, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aDst[i] = aSrc[aIndices[i]];
+        }
+    }
+
+    void codegen_assignment_strong(Number const *aSrc,
+                                   std::uint32_t const *aIndices,
+                                   Number *aDst, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aDst[i] = aSrc[aIndices[i]];
+        }
+    }
+
+    // Copies of trivially copyable strong types take the memmove fast path.
+    void codegen_copy_raw(std::uint32_t const *aSrc, std::uint32_t *aDst,
+                          std::size_t aCount)
+    {
+        std::copy(aSrc, aSrc + aCount, aDst);
+    }
+
+    void codegen_copy_strong(Number const *aSrc, Number *aDst,
+                             std::size_t aCount)
+    {
+        std::copy(aSrc, aSrc + aCount, aDst);
+    }
+
+    void codegen_plus_assignment_raw(std::uint32_t const *aSrc,
+                                     std::uint32_t *aDst)
+    {
+        for (std::size_t i = 0; i < 1024; ++i)
+        {
+            *aDst += aSrc[i];
+        }
+    }
+
+    void codegen_plus_assignment_strong(Number const *aSrc, Number *aDst)
+    {
+        for (std::size_t i = 0; i < 1024; ++i)
+        {
+            *aDst += aSrc[i];
+        }
+    }
+
+    void codegen_pre_increment_raw(std::uint32_t *aValues, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            ++aValues[i];
+        }
+    }
+
+    void codegen_pre_increment_strong(Number *aValues, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            ++aValues[i];
+        }
+    }
+
+    void codegen_unary_minus_raw(std::int32_t *aValues, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aValues[i] = -aValues[i];
+        }
+    }
+
+    void codegen_unary_minus_strong(Signed *aValues, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aValues[i] = -aValues[i];
+        }
+    }
+
+    void codegen_division_raw(std::int32_t *aValues, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aValues[i] = aValues[i] / 7;
+        }
+    }
+
+    void codegen_division_strong(Signed *aValues, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aValues[i] = aValues[i] / 7;
+        }
+    }
+
+    void codegen_modulo_raw(std::int32_t *aValues, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aValues[i] = aValues[i] % 3;
+        }
+    }
+
+    void codegen_modulo_strong(Signed *aValues, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aValues[i] = aValues[i] % 3;
+        }
+    }
+
+    std::uint32_t codegen_subscription_raw(std::uint32_t const *aValues,
+                                           std::size_t aCount)
+    {
+        std::uint32_t sum = 0;
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            sum += aValues[i];
+        }
+        return sum;
+    }
+
+    std::uint32_t codegen_subscription_strong(std::uint32_t const *aValues,
+                                              std::size_t aCount)
+    {
+        Pointer ptr{aValues};
+        std::uint32_t sum = 0;
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            sum += ptr[i];
+        }
+        return sum;
+    }
+
+    std::uint32_t codegen_indirection_raw(std::uint32_t const *aFirst,
+                                          std::uint32_t const *aLast)
+    {
+        std::uint32_t sum = 0;
+        for (; aFirst != aLast; aFirst += 1)
+        {
+            sum += *aFirst;
+        }
+        return sum;
+    }
+
+    std::uint32_t codegen_indirection_strong(std::uint32_t const *aFirst,
+                                             std::uint32_t const *aLast)
+    {
+        Pointer first{aFirst};
+        const Pointer last{aLast};
+        std::uint32_t sum = 0;
+        for (; first != last; first += 1)
+        {
+            sum += *first;
+        }
+        return sum;
+    }
+
+    std::ptrdiff_t codegen_pointer_minus_pointer_raw(
+        std::uint32_t const *aFirst, std::uint32_t const *aLast)
+    {
+        return aLast - aFirst;
+    }
+
+    std::ptrdiff_t codegen_pointer_minus_pointer_strong(
+        std::uint32_t const *aFirst, std::uint32_t const *aLast)
+    {
+        return Pointer{aLast} - Pointer{aFirst};
+    }
+}
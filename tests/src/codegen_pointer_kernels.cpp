@@ -0,0 +1,91 @@
+// Paired kernels of strong::aligned_ptr and strong::restrict_ptr for the
+// codegen regression test: loops over them must compile to the same
+// instructions as loops over raw pointers with hand-written __restrict
+// parameters and __builtin_assume_aligned, i.e. vectorize with aligned loads
+// and without run-time overlap checks.
+
+#include <cstddef>
+
+#include "strong_type/aligned_ptr.h"
+
+namespace
+{
+using Input = strong::restrict_ptr<struct InputTag, const float>;
+using Output = strong::restrict_ptr<struct OutputTag, float>;
+
+using Samples = strong::aligned_ptr<struct SamplesTag, float, 64>;
+
+using AlignedInput = strong::restrict_ptr<struct InputTag, const float, 64>;
+using AlignedOutput = strong::restrict_ptr<struct OutputTag, float, 64>;
+
+template <typename T>
+T* assume_aligned(T* aPointer)
+{
+    return static_cast<T*>(__builtin_assume_aligned(aPointer, 64));
+}
+}  // namespace
+
+extern "C"
+{
+    void codegen_restrict_add_raw(float *__restrict aOut,
+                                  float const *__restrict aLhs,
+                                  float const *__restrict aRhs,
+                                  std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aOut[i] = aLhs[i] + aRhs[i];
+        }
+    }
+
+    void codegen_restrict_add_strong(Output aOut, Input aLhs, Input aRhs,
+                                     std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aOut[i] = aLhs[i] + aRhs[i];
+        }
+    }
+
+    void codegen_aligned_scale_raw(float *aSamples, std::size_t aCount)
+    {
+        aSamples = assume_aligned(aSamples);
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aSamples[i] *= 3.0f;
+        }
+    }
+
+    void codegen_aligned_scale_strong(Samples aSamples, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aSamples[i] *= 3.0f;
+        }
+    }
+
+    void codegen_aligned_restrict_add_raw(float *__restrict aOut,
+                                          float const *__restrict aLhs,
+                                          float const *__restrict aRhs,
+                                          std::size_t aCount)
+    {
+        aOut = assume_aligned(aOut);
+        aLhs = assume_aligned(aLhs);
+        aRhs = assume_aligned(aRhs);
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aOut[i] = aLhs[i] + aRhs[i];
+        }
+    }
+
+    void codegen_aligned_restrict_add_strong(AlignedOutput aOut,
+                                             AlignedInput aLhs,
+                                             AlignedInput aRhs,
+                                             std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aOut[i] = aLhs[i] + aRhs[i];
+        }
+    }
+}
@@ -0,0 +1,96 @@
+// Paired kernels of strong::units for the codegen regression test: throughput
+// math over quantities must compile to the same instructions as the same
+// math over raw numbers with hand-written scale factors. Binary kernels load
+// their operands first, see codegen_kernels.cpp.
+
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+
+#include "strong_type/units.h"
+
+namespace
+{
+namespace u = strong::units;
+
+using Bytes = u::quantity<u::unit<u::data>, double>;
+using Nanoseconds = u::quantity<u::unit<u::time, std::nano>, double>;
+using BytesPerSecond =
+    u::quantity<u::unit<u::dimension<0, 0, -1, 1, 0>>, double>;
+
+using Milliseconds =
+    u::quantity<u::unit<u::time, std::milli>, std::uint64_t>;
+using Microseconds =
+    u::quantity<u::unit<u::time, std::micro>, std::uint64_t>;
+
+using Requests = u::quantity<u::unit<u::count>, std::uint64_t>;
+using Seconds = u::quantity<u::unit<u::time>, std::uint64_t>;
+using RequestsPerSecond =
+    u::quantity<u::unit<u::dimension<0, 0, -1, 0, 1>>, std::uint64_t>;
+}  // namespace
+
+extern "C"
+{
+    void codegen_units_throughput_raw(double const *aBytes,
+                                      double const *aNanoseconds,
+                                      double *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            const double bytes = aBytes[i];
+            const double nanoseconds = aNanoseconds[i];
+            aOut[i] = bytes / nanoseconds * 1000000000.0;
+        }
+    }
+
+    void codegen_units_throughput_strong(Bytes const *aBytes,
+                                         Nanoseconds const *aNanoseconds,
+                                         BytesPerSecond *aOut,
+                                         std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            const Bytes bytes = aBytes[i];
+            const Nanoseconds nanoseconds = aNanoseconds[i];
+            aOut[i] = u::quantity_cast<BytesPerSecond>(bytes / nanoseconds);
+        }
+    }
+
+    void codegen_units_scale_raw(std::uint64_t const *aIn,
+                                 std::uint64_t *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aOut[i] = aIn[i] * 1000;
+        }
+    }
+
+    void codegen_units_scale_strong(Milliseconds const *aIn,
+                                    Microseconds *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aOut[i] = u::quantity_cast<Microseconds>(aIn[i]);
+        }
+    }
+
+    void codegen_units_rate_raw(std::uint64_t const *aRates,
+                                std::uint64_t const *aSeconds,
+                                std::uint64_t *aOut, std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aOut[i] = aRates[i] * aSeconds[i];
+        }
+    }
+
+    void codegen_units_rate_strong(RequestsPerSecond const *aRates,
+                                   Seconds const *aSeconds, Requests *aOut,
+                                   std::size_t aCount)
+    {
+        for (std::size_t i = 0; i < aCount; ++i)
+        {
+            aOut[i] = aRates[i] * aSeconds[i];
+        }
+    }
+}
@@ -0,0 +1,14 @@
+// Must not compile: += would write an unchecked value into a bounded type.
+#include <cstdint>
+
+#include "strong_type/bounded.h"
+
+using Percent = strong::bounded<struct PercentTag, int32_t, 0, 100,
+                                strong::plus_assignment,
+                                strong::pre_increment>;
+
+Percent add(Percent aLhs, Percent aRhs)
+{
+    aLhs += aRhs;
+    return ++aLhs;
+}
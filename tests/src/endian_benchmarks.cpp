@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "strong_type/endian.h"
+
+// Conversion of an array of big-endian 32-bit fields to native values: a
+// hand-written byte swap of a raw buffer ("raw"), big_endian::load() in a
+// loop ("strong") and simd::load_native ("simd").
+
+namespace
+{
+using Length = strong::strong_type<struct LengthTag, std::uint32_t>;
+
+std::vector<unsigned char> make_buffer(std::size_t aCount)
+{
+    std::vector<unsigned char> bytes(aCount * sizeof(std::uint32_t));
+    std::uint32_t state = 1;
+    for (auto &byte: bytes)
+    {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<unsigned char>(state >> 24);
+    }
+    return bytes;
+}
+
+void BM_LoadBigEndianRaw(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto bytes = make_buffer(count);
+    std::vector<std::uint32_t> result(count);
+    for (auto _: aState)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::uint32_t value;
+            std::memcpy(&value, bytes.data() + i * sizeof(value),
+                        sizeof(value));
+            result[i] = (value >> 24) | ((value >> 8) & 0xFF00u) |
+                        ((value << 8) & 0xFF0000u) | (value << 24);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetBytesProcessed(aState.iterations() * aState.range(0) * 4);
+}
+
+void BM_LoadBigEndianStrong(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto bytes = make_buffer(count);
+    std::vector<strong::big_endian<Length>> fields(count);
+    std::memcpy(fields.data(), bytes.data(), bytes.size());
+    std::vector<Length> result(count);
+    for (auto _: aState)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result[i] = fields[i].load();
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetBytesProcessed(aState.iterations() * aState.range(0) * 4);
+}
+
+void BM_LoadBigEndianSimd(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto bytes = make_buffer(count);
+    std::vector<strong::big_endian<Length>> fields(count);
+    std::memcpy(fields.data(), bytes.data(), bytes.size());
+    std::vector<Length> result(count);
+    for (auto _: aState)
+    {
+        strong::simd::load_native(fields, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetBytesProcessed(aState.iterations() * aState.range(0) * 4);
+}
+
+constexpr std::int64_t kSmall = 1 << 10;
+constexpr std::int64_t kLarge = 1 << 18;
+}  // namespace
+
+BENCHMARK(BM_LoadBigEndianRaw)
+    ->Name("ratio/BM_LoadBigEndian/raw")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK(BM_LoadBigEndianStrong)
+    ->Name("ratio/BM_LoadBigEndian/strong")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK(BM_LoadBigEndianSimd)
+    ->Name("BM_LoadBigEndian/simd")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "simd_test_support.h"
+#include "strong_type/endian.h"
+
+namespace
+{
+using simd_test::kSizes;
+using simd_test::kTargets;
+using simd_test::make_values;
+
+using MessageType = strong::strong_type<struct MessageTypeTag, std::uint16_t,
+                                        strong::comparisons>;
+using Length = strong::strong_type<struct LengthTag, std::uint32_t,
+                                   strong::comparisons, strong::plus>;
+using Offset = strong::strong_type<struct OffsetTag, std::int64_t,
+                                   strong::comparisons>;
+using Price = strong::strong_type<struct PriceTag, double>;
+using Flag =
+    strong::strong_type<struct FlagTag, std::uint8_t, strong::comparisons>;
+
+// Header of a wire message laid over a byte buffer.
+struct header
+{
+    strong::big_endian<MessageType> type;
+    strong::big_endian<Length> length;
+    strong::little_endian<Offset> offset;
+};
+
+template <typename E>
+void check_bulk_conversions()
+{
+    using StrongT = typename E::value_type;
+    for (const auto target: kTargets)
+    {
+        if (!strong::simd::is_supported(target))
+        {
+            continue;
+        }
+        for (const auto size: kSizes)
+        {
+            const auto values = make_values<StrongT>(size, size + 1);
+            std::vector<E> stored(size);
+            strong::simd::store_native(values, stored, target);
+            std::vector<StrongT> loaded(size);
+            strong::simd::load_native(stored, loaded, target);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(stored[i].load(), values[i])
+                    << "target " << static_cast<int>(target) << ", size "
+                    << size << ", index " << i;
+                ASSERT_EQ(loaded[i], values[i])
+                    << "target " << static_cast<int>(target) << ", size "
+                    << size << ", index " << i;
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST(EndianTests, LayoutIsPacked)
+{
+    static_assert(sizeof(strong::big_endian<Length>) == sizeof(std::uint32_t));
+    static_assert(alignof(strong::big_endian<Length>) == 1);
+    static_assert(alignof(strong::little_endian<Offset>) == 1);
+    static_assert(std::is_trivially_copyable_v<strong::big_endian<Length>>);
+    static_assert(std::is_standard_layout_v<header>);
+    static_assert(sizeof(header) == 14, "Fields must not be padded.");
+}
+
+TEST(EndianTests, LoadReadsBytesInOrder)
+{
+    const unsigned char bytes[] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE,
+                                   0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80};
+    header message;
+    std::memcpy(&message, bytes, sizeof(message));
+    ASSERT_EQ(message.type.load(), MessageType{0x1234});
+    ASSERT_EQ(message.length.load(), Length{0x56789ABCu});
+    ASSERT_EQ(static_cast<Offset>(message.offset),
+              Offset{static_cast<std::int64_t>(0x800000000001F0DEu)});
+}
+
+TEST(EndianTests, StoreWritesBytesInOrder)
+{
+    header message;
+    message.type.store(MessageType{0x0102});
+    message.length.store(Length{0x03040506u});
+    message.offset.store(Offset{-2});
+    unsigned char bytes[sizeof(message)];
+    std::memcpy(bytes, &message, sizeof(message));
+    const unsigned char expected[] = {0x01, 0x02, 0x03, 0x04, 0x05,
+                                      0x06, 0xFE, 0xFF, 0xFF, 0xFF,
+                                      0xFF, 0xFF, 0xFF, 0xFF};
+    ASSERT_EQ(std::memcmp(bytes, expected, sizeof(bytes)), 0);
+
+    const strong::big_endian<Price> price(Price{1.5});
+    ASSERT_DOUBLE_EQ(price.load().get(), 1.5);
+    const strong::little_endian<Flag> flag(Flag{7});
+    ASSERT_EQ(flag.load(), Flag{7});
+}
+
+TEST(EndianTests, BulkConversions)
+{
+    check_bulk_conversions<strong::big_endian<MessageType>>();
+    check_bulk_conversions<strong::big_endian<Length>>();
+    check_bulk_conversions<strong::big_endian<Offset>>();
+    check_bulk_conversions<strong::big_endian<Flag>>();
+    check_bulk_conversions<strong::little_endian<Length>>();
+    check_bulk_conversions<strong::little_endian<Offset>>();
+}
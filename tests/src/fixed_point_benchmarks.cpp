@@ -0,0 +1,193 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "strong_type/fixed_point.h"
+
+// Q16.16 multiplication and division with round to nearest: hand-written
+// integer arithmetic ("raw"), strong::fixed_point ("strong"), the same
+// computation in double ("double") and strong::simd::fixed_multiply
+// ("simd").
+
+namespace
+{
+using Price = strong::fixed_point<struct PriceTag, std::int32_t, 16>;
+
+constexpr int kBits = 16;
+constexpr double kScale = 1 << kBits;
+
+// Values between -256 and 256 with 16 fraction bits.
+std::vector<std::int32_t> make_values(std::size_t aCount, std::uint32_t aSeed)
+{
+    std::vector<std::int32_t> values;
+    values.reserve(aCount);
+    std::uint32_t state = aSeed;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        state = state * 1664525u + 1013904223u;
+        values.push_back(static_cast<std::int32_t>(state) >> 7);
+    }
+    return values;
+}
+
+// Divisors are at least 1.0 in magnitude, so quotients fit Q16.16.
+std::vector<std::int32_t> make_divisors(std::size_t aCount,
+                                        std::uint32_t aSeed)
+{
+    auto values = make_values(aCount, aSeed);
+    for (auto &value: values)
+    {
+        value = value < 0 ? value - (1 << kBits) : value + (1 << kBits);
+    }
+    return values;
+}
+
+template <typename T>
+std::vector<T> convert(const std::vector<std::int32_t> &aValues)
+{
+    std::vector<T> result;
+    result.reserve(aValues.size());
+    for (const auto value: aValues)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            result.push_back(static_cast<T>(value) / kScale);
+        }
+        else
+        {
+            result.emplace_back(value);
+        }
+    }
+    return result;
+}
+
+std::int32_t raw_multiply(std::int32_t aLhs, std::int32_t aRhs)
+{
+    const std::int64_t product = std::int64_t{aLhs} * aRhs;
+    return static_cast<std::int32_t>(
+        (product + (std::int64_t{1} << (kBits - 1)) - (product < 0 ? 1 : 0)) >>
+        kBits);
+}
+
+std::int32_t raw_divide(std::int32_t aLhs, std::int32_t aRhs)
+{
+    const std::int64_t num = std::int64_t{aLhs} * (std::int64_t{1} << kBits);
+    std::int64_t quotient = num / aRhs;
+    const std::int64_t remainder = num % aRhs;
+    if (2 * (remainder < 0 ? -remainder : remainder) >=
+        (aRhs < 0 ? -std::int64_t{aRhs} : aRhs))
+    {
+        quotient += (num < 0) == (aRhs < 0) ? 1 : -1;
+    }
+    return static_cast<std::int32_t>(quotient);
+}
+
+enum class variant
+{
+    raw,
+    strong,
+    floating,
+    simd
+};
+
+template <variant V>
+using value_t = std::conditional_t<
+    V == variant::raw, std::int32_t,
+    std::conditional_t<V == variant::floating, double, Price>>;
+
+template <variant V>
+void BM_FixedMultiply(benchmark::State &aState)
+{
+    using T = value_t<V>;
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto lhs = convert<T>(make_values(count, 1));
+    const auto rhs = convert<T>(make_values(count, 2));
+    std::vector<T> result(count);
+    for (auto _: aState)
+    {
+        if constexpr (V == variant::simd)
+        {
+            strong::simd::fixed_multiply(lhs, rhs, result);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if constexpr (V == variant::raw)
+                {
+                    result[i] = raw_multiply(lhs[i], rhs[i]);
+                }
+                else
+                {
+                    result[i] = lhs[i] * rhs[i];
+                }
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+template <variant V>
+void BM_FixedDivide(benchmark::State &aState)
+{
+    using T = value_t<V>;
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto lhs = convert<T>(make_values(count, 3));
+    const auto rhs = convert<T>(make_divisors(count, 4));
+    std::vector<T> result(count);
+    for (auto _: aState)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if constexpr (V == variant::raw)
+            {
+                result[i] = raw_divide(lhs[i], rhs[i]);
+            }
+            else
+            {
+                result[i] = lhs[i] / rhs[i];
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+constexpr std::int64_t kSmall = 1 << 10;
+constexpr std::int64_t kLarge = 1 << 16;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_FixedMultiply, variant::raw)
+    ->Name("ratio/BM_FixedMultiply/raw")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_FixedMultiply, variant::strong)
+    ->Name("ratio/BM_FixedMultiply/strong")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_FixedMultiply, variant::floating)
+    ->Name("BM_FixedMultiply/double")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_FixedMultiply, variant::simd)
+    ->Name("BM_FixedMultiply/simd")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+
+BENCHMARK_TEMPLATE(BM_FixedDivide, variant::raw)
+    ->Name("ratio/BM_FixedDivide/raw")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_FixedDivide, variant::strong)
+    ->Name("ratio/BM_FixedDivide/strong")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_FixedDivide, variant::floating)
+    ->Name("BM_FixedDivide/double")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "simd_test_support.h"
+#include "strong_type/fixed_point.h"
+
+namespace
+{
+using simd_test::kSizes;
+using simd_test::kTargets;
+using simd_test::make_values;
+
+using Price = strong::fixed_point<struct PriceTag, std::int32_t, 16>;
+using Amount = strong::fixed_point<struct AmountTag, std::int64_t, 32>;
+using Rate = strong::fixed_point<struct RateTag, std::int64_t, 8>;
+
+template <strong::rounding R>
+using Q3 = strong::fixed_point<struct Q3Tag, std::int8_t, 3, R>;
+template <strong::rounding R>
+using UQ3 = strong::fixed_point<struct UQ3Tag, std::uint8_t, 3, R>;
+template <strong::rounding R>
+using Q4 = strong::fixed_point<struct Q4Tag, std::int16_t, 4, R>;
+template <strong::rounding R>
+using Q12 = strong::fixed_point<struct Q12Tag, std::int32_t, 12, R>;
+template <strong::rounding R>
+using UQ20 = strong::fixed_point<struct UQ20Tag, std::uint32_t, 20, R>;
+template <strong::rounding R>
+using Q30 = strong::fixed_point<struct Q30Tag, std::int64_t, 30, R>;
+template <strong::rounding R>
+using Q0 = strong::fixed_point<struct Q0Tag, std::int16_t, 0, R>;
+template <strong::rounding R>
+using UQ0 = strong::fixed_point<struct UQ0Tag, std::uint16_t, 0, R>;
+template <strong::rounding R>
+using Q0x32 = strong::fixed_point<struct Q0x32Tag, std::int32_t, 0, R>;
+
+constexpr bool equal(double aLhs, double aRhs)
+{
+    return !(aLhs < aRhs) && !(aRhs < aLhs);
+}
+
+// Exact value of aNum / aDen rounded with R.
+template <strong::rounding R>
+double reference_round(double aNum, double aDen)
+{
+    const double value = aNum / aDen;
+    switch (R)
+    {
+        case strong::rounding::toward_zero:
+            return std::trunc(value);
+        case strong::rounding::down:
+            return std::floor(value);
+        default:
+            return std::round(value);
+    }
+}
+
+// Compares operator* and operator/ of 8-bit fixed point types with exact
+// double arithmetic for every pair of values.
+template <typename FixedT>
+void check_exhaustively()
+{
+    using T = strong::underlying_type<FixedT>;
+    constexpr auto kR = strong::rounding_v<FixedT>;
+    constexpr double kScale = 1 << strong::fraction_bits_v<FixedT>;
+    for (int a = std::numeric_limits<T>::min();
+         a <= std::numeric_limits<T>::max(); ++a)
+    {
+        for (int b = std::numeric_limits<T>::min();
+             b <= std::numeric_limits<T>::max(); ++b)
+        {
+            const FixedT lhs(static_cast<T>(a));
+            const FixedT rhs(static_cast<T>(b));
+            const auto product = static_cast<T>(
+                static_cast<int>(reference_round<kR>(a * b, kScale)));
+            ASSERT_EQ((lhs * rhs).get(), product) << a << " * " << b;
+            if (b == 0)
+            {
+                continue;
+            }
+            const auto quotient = static_cast<T>(
+                static_cast<int>(reference_round<kR>(a * kScale, b)));
+            ASSERT_EQ((lhs / rhs).get(), quotient) << a << " / " << b;
+        }
+    }
+}
+
+template <typename FixedT>
+void check_fixed_multiply()
+{
+    for (const auto target: kTargets)
+    {
+        if (!strong::simd::is_supported(target))
+        {
+            continue;
+        }
+        for (const auto size: kSizes)
+        {
+            const auto lhs = make_values<FixedT>(size, 1);
+            const auto rhs = make_values<FixedT>(size, 2);
+            std::vector<FixedT> out(size);
+            strong::simd::fixed_multiply(lhs, rhs, out, target);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(out[i], lhs[i] * rhs[i])
+                    << "target " << static_cast<int>(target) << ", size "
+                    << size << ", index " << i;
+            }
+
+            const FixedT scalar = make_values<FixedT>(1, 3)[0];
+            strong::simd::fixed_multiply(lhs, scalar, out, target);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(out[i], lhs[i] * scalar)
+                    << "target " << static_cast<int>(target) << ", size "
+                    << size << ", index " << i;
+            }
+        }
+    }
+}
+
+template <strong::rounding R>
+void check_all_roundings()
+{
+    check_fixed_multiply<Q3<R>>();
+    check_fixed_multiply<UQ3<R>>();
+    check_fixed_multiply<Q4<R>>();
+    check_fixed_multiply<Q12<R>>();
+    check_fixed_multiply<UQ20<R>>();
+    check_fixed_multiply<Q30<R>>();
+    check_fixed_multiply<Q0<R>>();
+    check_fixed_multiply<UQ0<R>>();
+    check_fixed_multiply<Q0x32<R>>();
+}
+}  // namespace
+
+TEST(FixedPointTests, LayoutMatchesUnderlyingType)
+{
+    static_assert(sizeof(Price) == sizeof(std::int32_t));
+    static_assert(sizeof(Amount) == sizeof(std::int64_t));
+    static_assert(strong::is_fixed_point_v<Price>);
+    static_assert(!strong::is_fixed_point_v<std::int32_t>);
+    static_assert(strong::fraction_bits_v<Amount> == 32);
+    static_assert(strong::rounding_v<Price> == strong::rounding::nearest);
+}
+
+TEST(FixedPointTests, ConversionsAreConstexpr)
+{
+    constexpr auto kHalf = strong::to_fixed_point<Price>(0.5);
+    static_assert(kHalf.get() == 1 << 15);
+    static_assert(strong::to_fixed_point<Price>(-3).get() == -3 * 65536);
+    static_assert(equal(strong::from_fixed_point<double>(kHalf), 0.5));
+    static_assert(strong::from_fixed_point<int>(kHalf) == 1);
+    static_assert(strong::from_fixed_point<int>(-kHalf) == -1);
+
+    // 1/3 is not representable: the nearest value is 21845 / 65536.
+    static_assert(strong::to_fixed_point<Price>(1.0 / 3).get() == 21845);
+    static_assert(strong::to_fixed_point<Q4<strong::rounding::down>>(-0.01)
+                      .get() == -1);
+    static_assert(
+        strong::to_fixed_point<Q4<strong::rounding::toward_zero>>(-0.01)
+            .get() == 0);
+    static_assert(strong::from_fixed_point<int>(
+                      Q4<strong::rounding::down>{-1}) == -1);
+    static_assert(strong::from_fixed_point<int>(
+                      Q4<strong::rounding::toward_zero>{-1}) == 0);
+
+    static_assert(strong::fixed_point_cast<Amount>(kHalf).get() ==
+                  std::int64_t{1} << 31);
+    static_assert(
+        strong::fixed_point_cast<Rate>(strong::to_fixed_point<Price>(2.75))
+            .get() == 2 * 256 + 192);
+}
+
+TEST(FixedPointTests, AdditiveOperationsComeFromMixins)
+{
+    Price price = strong::to_fixed_point<Price>(1.25);
+    price += strong::to_fixed_point<Price>(0.5);
+    ASSERT_EQ(price, strong::to_fixed_point<Price>(1.75));
+    ASSERT_EQ(price - strong::to_fixed_point<Price>(2),
+              strong::to_fixed_point<Price>(-0.25));
+    ASSERT_LT(-price, Price{0});
+    ASSERT_EQ(price * 4, strong::to_fixed_point<Price>(7));
+    ASSERT_EQ(2 * price, strong::to_fixed_point<Price>(3.5));
+}
+
+TEST(FixedPointTests, RoundingOfMultiplicationAndDivision)
+{
+    using strong::rounding;
+    // 1.5 * 0.1875 = 0.28125 is 4.5 units of 1/16.
+    constexpr Q4<rounding::nearest> a{24};
+    constexpr Q4<rounding::nearest> b{3};
+    static_assert((a * b).get() == 5);
+    static_assert((-a * b).get() == -5);
+    static_assert(strong::multiply<rounding::down>(a, b).get() == 4);
+    static_assert(strong::multiply<rounding::down>(-a, b).get() == -5);
+    static_assert(strong::multiply<rounding::toward_zero>(a, b).get() == 4);
+    static_assert(strong::multiply<rounding::toward_zero>(-a, b).get() == -4);
+
+    // 0.3125 / 2 = 0.15625 is 2.5 units of 1/16.
+    constexpr Q4<rounding::nearest> c{5};
+    constexpr Q4<rounding::nearest> d{32};
+    static_assert((c / d).get() == 3);
+    static_assert((c / -d).get() == -3);
+    static_assert(strong::divide<rounding::down>(c, d).get() == 2);
+    static_assert(strong::divide<rounding::down>(c, -d).get() == -3);
+    static_assert(strong::divide<rounding::toward_zero>(c, -d).get() == -2);
+    static_assert((c / std::int16_t{2}).get() == 3);
+    static_assert((-c / std::int16_t{2}).get() == -3);
+}
+
+TEST(FixedPointTests, IntermediatesAreWide)
+{
+    // Products overflow the underlying type before shift.
+    constexpr auto kPrice = strong::to_fixed_point<Price>(1000.5);
+    static_assert(kPrice * strong::to_fixed_point<Price>(20.25) ==
+                  strong::to_fixed_point<Price>(20260.125));
+    static_assert(kPrice / strong::to_fixed_point<Price>(0.25) ==
+                  strong::to_fixed_point<Price>(4002));
+
+    constexpr auto kAmount = strong::to_fixed_point<Amount>(123456.75);
+    static_assert(kAmount * strong::to_fixed_point<Amount>(1000.5) ==
+                  strong::to_fixed_point<Amount>(123518478.375));
+    static_assert(kAmount / strong::to_fixed_point<Amount>(0.125) ==
+                  strong::to_fixed_point<Amount>(987654));
+}
+
+TEST(FixedPointTests, MatchesExactArithmetic)
+{
+    check_exhaustively<Q3<strong::rounding::nearest>>();
+    check_exhaustively<Q3<strong::rounding::down>>();
+    check_exhaustively<Q3<strong::rounding::toward_zero>>();
+    check_exhaustively<UQ3<strong::rounding::nearest>>();
+    check_exhaustively<UQ3<strong::rounding::down>>();
+}
+
+TEST(FixedPointTests, FixedMultiplyMatchesOperator)
+{
+    check_all_roundings<strong::rounding::nearest>();
+    check_all_roundings<strong::rounding::down>();
+    check_all_roundings<strong::rounding::toward_zero>();
+}
@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "strong_type/flat_map.h"
+
+// Lookups of random strong ids in std::unordered_map and strong::flat_map.
+
+namespace
+{
+struct NodeTag
+{
+    static constexpr std::uint32_t empty_key = 0xffffffffu;
+};
+
+using NodeId = strong::strong_type<NodeTag, std::uint32_t, strong::comparisons,
+                                   strong::hashable>;
+
+struct keys_and_lookups
+{
+    std::vector<NodeId> keys;
+    std::vector<NodeId> lookups;
+};
+
+// Half of the lookups hit, half miss, in random order.
+keys_and_lookups make_keys(const benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    std::mt19937 random(42);
+    keys_and_lookups result;
+    result.keys.reserve(count);
+    result.lookups.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto key = static_cast<std::uint32_t>(random() >> 1);
+        result.keys.emplace_back(key);
+        result.lookups.emplace_back(i % 2 == 0 ? key : key | 0x80000000u);
+    }
+    std::shuffle(result.lookups.begin(), result.lookups.end(), random);
+    return result;
+}
+
+void BM_UnorderedMapFind(benchmark::State &aState)
+{
+    const auto data = make_keys(aState);
+    std::unordered_map<NodeId, std::uint32_t> map;
+    map.reserve(data.keys.size());
+    for (const auto &key: data.keys)
+    {
+        map.emplace(key, key.get());
+    }
+    for (auto _: aState)
+    {
+        std::uint32_t sum = 0;
+        for (const auto &key: data.lookups)
+        {
+            const auto found = map.find(key);
+            sum += found != map.end() ? found->second : 0u;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+void BM_FlatMapFind(benchmark::State &aState)
+{
+    const auto data = make_keys(aState);
+    strong::flat_map<NodeId, std::uint32_t> map(data.keys.size());
+    for (const auto &key: data.keys)
+    {
+        map.try_emplace(key, key.get());
+    }
+    for (auto _: aState)
+    {
+        std::uint32_t sum = 0;
+        for (const auto &key: data.lookups)
+        {
+            const auto *found = map.find(key);
+            sum += found ? *found : 0u;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+void BM_FlatMapFindBatch(benchmark::State &aState)
+{
+    const auto data = make_keys(aState);
+    strong::flat_map<NodeId, std::uint32_t> map(data.keys.size());
+    for (const auto &key: data.keys)
+    {
+        map.try_emplace(key, key.get());
+    }
+    std::vector<const std::uint32_t *> results(data.lookups.size());
+    for (auto _: aState)
+    {
+        map.find_batch(data.lookups, results);
+        std::uint32_t sum = 0;
+        for (const auto *found: results)
+        {
+            sum += found ? *found : 0u;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+void sizes(benchmark::internal::Benchmark *aBenchmark)
+{
+    aBenchmark->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+}
+}  // namespace
+
+BENCHMARK(BM_UnorderedMapFind)
+    ->Name("BM_MapFind/unordered_map")
+    ->Apply(sizes);
+BENCHMARK(BM_FlatMapFind)->Name("BM_MapFind/flat_map")->Apply(sizes);
+BENCHMARK(BM_FlatMapFindBatch)
+    ->Name("BM_MapFind/flat_map_batch")
+    ->Apply(sizes);
@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "strong_type/flat_map.h"
+
+namespace
+{
+struct NodeTag
+{
+    static constexpr std::uint32_t empty_key = 0xffffffffu;
+};
+
+struct ByteTag
+{
+    static constexpr std::uint8_t empty_key = 0;
+};
+
+struct ShortTag
+{
+    static constexpr std::int16_t empty_key = -1;
+};
+
+struct WideTag
+{
+    static constexpr std::uint64_t empty_key = ~std::uint64_t{0};
+};
+
+struct ClusteredTag
+{
+    static constexpr std::uint32_t empty_key = 0xffffffffu;
+};
+}  // namespace
+
+template <>
+struct strong::hash_mixer<ClusteredTag>
+{
+    using type = strong::identity_mixer;
+};
+
+namespace
+{
+using NodeId = strong::strong_type<NodeTag, std::uint32_t>;
+using ByteId = strong::strong_type<ByteTag, std::uint8_t>;
+using ShortId = strong::strong_type<ShortTag, std::int16_t>;
+using WideId = strong::strong_type<WideTag, std::uint64_t>;
+using ClusteredId = strong::strong_type<ClusteredTag, std::uint32_t>;
+
+// Value whose construction from an int throws for negative numbers.
+struct Checked
+{
+    int value = 0;
+
+    Checked() = default;
+    explicit Checked(int aValue) : value(aValue)
+    {
+        if (aValue < 0)
+        {
+            throw std::invalid_argument("negative");
+        }
+    }
+};
+
+// Random inserts, assignments and erases checked against std::unordered_map.
+template <typename KeyT>
+void check_against_reference(std::uint64_t aKeyRange, std::size_t aOperations)
+{
+    using T = strong::underlying_type<KeyT>;
+    constexpr T kEmpty = static_cast<T>(strong::tag_type<KeyT>::empty_key);
+    strong::flat_map<KeyT, std::uint64_t> map;
+    std::unordered_map<T, std::uint64_t> reference;
+    std::mt19937_64 random(7);
+    for (std::size_t i = 0; i < aOperations; ++i)
+    {
+        const auto key = static_cast<T>(random() % aKeyRange);
+        if (key == kEmpty)
+        {
+            continue;
+        }
+        const auto value = random();
+        switch (random() % 4)
+        {
+            case 0:
+            case 1:
+                ASSERT_EQ(map.insert_or_assign(KeyT{key}, value).second,
+                          reference.count(key) == 0);
+                reference[key] = value;
+                break;
+            case 2:
+                ASSERT_EQ(map.erase(KeyT{key}), reference.erase(key) == 1);
+                break;
+            default:
+            {
+                const auto *found = map.find(KeyT{key});
+                const auto expected = reference.find(key);
+                ASSERT_EQ(found != nullptr, expected != reference.end());
+                if (found)
+                {
+                    ASSERT_EQ(*found, expected->second);
+                }
+            }
+        }
+        ASSERT_EQ(map.size(), reference.size());
+    }
+    std::size_t visited = 0;
+    map.for_each(
+        [&](KeyT aKey, std::uint64_t aValue)
+        {
+            ++visited;
+            ASSERT_EQ(reference.at(aKey.get()), aValue);
+        });
+    ASSERT_EQ(visited, reference.size());
+}
+}  // namespace
+
+TEST(FlatMapTests, EmptyMap)
+{
+    const strong::flat_map<NodeId, int> map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_EQ(map.find(NodeId{1}), nullptr);
+    ASSERT_FALSE(map.contains(NodeId{NodeTag::empty_key}));
+}
+
+TEST(FlatMapTests, InsertFindErase)
+{
+    strong::flat_map<NodeId, std::string> map;
+    ASSERT_TRUE(map.insert(NodeId{1}, "one").second);
+    ASSERT_TRUE(map.try_emplace(NodeId{2}, std::size_t{3}, 't').second);
+    ASSERT_FALSE(map.insert(NodeId{1}, "uno").second);
+    ASSERT_EQ(*map.find(NodeId{1}), "one");
+    ASSERT_EQ(*map.find(NodeId{2}), "ttt");
+    map[NodeId{3}] = "three";
+    ASSERT_EQ(map.size(), 3u);
+    ASSERT_FALSE(map.insert_or_assign(NodeId{1}, "uno").second);
+    ASSERT_EQ(*map.find(NodeId{1}), "uno");
+    ASSERT_TRUE(map.erase(NodeId{1}));
+    ASSERT_FALSE(map.erase(NodeId{1}));
+    ASSERT_FALSE(map.contains(NodeId{1}));
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_FALSE(map.contains(NodeId{NodeTag::empty_key}));
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.find(NodeId{2}), nullptr);
+}
+
+TEST(FlatMapTests, ThrowingValueIsNotInserted)
+{
+    strong::flat_map<NodeId, Checked> map;
+    ASSERT_TRUE(map.try_emplace(NodeId{1}, 1).second);
+    ASSERT_THROW(map.try_emplace(NodeId{2}, -1), std::invalid_argument);
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_EQ(map.find(NodeId{2}), nullptr);
+    ASSERT_FALSE(map.erase(NodeId{2}));
+    std::size_t visited = 0;
+    map.for_each([&visited](NodeId, Checked&) { ++visited; });
+    ASSERT_EQ(visited, 1u);
+
+    ASSERT_TRUE(map.try_emplace(NodeId{2}, 2).second);
+    ASSERT_EQ(map.find(NodeId{2})->value, 2);
+    ASSERT_EQ(map.size(), 2u);
+}
+
+TEST(FlatMapTests, Reserve)
+{
+    strong::flat_map<NodeId, int> map(1000);
+    const auto buckets = map.bucket_count();
+    ASSERT_GE(buckets, 1000u);
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        map.try_emplace(NodeId{i}, static_cast<int>(i));
+    }
+    ASSERT_EQ(map.bucket_count(), buckets);
+}
+
+TEST(FlatMapTests, MatchesReferenceForEveryKeyWidth)
+{
+    check_against_reference<ByteId>(256, 20000);
+    check_against_reference<ShortId>(4000, 50000);
+    check_against_reference<NodeId>(20000, 100000);
+    check_against_reference<WideId>(~std::uint64_t{0}, 20000);
+    check_against_reference<WideId>(5000, 50000);
+}
+
+TEST(FlatMapTests, ClusteredKeysSpillIntoOverflowArea)
+{
+    // Identity hash maps all these keys to a few home slots at the end of
+    // the table, so probe sequences run into the overflow area and force
+    // the table to grow.
+    strong::flat_map<ClusteredId, std::uint32_t> map(8);
+    const auto buckets = static_cast<std::uint32_t>(map.bucket_count());
+    for (std::uint32_t i = 0; i < 200; ++i)
+    {
+        map.try_emplace(ClusteredId{buckets - 1 + i * buckets}, i);
+    }
+    ASSERT_EQ(map.size(), 200u);
+    for (std::uint32_t i = 0; i < 200; ++i)
+    {
+        ASSERT_EQ(*map.find(ClusteredId{buckets - 1 + i * buckets}), i);
+    }
+    check_against_reference<ClusteredId>(3000, 30000);
+}
+
+TEST(FlatMapTests, BatchOperations)
+{
+    strong::flat_map<NodeId, std::uint32_t> map;
+    std::vector<NodeId> keys;
+    std::vector<std::uint32_t> values;
+    for (std::uint32_t i = 0; i < 100; ++i)
+    {
+        keys.emplace_back(i * 3);
+        values.push_back(i);
+    }
+    ASSERT_EQ(map.insert_batch(keys, values), 100u);
+    const strong::span<const NodeId> first_keys(keys.data(), 10);
+    const strong::span<const std::uint32_t> last_values(values.data() + 90, 10);
+    ASSERT_EQ(map.insert_batch(first_keys, last_values), 0u);
+    ASSERT_EQ(*map.find(NodeId{0}), 90u);
+
+    std::vector<NodeId> lookups;
+    for (std::uint32_t i = 0; i < 300; ++i)
+    {
+        lookups.emplace_back(i);
+    }
+    std::vector<const std::uint32_t *> results(lookups.size());
+    map.find_batch(lookups, results);
+    for (std::uint32_t i = 0; i < 300; ++i)
+    {
+        if (i % 3 == 0 && i >= 30)
+        {
+            ASSERT_NE(results[i], nullptr);
+            ASSERT_EQ(*results[i], i / 3);
+        }
+        else if (i % 3 != 0)
+        {
+            ASSERT_EQ(results[i], nullptr);
+        }
+    }
+}
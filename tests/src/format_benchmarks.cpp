@@ -0,0 +1,152 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "strong_type/format.h"
+
+// Writing and parsing 4096 strong ids (uint64) and amounts (double):
+// std::ostringstream / std::istringstream on the underlying values
+// ("stream"), strong::to_chars / from_chars value by value ("charconv")
+// and strong::format_range into one buffer ("format_range").
+
+namespace
+{
+using OrderId = strong::strong_type<struct OrderIdTag, std::uint64_t>;
+using Amount = strong::strong_type<struct AmountTag, double>;
+
+constexpr std::size_t kCount = 4096;
+
+enum class method
+{
+    stream,
+    charconv,
+    format_range
+};
+
+template <typename StrongT>
+std::vector<StrongT> make_values()
+{
+    std::mt19937_64 random(1);
+    std::vector<StrongT> values;
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        if constexpr (std::is_integral_v<strong::underlying_type<StrongT>>)
+        {
+            values.emplace_back(random() >> (random() % 64));
+        }
+        else
+        {
+            values.emplace_back(
+                static_cast<double>(random() % 10000000) / 100.0);
+        }
+    }
+    return values;
+}
+
+template <typename StrongT, method M>
+void BM_Format(benchmark::State &aState)
+{
+    const auto values = make_values<StrongT>();
+    std::vector<char> buffer(kCount * (strong::max_chars_v<StrongT> + 1));
+    std::ostringstream stream;
+    // Enough digits to parse back, as to_chars guarantees.
+    stream.precision(17);
+    for (auto _: aState)
+    {
+        if constexpr (M == method::stream)
+        {
+            stream.seekp(0);
+            for (const StrongT &value: values)
+            {
+                stream << value.get() << ' ';
+            }
+            benchmark::DoNotOptimize(stream.tellp());
+        }
+        else if constexpr (M == method::charconv)
+        {
+            char *position = buffer.data();
+            // One byte is kept for the separator after the last value.
+            char *const last = buffer.data() + buffer.size() - 1;
+            for (const StrongT &value: values)
+            {
+                position = strong::to_chars(position, last, value).ptr;
+                *position++ = ' ';
+            }
+            benchmark::DoNotOptimize(position);
+        }
+        else
+        {
+            const auto result = strong::format_range(
+                buffer.data(), buffer.data() + buffer.size(), values);
+            benchmark::DoNotOptimize(result.ptr);
+        }
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() *
+                             static_cast<std::int64_t>(kCount));
+}
+
+template <typename StrongT, method M>
+void BM_Parse(benchmark::State &aState)
+{
+    const auto values = make_values<StrongT>();
+    std::vector<char> buffer(kCount * (strong::max_chars_v<StrongT> + 1));
+    const auto written = strong::format_range(
+        buffer.data(), buffer.data() + buffer.size(), values);
+    const std::string text(buffer.data(), written.ptr);
+    std::vector<StrongT> parsed(kCount);
+    for (auto _: aState)
+    {
+        if constexpr (M == method::stream)
+        {
+            std::istringstream stream(text);
+            for (StrongT &value: parsed)
+            {
+                strong::underlying_type<StrongT> number{};
+                stream >> number;
+                value = StrongT(number);
+            }
+        }
+        else
+        {
+            const char *position = text.data();
+            const char *const last = text.data() + text.size();
+            for (StrongT &value: parsed)
+            {
+                position = strong::from_chars(position, last, value).ptr + 1;
+            }
+        }
+        benchmark::DoNotOptimize(parsed.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() *
+                             static_cast<std::int64_t>(kCount));
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Format, OrderId, method::stream)
+    ->Name("BM_FormatIds/stream");
+BENCHMARK_TEMPLATE(BM_Format, OrderId, method::charconv)
+    ->Name("BM_FormatIds/charconv");
+BENCHMARK_TEMPLATE(BM_Format, OrderId, method::format_range)
+    ->Name("BM_FormatIds/format_range");
+BENCHMARK_TEMPLATE(BM_Format, Amount, method::stream)
+    ->Name("BM_FormatAmounts/stream");
+BENCHMARK_TEMPLATE(BM_Format, Amount, method::charconv)
+    ->Name("BM_FormatAmounts/charconv");
+BENCHMARK_TEMPLATE(BM_Format, Amount, method::format_range)
+    ->Name("BM_FormatAmounts/format_range");
+BENCHMARK_TEMPLATE(BM_Parse, OrderId, method::stream)
+    ->Name("BM_ParseIds/stream");
+BENCHMARK_TEMPLATE(BM_Parse, OrderId, method::charconv)
+    ->Name("BM_ParseIds/charconv");
+#if STRONG_TYPE_HAS_FLOAT_FROM_CHARS
+BENCHMARK_TEMPLATE(BM_Parse, Amount, method::stream)
+    ->Name("BM_ParseAmounts/stream");
+BENCHMARK_TEMPLATE(BM_Parse, Amount, method::charconv)
+    ->Name("BM_ParseAmounts/charconv");
+#endif
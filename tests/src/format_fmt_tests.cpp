@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string_view>
+
+#include "strong_type/fixed_point.h"
+#include "strong_type/format.h"
+
+static_assert(STRONG_TYPE_USE_FMT, "Build with STRONG_TYPE_USE_FMT=1.");
+
+namespace
+{
+struct OrderIdTag
+{
+    static constexpr std::string_view prefix = "order#";
+};
+
+struct AmountTag
+{
+    static constexpr std::string_view suffix = " USD";
+};
+
+using OrderId = strong::strong_type<OrderIdTag, std::uint64_t>;
+using Amount = strong::strong_type<AmountTag, double>;
+using Delta = strong::strong_type<struct DeltaTag, std::int32_t>;
+using Price = strong::fixed_point<struct PriceTag, std::int32_t, 16>;
+}  // namespace
+
+TEST(FmtFormatTests, WritesPrefixValueAndSuffix)
+{
+    ASSERT_EQ(fmt::format("{}", OrderId{42}), "order#42");
+    ASSERT_EQ(fmt::format("{}", Delta{-17}), "-17");
+    ASSERT_EQ(fmt::format("{}", Amount{12.5}), "12.5 USD");
+    ASSERT_EQ(fmt::format("{} and {}", OrderId{1}, Amount{0.25}),
+              "order#1 and 0.25 USD");
+    static_assert(!fmt::is_formattable<Price>::value);
+}
+
+TEST(FmtFormatTests, SpecAppliesToTheNumber)
+{
+    ASSERT_EQ(fmt::format("{:x}", OrderId{255}), "order#ff");
+    ASSERT_EQ(fmt::format("{:.2f}", Amount{12.5}), "12.50 USD");
+    // Width and alignment pad the number, between the prefix and the value.
+    ASSERT_EQ(fmt::format("{:>5}", OrderId{7}), "order#    7");
+    ASSERT_EQ(fmt::format("{:<6}", Amount{1.5}), "1.5    USD");
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "strong_type/fixed_point.h"
+#include "strong_type/format.h"
+
+namespace
+{
+struct OrderIdTag
+{
+    static constexpr std::string_view prefix = "order#";
+};
+
+struct AmountTag
+{
+    static constexpr std::string_view suffix = " USD";
+};
+
+using OrderId =
+    strong::strong_type<OrderIdTag, std::uint64_t, strong::comparisons>;
+using Amount = strong::strong_type<AmountTag, double>;
+using Delta =
+    strong::strong_type<struct DeltaTag, std::int32_t, strong::comparisons>;
+using Flag = strong::strong_type<struct FlagTag, bool>;
+using Price = strong::fixed_point<struct PriceTag, std::int32_t, 16>;
+
+template <typename StrongT>
+std::string text_of(const StrongT &aValue)
+{
+    std::array<char, strong::max_chars_v<StrongT>> buffer;
+    const auto result =
+        strong::to_chars(buffer.data(), buffer.data() + buffer.size(), aValue);
+    EXPECT_EQ(result.ec, std::errc());
+    return std::string(buffer.data(), result.ptr);
+}
+
+template <typename StrongT>
+StrongT parse(std::string_view aText)
+{
+    StrongT value{};
+    const auto result =
+        strong::from_chars(aText.data(), aText.data() + aText.size(), value);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(result.ptr, aText.data() + aText.size());
+    return value;
+}
+}  // namespace
+
+TEST(FormatTests, ToChars)
+{
+    static_assert(strong::is_text_convertible_v<OrderId>);
+    static_assert(strong::is_text_convertible_v<Amount>);
+    static_assert(!strong::is_text_convertible_v<Flag>);
+    static_assert(!strong::is_text_convertible_v<Price>);
+    static_assert(!strong::is_text_convertible_v<std::int32_t>);
+    static_assert(strong::max_chars_v<Delta> == 11);
+    static_assert(strong::max_chars_v<OrderId> == 6 + 21);
+
+    ASSERT_EQ(text_of(OrderId{42}), "order#42");
+    ASSERT_EQ(text_of(OrderId{std::numeric_limits<std::uint64_t>::max()}),
+              "order#18446744073709551615");
+    ASSERT_EQ(text_of(Delta{std::numeric_limits<std::int32_t>::min()}),
+              "-2147483648");
+    ASSERT_EQ(text_of(Amount{12.5}), "12.5 USD");
+    ASSERT_EQ(text_of(Amount{-0.1}), "-0.1 USD");
+#if STRONG_TYPE_HAS_FLOAT_FROM_CHARS
+    ASSERT_EQ(parse<Amount>(text_of(Amount{1.0 / 3.0})).get(), 1.0 / 3.0);
+#endif
+}
+
+TEST(FormatTests, ToCharsDoesNotOverflow)
+{
+    char buffer[16];
+    for (std::size_t size = 0; size < 11; ++size)
+    {
+        const auto result =
+            strong::to_chars(buffer, buffer + size, OrderId{12345});
+        ASSERT_EQ(result.ec, std::errc::value_too_large) << size;
+        ASSERT_EQ(result.ptr, buffer + size);
+    }
+    ASSERT_EQ(strong::to_chars(buffer, buffer + 11, OrderId{12345}).ptr,
+              buffer + 11);
+    // The number fits, the suffix does not.
+    ASSERT_EQ(strong::to_chars(buffer, buffer + 5, Amount{1.5}).ec,
+              std::errc::value_too_large);
+}
+
+TEST(FormatTests, FromChars)
+{
+    ASSERT_EQ(parse<OrderId>("order#7"), OrderId{7});
+    ASSERT_EQ(parse<Delta>("-17"), Delta{-17});
+
+    OrderId id{5};
+    const std::string_view noPrefix = "42";
+    auto result = strong::from_chars(
+        noPrefix.data(), noPrefix.data() + noPrefix.size(), id);
+    ASSERT_EQ(result.ec, std::errc::invalid_argument);
+    ASSERT_EQ(result.ptr, noPrefix.data());
+    ASSERT_EQ(id, OrderId{5});
+
+    Delta delta{3};
+    const std::string_view tooLarge = "9999999999";
+    ASSERT_EQ(strong::from_chars(tooLarge.data(),
+                                 tooLarge.data() + tooLarge.size(), delta)
+                  .ec,
+              std::errc::result_out_of_range);
+    ASSERT_EQ(delta, Delta{3});
+
+    // Parsing stops after the suffix, like std::from_chars after a number.
+    const std::string_view list = "order#1,order#2";
+    result = strong::from_chars(list.data(), list.data() + list.size(), id);
+    ASSERT_EQ(id, OrderId{1});
+    ASSERT_EQ(*result.ptr, ',');
+}
+
+#if STRONG_TYPE_HAS_FLOAT_FROM_CHARS
+TEST(FormatTests, FromCharsOfFloatingPoint)
+{
+    static_assert(strong::is_text_parsable_v<Amount>);
+    ASSERT_EQ(parse<Amount>("2.25 USD").get(), 2.25);
+
+    Amount amount{1.0};
+    const std::string_view noSuffix = "2.5 EUR";
+    ASSERT_EQ(strong::from_chars(noSuffix.data(),
+                                 noSuffix.data() + noSuffix.size(), amount)
+                  .ec,
+              std::errc::invalid_argument);
+    ASSERT_EQ(amount.get(), 1.0);
+}
+#else
+TEST(FormatTests, FromCharsOfFloatingPointIsUnavailable)
+{
+    static_assert(!strong::is_text_parsable_v<Amount>);
+    static_assert(strong::is_text_parsable_v<OrderId>);
+}
+#endif
+
+TEST(FormatTests, FormatRange)
+{
+    const std::vector<Delta> values{Delta{1}, Delta{-20}, Delta{300},
+                                    Delta{-4000}};
+    char buffer[64];
+    auto result =
+        strong::format_range(buffer, buffer + sizeof(buffer), values, ", ");
+    ASSERT_EQ(result.ec, std::errc());
+    ASSERT_EQ(result.count, 4u);
+    ASSERT_EQ(std::string_view(buffer, static_cast<std::size_t>(
+                                           result.ptr - buffer)),
+              "1, -20, 300, -4000");
+
+    const std::vector<Delta> empty;
+    result = strong::format_range(buffer, buffer + sizeof(buffer), empty);
+    ASSERT_EQ(result.ptr, buffer);
+    ASSERT_EQ(result.count, 0u);
+
+    // Only whole values are written into a small buffer.
+    std::string text;
+    strong::span<const Delta> rest(values);
+    while (!rest.empty())
+    {
+        char small[8];
+        result = strong::format_range(small, small + sizeof(small), rest);
+        ASSERT_GT(result.count, 0u);
+        text.append(small, result.ptr);
+        rest = rest.last(rest.size() - result.count);
+        if (!rest.empty())
+        {
+            ASSERT_EQ(result.ec, std::errc::value_too_large);
+            text += ' ';
+        }
+    }
+    ASSERT_EQ(text, "1 -20 300 -4000");
+}
@@ -0,0 +1,178 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "strong_type/hash.h"
+
+// Lookups of sequential and strided strong ids with identity, murmur and wy
+// mixers.
+
+namespace
+{
+struct IdentityTag;
+struct MurmurTag;
+struct WyTag;
+}  // namespace
+
+template <>
+struct strong::hash_mixer<IdentityTag>
+{
+    using type = strong::identity_mixer;
+};
+
+template <>
+struct strong::hash_mixer<WyTag>
+{
+    using type = strong::wy_mixer;
+};
+
+namespace
+{
+template <typename Tag>
+using Id = strong::strong_type<Tag, std::uint64_t, strong::comparisons,
+                               strong::hashable>;
+
+template <typename T>
+struct type_tag
+{
+    using type = T;
+};
+
+template <typename Key>
+std::vector<Key> make_keys(const benchmark::State &aState)
+{
+    const auto count = static_cast<std::uint64_t>(aState.range(0));
+    const auto stride = static_cast<std::uint64_t>(aState.range(1));
+    std::vector<Key> keys;
+    keys.reserve(count);
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        keys.emplace_back(i * stride);
+    }
+    // Random lookup order: sequential ids are not looked up sequentially.
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(42));
+    return keys;
+}
+
+// Minimal linear probing set with power-of-two capacity: the kind of table
+// where identity hash of integers degrades to long probe sequences.
+template <typename Key>
+class linear_probing_set
+{
+   public:
+    explicit linear_probing_set(std::size_t aCount)
+        : mask_(capacity_for(aCount) - 1),
+          keys_(mask_ + 1),
+          used_(mask_ + 1, false)
+    {
+    }
+
+    void insert(const Key &aKey)
+    {
+        std::size_t slot = std::hash<Key>{}(aKey) & mask_;
+        while (used_[slot] && keys_[slot] != aKey)
+        {
+            slot = (slot + 1) & mask_;
+        }
+        keys_[slot] = aKey;
+        used_[slot] = true;
+    }
+
+    bool contains(const Key &aKey) const
+    {
+        std::size_t slot = std::hash<Key>{}(aKey) & mask_;
+        while (used_[slot])
+        {
+            if (keys_[slot] == aKey)
+            {
+                return true;
+            }
+            slot = (slot + 1) & mask_;
+        }
+        return false;
+    }
+
+   private:
+    static std::size_t capacity_for(std::size_t aCount)
+    {
+        std::size_t capacity = 16;
+        while (capacity < 2 * aCount)
+        {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    std::size_t mask_;
+    std::vector<Key> keys_;
+    std::vector<bool> used_;
+};
+
+template <typename Tag>
+void BM_UnorderedMapFind(benchmark::State &aState, type_tag<Tag>)
+{
+    using Key = Id<Tag>;
+    const auto keys = make_keys<Key>(aState);
+    std::unordered_map<Key, std::uint32_t> map;
+    map.reserve(keys.size());
+    for (const auto &key: keys)
+    {
+        map.emplace(key, static_cast<std::uint32_t>(key.get()));
+    }
+    for (auto _: aState)
+    {
+        std::uint32_t sum = 0;
+        for (const auto &key: keys)
+        {
+            sum += map.find(key)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+template <typename Tag>
+void BM_OpenAddressingFind(benchmark::State &aState, type_tag<Tag>)
+{
+    using Key = Id<Tag>;
+    const auto keys = make_keys<Key>(aState);
+    linear_probing_set<Key> set(keys.size());
+    for (const auto &key: keys)
+    {
+        set.insert(key);
+    }
+    for (auto _: aState)
+    {
+        std::size_t found = 0;
+        for (const auto &key: keys)
+        {
+            found += set.contains(key) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+// Identity hash of strided keys fills linear probing table with a single
+// cluster, so strided runs are kept small.
+void keys(benchmark::internal::Benchmark *aBenchmark)
+{
+    aBenchmark->Args({1 << 16, 1})->Args({1 << 12, 64});
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_UnorderedMapFind, identity, type_tag<IdentityTag>{})
+    ->Apply(keys);
+BENCHMARK_CAPTURE(BM_UnorderedMapFind, murmur, type_tag<MurmurTag>{})
+    ->Apply(keys);
+BENCHMARK_CAPTURE(BM_UnorderedMapFind, wy, type_tag<WyTag>{})->Apply(keys);
+
+BENCHMARK_CAPTURE(BM_OpenAddressingFind, identity, type_tag<IdentityTag>{})
+    ->Apply(keys);
+BENCHMARK_CAPTURE(BM_OpenAddressingFind, murmur, type_tag<MurmurTag>{})
+    ->Apply(keys);
+BENCHMARK_CAPTURE(BM_OpenAddressingFind, wy, type_tag<WyTag>{})->Apply(keys);
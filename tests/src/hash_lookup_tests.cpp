@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "strong_type/hash.h"
+
+// Heterogeneous lookup in unordered containers needs C++20. This file is
+// built as C++20 where the compiler supports it, see tests/CMakeLists.txt.
+namespace
+{
+using NodeId = strong::strong_type<struct NodeIdTag, std::uint32_t,
+                                   strong::comparisons, strong::hashable>;
+using Name = strong::strong_type<struct NameTag, std::string,
+                                 strong::comparisons, strong::hashable>;
+}  // namespace
+
+TEST(HashLookupTests, FindByRawKey)
+{
+#if defined(__cpp_lib_generic_unordered_lookup)
+    std::unordered_map<NodeId, std::string, strong::transparent_hash<NodeId>,
+                       strong::transparent_equal_to<NodeId>>
+        names;
+    names.emplace(NodeId{1}, "one");
+    names.emplace(NodeId{2}, "two");
+    const auto found = names.find(std::uint32_t{2});
+    ASSERT_NE(found, names.end());
+    ASSERT_EQ(found->first, NodeId{2});
+    ASSERT_EQ(found->second, "two");
+    ASSERT_EQ(names.find(std::uint32_t{3}), names.end());
+    ASSERT_TRUE(names.contains(std::uint32_t{1}));
+    ASSERT_EQ(names.count(std::uint32_t{1}), 1u);
+
+    std::unordered_set<Name, strong::transparent_hash<Name>,
+                       strong::transparent_equal_to<Name>>
+        set{Name{"a"}, Name{"b"}};
+    ASSERT_TRUE(set.contains(std::string("b")));
+    ASSERT_FALSE(set.contains(std::string("c")));
+#else
+    GTEST_SKIP() << "No heterogeneous lookup in unordered containers.";
+#endif
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "strong_type/hash.h"
+
+namespace
+{
+struct WyTag;
+struct IdentityTag;
+}  // namespace
+
+template <>
+struct strong::hash_mixer<WyTag>
+{
+    using type = strong::wy_mixer;
+};
+
+template <>
+struct strong::hash_mixer<IdentityTag>
+{
+    using type = strong::identity_mixer;
+};
+
+namespace
+{
+using NodeId = strong::strong_type<struct NodeIdTag, std::uint32_t,
+                                   strong::comparisons, strong::hashable>;
+using WyId = strong::strong_type<WyTag, std::uint64_t, strong::comparisons,
+                                 strong::hashable>;
+using IdentityId = strong::strong_type<IdentityTag, std::int64_t,
+                                       strong::comparisons, strong::hashable>;
+using Name = strong::strong_type<struct NameTag, std::string,
+                                 strong::comparisons, strong::hashable>;
+using Plain = strong::strong_type<struct PlainTag, std::uint32_t,
+                                  strong::comparisons>;
+
+template <typename Hash, typename = void>
+inline constexpr bool is_transparent_v = false;
+
+template <typename Hash>
+inline constexpr bool
+    is_transparent_v<Hash, std::void_t<typename Hash::is_transparent>> =
+        true;
+
+// Number of distinct buckets hit by aCount sequential keys in a table of
+// aBuckets buckets indexed by low bits of the hash.
+template <typename StrongT>
+std::size_t used_buckets(std::size_t aCount, std::size_t aStride,
+                         std::size_t aBuckets)
+{
+    using T = strong::underlying_type<StrongT>;
+    std::set<std::size_t> buckets;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        const StrongT key{static_cast<T>(i * aStride)};
+        buckets.insert(std::hash<StrongT>{}(key) & (aBuckets - 1));
+    }
+    return buckets.size();
+}
+}  // namespace
+
+TEST(HashTests, StdHashIsEnabledOnlyWithHashable)
+{
+    static_assert(std::is_default_constructible_v<std::hash<NodeId>>,
+                  "std::hash must be enabled for hashable strong type.");
+    static_assert(std::is_invocable_r_v<std::size_t, std::hash<NodeId>,
+                                        const NodeId &>,
+                  "std::hash must be invocable for hashable strong type.");
+    static_assert(!std::is_default_constructible_v<std::hash<Plain>>,
+                  "std::hash must be disabled without hashable.");
+    static_assert(!std::is_copy_constructible_v<std::hash<Plain>>,
+                  "std::hash must be disabled without hashable.");
+    static_assert(strong::is_hashable_v<NodeId>, "Invalid is_hashable_v.");
+    static_assert(!strong::is_hashable_v<Plain>, "Invalid is_hashable_v.");
+    static_assert(!strong::is_hashable_v<std::uint32_t>,
+                  "Invalid is_hashable_v.");
+    static_assert(sizeof(NodeId) == sizeof(std::uint32_t),
+                  "hashable must not add storage.");
+}
+
+TEST(HashTests, EqualValuesHaveEqualHashes)
+{
+    const std::hash<NodeId> hasher;
+    ASSERT_EQ(hasher(NodeId{42}), hasher(NodeId{42}));
+    ASSERT_NE(hasher(NodeId{42}), hasher(NodeId{43}));
+    ASSERT_EQ(std::hash<Name>{}(Name{"node"}), strong::hash{}(Name{"node"}));
+    ASSERT_EQ(strong::hash{}(NodeId{7}), strong::hash_value(NodeId{7}));
+}
+
+TEST(HashTests, MixerIsSelectedPerTag)
+{
+    static_assert(
+        std::is_same_v<strong::hash_mixer_t<NodeIdTag>, strong::murmur_mixer>,
+        "murmur_mixer must be the default.");
+    ASSERT_EQ(strong::hash_value(NodeId{5}),
+              static_cast<std::size_t>(strong::murmur_mixer{}(5)));
+    ASSERT_EQ(strong::hash_value(WyId{5}),
+              static_cast<std::size_t>(strong::wy_mixer{}(5)));
+    ASSERT_EQ(strong::hash_value(IdentityId{5}), 5u);
+    ASSERT_EQ(strong::hash_value(IdentityId{-1}),
+              static_cast<std::size_t>(~std::uint64_t{0}));
+}
+
+TEST(HashTests, MixersAreConstexpr)
+{
+    static_assert(strong::murmur_mixer{}(0) == 0, "Invalid murmur_mixer.");
+    static_assert(strong::murmur_mixer{}(1) != 1, "Invalid murmur_mixer.");
+    static_assert(strong::wy_mixer{}(1) != strong::wy_mixer{}(2),
+                  "Invalid wy_mixer.");
+    static_assert(strong::hash_value(WyId{3}) == strong::wy_mixer{}(3),
+                  "hash_value must be usable in constant expressions.");
+}
+
+TEST(HashTests, PortableWideMultiplication)
+{
+    const std::uint64_t values[] = {0,
+                                    1,
+                                    0xffffffffULL,
+                                    0x100000000ULL,
+                                    0x2d358dccaa6c78a5ULL,
+                                    0x8bb84b93962eacc9ULL,
+                                    ~std::uint64_t{0}};
+    for (const auto lhs: values)
+    {
+        for (const auto rhs: values)
+        {
+            ASSERT_EQ(strong::details::mum(lhs, rhs),
+                      strong::details::mum_portable(lhs, rhs));
+        }
+    }
+    ASSERT_EQ(strong::details::mum_portable(~std::uint64_t{0}, 2),
+              (~std::uint64_t{0} << 1) ^ 1u);
+}
+
+TEST(HashTests, SequentialKeysSpreadOverPowerOfTwoBuckets)
+{
+    constexpr std::size_t kBuckets = 1024;
+    constexpr std::size_t kKeys = 1024;
+    // Identity leaves strided keys in a handful of buckets.
+    ASSERT_EQ(used_buckets<IdentityId>(kKeys, 64, kBuckets), kBuckets / 64);
+    // Mixed hashes of the same keys behave like random: about 1 - 1/e of
+    // buckets are used.
+    ASSERT_GT(used_buckets<NodeId>(kKeys, 64, kBuckets), kBuckets / 2);
+    ASSERT_GT(used_buckets<WyId>(kKeys, 64, kBuckets), kBuckets / 2);
+    ASSERT_GT(used_buckets<NodeId>(kKeys, 1, kBuckets), kBuckets / 2);
+    ASSERT_GT(used_buckets<WyId>(kKeys, 1, kBuckets), kBuckets / 2);
+}
+
+TEST(HashTests, UnorderedContainers)
+{
+    std::unordered_map<NodeId, std::string> names;
+    names[NodeId{1}] = "one";
+    names[NodeId{2}] = "two";
+    ASSERT_EQ(names.at(NodeId{2}), "two");
+    ASSERT_EQ(names.count(NodeId{3}), 0u);
+
+    // Lookups by raw values would hash without the mixer of the Tag.
+    static_assert(!is_transparent_v<strong::hash>);
+    std::unordered_set<Name, strong::hash> set;
+    set.insert(Name{"a"});
+    set.insert(Name{"b"});
+    set.insert(Name{"a"});
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(set.count(Name{"b"}), 1u);
+}
+
+TEST(HashTests, TransparentHashMixesRawValuesLikeStrongOnes)
+{
+    using NodeHash = strong::transparent_hash<NodeId>;
+    using WyHash = strong::transparent_hash<WyId>;
+    static_assert(is_transparent_v<NodeHash>);
+    static_assert(is_transparent_v<strong::transparent_equal_to<NodeId>>);
+
+    ASSERT_EQ(NodeHash{}(std::uint32_t{7}), NodeHash{}(NodeId{7}));
+    ASSERT_EQ(NodeHash{}(std::uint32_t{7}), std::hash<NodeId>{}(NodeId{7}));
+    ASSERT_EQ(WyHash{}(std::uint64_t{7}), strong::hash_value(WyId{7}));
+    ASSERT_EQ(strong::transparent_hash<Name>{}(std::string("node")),
+              strong::hash_value(Name{"node"}));
+    // Tags select the mixer for raw values too.
+    ASSERT_NE(NodeHash{}(std::uint32_t{7}), WyHash{}(std::uint64_t{7}));
+
+    const strong::transparent_equal_to<NodeId> equal;
+    ASSERT_TRUE(equal(NodeId{3}, std::uint32_t{3}));
+    ASSERT_TRUE(equal(std::uint32_t{3}, NodeId{3}));
+    ASSERT_TRUE(equal(NodeId{3}, NodeId{3}));
+    ASSERT_FALSE(equal(NodeId{3}, std::uint32_t{4}));
+}
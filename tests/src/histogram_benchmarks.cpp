@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "strong_type/histogram.h"
+#include "strong_type/tsc.h"
+
+// Records of latencies into one histogram from 1 to 16 threads:
+// strong::histogram with a shard per thread ("sharded") and with a single
+// shard that all threads share ("shared"). "local" counts into a plain
+// array of the thread, the cost of bucketing alone.
+
+namespace
+{
+using Histogram = strong::histogram<strong::tsc_duration>;
+
+constexpr std::size_t kRecords = 1 << 12;
+
+enum class variant
+{
+    local,
+    shared,
+    sharded
+};
+
+Histogram gShared(1);
+Histogram gSharded;
+
+// Latencies of 100 to 100000 ticks, spread over many buckets.
+const std::vector<strong::tsc_duration> &latencies()
+{
+    static const std::vector<strong::tsc_duration> values = []
+    {
+        std::vector<strong::tsc_duration> result;
+        result.reserve(kRecords);
+        for (std::size_t i = 0; i < kRecords; ++i)
+        {
+            const auto spread = (i * 2654435761u) % 1000;
+            result.emplace_back(
+                static_cast<std::int64_t>(100 + spread * spread / 10));
+        }
+        return result;
+    }();
+    return values;
+}
+
+void BM_HistogramRecord(benchmark::State &aState, variant aVariant)
+{
+    const auto &values = latencies();
+    std::vector<std::uint64_t> local(Histogram::snapshot_type::bucket_count());
+    for (auto _: aState)
+    {
+        switch (aVariant)
+        {
+            case variant::local:
+                for (const strong::tsc_duration value: values)
+                {
+                    ++local[Histogram::bucket_of(value)];
+                }
+                benchmark::ClobberMemory();
+                break;
+            case variant::shared:
+                for (const strong::tsc_duration value: values)
+                {
+                    gShared.record(value);
+                }
+                break;
+            case variant::sharded:
+                for (const strong::tsc_duration value: values)
+                {
+                    gSharded.record(value);
+                }
+                break;
+        }
+    }
+    if (aState.thread_index() == 0)
+    {
+        benchmark::DoNotOptimize(local.data());
+        benchmark::DoNotOptimize(aVariant == variant::shared
+                                     ? gShared.snapshot().total()
+                                     : gSharded.snapshot().total());
+    }
+    aState.SetItemsProcessed(aState.iterations() *
+                             static_cast<std::int64_t>(kRecords));
+}
+
+void threads(benchmark::internal::Benchmark *aBenchmark)
+{
+    for (int count = 1; count <= 16; count *= 2)
+    {
+        aBenchmark->Threads(count);
+    }
+    aBenchmark->UseRealTime();
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_HistogramRecord, local, variant::local)->Apply(threads);
+BENCHMARK_CAPTURE(BM_HistogramRecord, shared, variant::shared)
+    ->Apply(threads);
+BENCHMARK_CAPTURE(BM_HistogramRecord, sharded, variant::sharded)
+    ->Apply(threads);
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "strong_type/histogram.h"
+#include "strong_type/tsc.h"
+
+namespace
+{
+using Latency = strong::strong_type<struct LatencyTag, std::uint32_t,
+                                    strong::plus, strong::comparisons>;
+using Histogram = strong::histogram<Latency>;
+}  // namespace
+
+TEST(HistogramTests, BucketsAreNarrowerThanPrecision)
+{
+    using Snapshot = Histogram::snapshot_type;
+    for (std::uint32_t value: {0u, 1u, 127u, 128u, 129u, 255u, 256u, 1000u,
+                               123456789u, 4294967295u})
+    {
+        const std::size_t bucket = Histogram::bucket_of(Latency{value});
+        ASSERT_LT(bucket, Snapshot::bucket_count());
+        ASSERT_LE(Snapshot::lowest_value(bucket), Latency{value});
+        ASSERT_GE(Snapshot::highest_value(bucket), Latency{value});
+        const auto width = Snapshot::highest_value(bucket).get() -
+                           Snapshot::lowest_value(bucket).get();
+        ASSERT_LE(width * 128u, value);
+    }
+    // Buckets are consecutive.
+    for (std::size_t i = 1; i < 2048; ++i)
+    {
+        ASSERT_EQ(Snapshot::highest_value(i - 1).get() + 1,
+                  Snapshot::lowest_value(i).get());
+    }
+    ASSERT_EQ(Histogram::bucket_of(Latency{127}) + 1,
+              Histogram::bucket_of(Latency{128}));
+    ASSERT_EQ(Histogram::bucket_of(Latency{256}),
+              Histogram::bucket_of(Latency{257}));
+}
+
+TEST(HistogramTests, Percentiles)
+{
+    Histogram histogram(2);
+    ASSERT_EQ(histogram.snapshot().total(), 0u);
+    ASSERT_EQ(histogram.snapshot().value_at_percentile(99.0), Latency{0});
+
+    for (std::uint32_t value = 1; value <= 100; ++value)
+    {
+        histogram.record(Latency{value});
+    }
+    histogram.record(Latency{100000}, 10);
+
+    const auto snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.total(), 110u);
+    ASSERT_EQ(snapshot.min(), Latency{1});
+    ASSERT_EQ(snapshot.value_at_percentile(0.0), Latency{1});
+    ASSERT_EQ(snapshot.value_at_percentile(50.0), Latency{55});
+    ASSERT_EQ(snapshot.value_at_percentile(90.0), Latency{99});
+    // 100000 is in a bucket of 512 values.
+    ASSERT_GE(snapshot.value_at_percentile(99.0), Latency{100000});
+    ASSERT_LT(snapshot.value_at_percentile(99.0), Latency{100512});
+    ASSERT_EQ(snapshot.max(), snapshot.value_at_percentile(100.0));
+
+    histogram.reset();
+    ASSERT_EQ(histogram.snapshot().total(), 0u);
+}
+
+TEST(HistogramTests, RecordsTscDurations)
+{
+    strong::histogram<strong::tsc_duration> histogram(1);
+    histogram.record(strong::tsc_duration{-5});
+    histogram.record(strong::tsc_duration{std::int64_t{1} << 62});
+    const auto snapshot = histogram.snapshot();
+    // Negative durations count as zero.
+    ASSERT_EQ(snapshot.min(), strong::tsc_duration{0});
+    ASSERT_GE(snapshot.max(), strong::tsc_duration{std::int64_t{1} << 62});
+    ASSERT_EQ(snapshot.count(0), 1u);
+}
+
+TEST(HistogramTests, ConcurrentRecords)
+{
+    constexpr std::size_t kThreads = 8;
+    constexpr std::uint32_t kRecords = 10000;
+    // Fewer shards than threads: some threads share a shard.
+    Histogram histogram(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back(
+            [&histogram]
+            {
+                for (std::uint32_t i = 0; i < kRecords; ++i)
+                {
+                    histogram.record(Latency{i % 100});
+                }
+            });
+    }
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+    const auto snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.total(), kThreads * kRecords);
+    ASSERT_EQ(snapshot.count(42), kThreads * kRecords / 100);
+}
+
+TEST(HistogramTests, MergesSnapshots)
+{
+    Histogram first(1);
+    Histogram second(1);
+    first.record(Latency{10}, 3);
+    second.record(Latency{10});
+    second.record(Latency{5000});
+
+    auto merged = first.snapshot();
+    merged += second.snapshot();
+    ASSERT_EQ(merged.total(), 5u);
+    ASSERT_EQ(merged.count(10), 4u);
+    ASSERT_EQ(merged.value_at_percentile(80.0), Latency{10});
+    ASSERT_GE(merged.max(), Latency{5000});
+}
+
+TEST(HistogramTests, DumpRoundTrip)
+{
+    Histogram histogram(1);
+    histogram.record(Latency{0});
+    histogram.record(Latency{7}, 300);
+    histogram.record(Latency{4000000000u}, 2);
+    const auto snapshot = histogram.snapshot();
+
+    std::vector<std::byte> bytes;
+    snapshot.dump(bytes);
+    // Header and a few bytes for each of the three buckets.
+    ASSERT_LE(bytes.size(), sizeof(strong::histogram_header) + 12);
+
+    Histogram::snapshot_type loaded;
+    ASSERT_EQ(Histogram::snapshot_type::load(bytes, loaded), std::errc());
+    ASSERT_EQ(loaded.total(), snapshot.total());
+    for (std::size_t i = 0; i < Histogram::snapshot_type::bucket_count(); ++i)
+    {
+        ASSERT_EQ(loaded.count(i), snapshot.count(i));
+    }
+
+    Histogram::snapshot_type empty;
+    std::vector<std::byte> emptyBytes;
+    empty.dump(emptyBytes);
+    ASSERT_EQ(emptyBytes.size(), sizeof(strong::histogram_header));
+    ASSERT_EQ(Histogram::snapshot_type::load(emptyBytes, loaded), std::errc());
+    ASSERT_EQ(loaded.total(), 0u);
+}
+
+TEST(HistogramTests, LoadRejectsOtherDumps)
+{
+    Histogram histogram(1);
+    histogram.record(Latency{300});
+    std::vector<std::byte> bytes;
+    histogram.snapshot().dump(bytes);
+
+    Histogram::snapshot_type loaded;
+    const std::vector<std::byte> truncated(bytes.begin(), bytes.end() - 1);
+    ASSERT_EQ(Histogram::snapshot_type::load(truncated, loaded),
+              std::errc::illegal_byte_sequence);
+    std::vector<std::byte> trailing = bytes;
+    trailing.push_back(std::byte{0});
+    ASSERT_EQ(Histogram::snapshot_type::load(trailing, loaded),
+              std::errc::illegal_byte_sequence);
+    // A count varint of 10 bytes with bits beyond 64 in the last one.
+    std::vector<std::byte> overlong(bytes.begin(), bytes.end() - 1);
+    overlong.insert(overlong.end(), 9, std::byte{0xFF});
+    overlong.push_back(std::byte{0x02});
+    ASSERT_EQ(Histogram::snapshot_type::load(overlong, loaded),
+              std::errc::illegal_byte_sequence);
+
+    using Coarse = strong::histogram_snapshot<Latency, 5>;
+    Coarse coarse;
+    ASSERT_EQ(Coarse::load(bytes, coarse), std::errc::invalid_argument);
+    using Wide = strong::histogram_snapshot<strong::tsc_duration>;
+    Wide wide;
+    ASSERT_EQ(Wide::load(bytes, wide), std::errc::invalid_argument);
+    ASSERT_EQ(loaded.total(), 0u);
+}
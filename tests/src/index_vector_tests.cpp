@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "strong_type/index_vector.h"
+
+namespace
+{
+using NodeId = strong::strong_type<struct NodeIdTag, std::uint32_t,
+                                   strong::comparisons>;
+using EdgeId =
+    strong::strong_type<struct EdgeIdTag, std::int32_t, strong::comparisons>;
+
+template <typename Container, typename Index, typename = void>
+struct is_subscriptable_with : std::false_type
+{
+};
+
+template <typename Container, typename Index>
+struct is_subscriptable_with<
+    Container, Index,
+    std::void_t<decltype(std::declval<Container&>()[std::declval<Index>()])>>
+    : std::true_type
+{
+};
+
+template <typename Container, typename Index>
+inline constexpr bool is_subscriptable_with_v =
+    is_subscriptable_with<Container, Index>::value;
+}  // namespace
+
+TEST(IndexVectorTests, SubscriptOnlyWithIndexType)
+{
+    using Nodes = strong::index_vector<NodeId, std::string>;
+    static_assert(is_subscriptable_with_v<Nodes, NodeId>,
+                  "index_vector must accept its index type.");
+    static_assert(!is_subscriptable_with_v<Nodes, EdgeId>,
+                  "index_vector must reject other strong types.");
+    static_assert(!is_subscriptable_with_v<Nodes, std::size_t>,
+                  "index_vector must reject raw integers.");
+    static_assert(!is_subscriptable_with_v<Nodes, int>,
+                  "index_vector must reject raw integers.");
+}
+
+TEST(IndexVectorTests, EmplaceBackReturnsIndex)
+{
+    strong::index_vector<NodeId, std::string> nodes;
+    nodes.reserve(3);
+    ASSERT_EQ(nodes.next_index(), NodeId{0});
+    const NodeId a = nodes.emplace_back("a");
+    const NodeId b = nodes.emplace_back(2, 'b');
+    const NodeId c = nodes.push_back(std::string("c"));
+    ASSERT_EQ(a, NodeId{0});
+    ASSERT_EQ(b, NodeId{1});
+    ASSERT_EQ(c, NodeId{2});
+    ASSERT_EQ(nodes.next_index(), NodeId{3});
+    ASSERT_EQ(nodes.size(), 3u);
+    ASSERT_GE(nodes.capacity(), 3u);
+    ASSERT_EQ(nodes[a], "a");
+    ASSERT_EQ(nodes[b], "bb");
+    ASSERT_EQ(nodes[c], "c");
+
+    nodes[b] = "changed";
+    ASSERT_EQ(nodes[b], "changed");
+    nodes.pop_back();
+    ASSERT_FALSE(nodes.contains(c));
+    ASSERT_EQ(nodes.next_index(), c);
+}
+
+TEST(IndexVectorTests, GrowingBeyondIndexRangeThrows)
+{
+    using SmallId = strong::strong_type<struct SmallIdTag, std::uint8_t,
+                                        strong::comparisons>;
+    using SignedId = strong::strong_type<struct SignedIdTag, std::int8_t>;
+
+    strong::index_vector<SmallId, int> values;
+    ASSERT_EQ(values.max_size(), 256u);
+    ASSERT_EQ((strong::index_vector<SignedId, int>{}.max_size()), 128u);
+    const std::size_t nodeCount = std::min<std::size_t>(
+        std::size_t{1} << 32, std::vector<char>{}.max_size());
+    ASSERT_EQ((strong::index_vector<NodeId, char>{}.max_size()), nodeCount);
+
+    for (int i = 0; i < 256; ++i)
+    {
+        values.push_back(i);
+    }
+    ASSERT_EQ(values.back(), 255);
+    ASSERT_EQ(values[SmallId{255}], 255);
+    ASSERT_THROW(values.push_back(256), std::length_error);
+    ASSERT_EQ(values.size(), 256u);
+
+    values.clear();
+    ASSERT_THROW(values.resize(257), std::length_error);
+    ASSERT_THROW(values.reserve(257), std::length_error);
+    ASSERT_TRUE(values.empty());
+    values.resize(256);
+    ASSERT_EQ(values.size(), 256u);
+    ASSERT_THROW((strong::index_vector<SmallId, int>(257)),
+                 std::length_error);
+}
+
+TEST(IndexVectorTests, Contains)
+{
+    const strong::index_vector<EdgeId, double> edges(2, 1.5);
+    ASSERT_TRUE(edges.contains(EdgeId{0}));
+    ASSERT_TRUE(edges.contains(EdgeId{1}));
+    ASSERT_FALSE(edges.contains(EdgeId{2}));
+    ASSERT_FALSE(edges.contains(EdgeId{-1}));
+    ASSERT_DOUBLE_EQ(edges[EdgeId{1}], 1.5);
+}
+
+TEST(IndexVectorTests, Indices)
+{
+    strong::index_vector<NodeId, int> nodes;
+    for (int i = 0; i < 5; ++i)
+    {
+        nodes.emplace_back(i * 10);
+    }
+    std::vector<NodeId> visited;
+    for (const NodeId id: nodes.indices())
+    {
+        ASSERT_EQ(nodes[id], static_cast<int>(id.get()) * 10);
+        visited.push_back(id);
+    }
+    ASSERT_EQ(visited.size(), nodes.size());
+    ASSERT_EQ(visited.back(), NodeId{4});
+}
+
+TEST(IndexVectorTests, ElementsLiveInArena)
+{
+    alignas(std::max_align_t) std::byte buffer[1024];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                              std::pmr::null_memory_resource());
+    strong::pmr::index_vector<NodeId, std::uint64_t> nodes(&arena);
+    nodes.reserve(16);
+    for (std::uint64_t i = 0; i < 16; ++i)
+    {
+        nodes.emplace_back(i);
+    }
+    const auto *first = reinterpret_cast<const std::byte *>(nodes.data());
+    ASSERT_GE(first, buffer);
+    ASSERT_LE(first + nodes.size() * sizeof(std::uint64_t),
+              buffer + sizeof(buffer));
+    ASSERT_EQ(nodes[NodeId{15}], 15u);
+    ASSERT_EQ(nodes.get_allocator().resource(), &arena);
+}
+
+TEST(IndexVectorTests, IndexArray)
+{
+    strong::index_array<EdgeId, int, 4> weights{};
+    static_assert(is_subscriptable_with_v<decltype(weights), EdgeId>,
+                  "index_array must accept its index type.");
+    static_assert(!is_subscriptable_with_v<decltype(weights), int>,
+                  "index_array must reject raw integers.");
+    static_assert(sizeof(weights) == 4 * sizeof(int),
+                  "index_array must not add storage.");
+    weights.fill(7);
+    weights[EdgeId{2}] = 3;
+    ASSERT_EQ(weights.size(), 4u);
+    ASSERT_EQ(weights[EdgeId{0}], 7);
+    ASSERT_EQ(weights[EdgeId{2}], 3);
+    ASSERT_TRUE(weights.contains(EdgeId{3}));
+    ASSERT_FALSE(weights.contains(EdgeId{4}));
+    int sum = 0;
+    for (const EdgeId id: weights.indices())
+    {
+        sum += weights[id];
+    }
+    ASSERT_EQ(sum, 24);
+}
+
+TEST(IndexVectorTests, ConstexprIndexArray)
+{
+    constexpr strong::index_array<EdgeId, int, 3> values{{1, 2, 3}};
+    static_assert(values[EdgeId{1}] == 2, "Invalid element.");
+    static_assert(values.contains(EdgeId{2}), "Invalid contains.");
+}
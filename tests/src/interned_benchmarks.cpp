@@ -0,0 +1,155 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "strong_type/interned.h"
+
+// Interning of strings that are mostly known already, from 1 to 16 threads:
+// std::unordered_map behind a std::shared_mutex ("shared_mutex") and
+// strong::intern ("interned"). Then lookups in std::unordered_map keyed by
+// std::string ("string") and by the interned id ("interned").
+
+namespace
+{
+using MetricName = strong::interned<struct MetricNameTag>;
+
+constexpr std::size_t kNames = 4096;
+
+const std::vector<std::string> &names()
+{
+    static const std::vector<std::string> result = []
+    {
+        std::vector<std::string> values;
+        for (std::size_t i = 0; i < kNames; ++i)
+        {
+            values.push_back("service.requests." + std::to_string(i) +
+                             ".latency_us");
+        }
+        return values;
+    }();
+    return result;
+}
+
+class locked_table
+{
+   public:
+    std::uint32_t intern(std::string_view aString)
+    {
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            const auto found = ids_.find(std::string(aString));
+            if (found != ids_.end())
+            {
+                return found->second;
+            }
+        }
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        const auto id = static_cast<std::uint32_t>(ids_.size());
+        return ids_.emplace(std::string(aString), id).first->second;
+    }
+
+   private:
+    std::shared_mutex mutex_;
+    std::unordered_map<std::string, std::uint32_t> ids_;
+};
+
+template <bool Interned>
+void BM_Intern(benchmark::State &aState)
+{
+    static locked_table table;
+    static std::atomic<std::uint64_t> fresh{0};
+    const auto &strings = names();
+    // Every name is interned once before measuring; one string in 64 is
+    // then new, the rest are readers' hits.
+    std::size_t index = static_cast<std::size_t>(aState.thread_index()) * 97;
+    for (const auto &string: strings)
+    {
+        if constexpr (Interned)
+        {
+            benchmark::DoNotOptimize(
+                strong::intern<struct MetricNameTag>(string));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(table.intern(string));
+        }
+    }
+    std::string scratch;
+    for (auto _: aState)
+    {
+        std::string_view string = strings[index % kNames];
+        if (++index % 64 == 0)
+        {
+            scratch = "fresh." + std::to_string(fresh.fetch_add(
+                                     1, std::memory_order_relaxed));
+            string = scratch;
+        }
+        if constexpr (Interned)
+        {
+            benchmark::DoNotOptimize(
+                strong::intern<struct MetricNameTag>(string));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(table.intern(string));
+        }
+    }
+    aState.SetItemsProcessed(aState.iterations());
+}
+
+template <bool Interned>
+void BM_InternedMapFind(benchmark::State &aState)
+{
+    const auto &strings = names();
+    std::unordered_map<std::string, std::uint64_t> byString;
+    std::unordered_map<MetricName, std::uint64_t> byId;
+    std::vector<MetricName> ids;
+    for (std::size_t i = 0; i < kNames; ++i)
+    {
+        byString.emplace(strings[i], i);
+        ids.push_back(strong::intern<struct MetricNameTag>(strings[i]));
+        byId.emplace(ids.back(), i);
+    }
+    std::size_t index = 0;
+    std::uint64_t sum = 0;
+    for (auto _: aState)
+    {
+        index = (index + 97) % kNames;
+        if constexpr (Interned)
+        {
+            sum += byId.find(ids[index])->second;
+        }
+        else
+        {
+            sum += byString.find(strings[index])->second;
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    aState.SetItemsProcessed(aState.iterations());
+}
+
+void threads(benchmark::internal::Benchmark *aBenchmark)
+{
+    for (int count = 1; count <= 16; count *= 2)
+    {
+        aBenchmark->Threads(count);
+    }
+    aBenchmark->UseRealTime();
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Intern, false)
+    ->Name("BM_Intern/shared_mutex")
+    ->Apply(threads);
+BENCHMARK_TEMPLATE(BM_Intern, true)->Name("BM_Intern/interned")->Apply(threads);
+BENCHMARK_TEMPLATE(BM_InternedMapFind, false)
+    ->Name("BM_InternedMapFind/string");
+BENCHMARK_TEMPLATE(BM_InternedMapFind, true)
+    ->Name("BM_InternedMapFind/interned");
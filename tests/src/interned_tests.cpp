@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "strong_type/interned.h"
+
+namespace
+{
+using MetricName = strong::interned<struct MetricNameTag>;
+using TenantName = strong::interned<struct TenantNameTag>;
+using StressName = strong::interned<struct StressNameTag>;
+
+std::string make_name(std::size_t aIndex)
+{
+    return "metric." + std::to_string(aIndex * 7919 % 100003) + ".count";
+}
+}  // namespace
+
+TEST(InternedTests, EqualStringsHaveEqualIds)
+{
+    const MetricName a = strong::intern<struct MetricNameTag>("cpu.user");
+    const std::string copy = "cpu.user";
+    const MetricName b = strong::intern<struct MetricNameTag>(copy);
+    const MetricName c = strong::intern<struct MetricNameTag>("cpu.system");
+    ASSERT_EQ(a, b);
+    ASSERT_NE(a, c);
+    ASSERT_EQ(a.view(), "cpu.user");
+    ASSERT_EQ(c.view(), "cpu.system");
+    ASSERT_NE(a.view().data(), copy.data());
+    ASSERT_EQ(std::hash<MetricName>{}(a), std::hash<MetricName>{}(b));
+
+    auto &table = strong::intern_table<struct MetricNameTag>::instance();
+    ASSERT_EQ(table.find("cpu.user"), a);
+    ASSERT_FALSE(table.find("cpu.idle").has_value());
+}
+
+TEST(InternedTests, EmptyStringIsValueInitializedId)
+{
+    ASSERT_EQ(MetricName{}.view(), "");
+    ASSERT_EQ(strong::intern<struct MetricNameTag>(""), MetricName{});
+    const std::string withNull("a\0b", 3);
+    ASSERT_EQ(strong::intern<struct MetricNameTag>(withNull).view(), withNull);
+}
+
+TEST(InternedTests, TablesOfTagsAreIndependent)
+{
+    static_assert(!std::is_same_v<MetricName, TenantName>);
+    const TenantName tenant = strong::intern<struct TenantNameTag>("acme");
+    ASSERT_EQ(tenant.get(), 1u);
+    ASSERT_EQ(strong::intern_table<struct TenantNameTag>::instance().size(),
+              2u);
+    ASSERT_EQ(tenant.view(), "acme");
+}
+
+TEST(InternedTests, ManyStrings)
+{
+    constexpr std::size_t kCount = 20000;
+    std::vector<MetricName> ids;
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        ids.push_back(strong::intern<struct MetricNameTag>(make_name(i)));
+    }
+    std::unordered_set<MetricName> unique(ids.begin(), ids.end());
+    ASSERT_EQ(unique.size(), kCount);
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        ASSERT_EQ(ids[i].view(), make_name(i));
+        ASSERT_EQ(strong::intern<struct MetricNameTag>(make_name(i)), ids[i]);
+    }
+}
+
+TEST(InternedTests, ConcurrentInterning)
+{
+    constexpr std::size_t kThreads = 4;
+    constexpr std::size_t kCount = 5000;
+    std::vector<std::vector<StressName>> ids(kThreads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back(
+            [&ids, t]
+            {
+                // Threads intern the same strings in different orders.
+                for (std::size_t i = 0; i < kCount; ++i)
+                {
+                    const std::size_t index =
+                        t % 2 == 0 ? i : kCount - 1 - i;
+                    ids[t].push_back(strong::intern<struct StressNameTag>(
+                        make_name(index)));
+                }
+            });
+    }
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(strong::intern_table<struct StressNameTag>::instance().size(),
+              kCount + 1);
+    for (std::size_t t = 0; t < kThreads; ++t)
+    {
+        for (std::size_t i = 0; i < kCount; ++i)
+        {
+            const std::size_t index = t % 2 == 0 ? i : kCount - 1 - i;
+            ASSERT_EQ(ids[t][i], ids[0][index]);
+            ASSERT_EQ(ids[t][i].view(), make_name(index));
+        }
+    }
+}
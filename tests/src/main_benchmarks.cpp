@@ -0,0 +1,163 @@
+#include <benchmark/benchmark.h>
+
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr char kMaxRatioFlag[] = "--max_ratio=";
+constexpr double kDefaultMaxRatio = 1.25;
+constexpr char kRatioPrefix[] = "ratio/";
+
+// Benchmarks registered as "ratio/<name>/raw/<args>" and
+// "ratio/<name>/strong/<args>" are twins: the same kernel over raw T and over
+// strong::strong_type. This reporter pairs them up and computes strong/raw
+// ratio of their CPU times. Benchmarks without the prefix are only reported.
+// With --benchmark_repetitions the fastest repetition of each side is used,
+// which filters out most of the scheduling noise of shared machines.
+class ratio_reporter final : public benchmark::ConsoleReporter
+{
+   public:
+    void ReportRuns(const std::vector<Run> &aRuns) override
+    {
+        ConsoleReporter::ReportRuns(aRuns);
+        for (const auto &run: aRuns)
+        {
+            if (run.run_type != Run::RT_Iteration)
+            {
+                continue;
+            }
+            const std::string fullName = run.benchmark_name();
+            if (fullName.compare(0, sizeof(kRatioPrefix) - 1, kRatioPrefix) !=
+                0)
+            {
+                continue;
+            }
+            const std::string name = fullName.substr(sizeof(kRatioPrefix) - 1);
+            const auto first = name.find('/');
+            if (first == std::string::npos)
+            {
+                continue;
+            }
+            const auto second = name.find('/', first + 1);
+            const auto kind = name.substr(first + 1, second - first - 1);
+            const auto key =
+                name.substr(0, first) +
+                (second == std::string::npos ? "" : name.substr(second));
+            if (kind == "raw")
+            {
+                record(raw_, key, run.GetAdjustedCPUTime());
+            }
+            else if (kind == "strong")
+            {
+                record(strong_, key, run.GetAdjustedCPUTime());
+            }
+        }
+    }
+
+    bool check(double aMaxRatio) const
+    {
+        bool success = true;
+        for (const auto &[key, strongTime]: strong_)
+        {
+            const auto raw = raw_.find(key);
+            if (raw == raw_.end() || raw->second <= 0.0)
+            {
+                continue;
+            }
+            const double ratio = strongTime / raw->second;
+            const bool passed = ratio <= aMaxRatio;
+            std::printf("%-48s strong/raw = %6.3f %s\n", key.c_str(), ratio,
+                        passed ? "" : "<-- exceeds threshold");
+            success = success && passed;
+        }
+        return success;
+    }
+
+   private:
+    static void record(std::map<std::string, double> &aTimes,
+                       const std::string &aKey, double aTime)
+    {
+        const auto [it, inserted] = aTimes.emplace(aKey, aTime);
+        if (!inserted && aTime < it->second)
+        {
+            it->second = aTime;
+        }
+    }
+
+    std::map<std::string, double> raw_;
+    std::map<std::string, double> strong_;
+};
+
+// Positive finite number in aText, or 0 if aText is anything else.
+double parse_max_ratio(const char *aText)
+{
+    char *end = nullptr;
+    errno = 0;
+    const double value = std::strtod(aText, &end);
+    if (end == aText || *end != '\0' || errno == ERANGE ||
+        !std::isfinite(value) || !(value > 0.0))
+    {
+        return 0.0;
+    }
+    return value;
+}
+
+// Removes --max_ratio=<value> from the arguments and stores its value in
+// aMaxRatio. Returns false if the value is not a positive number.
+bool extract_max_ratio(int &aArgc, char **aArgv, double &aMaxRatio)
+{
+    aMaxRatio = kDefaultMaxRatio;
+    int dst = 1;
+    for (int src = 1; src < aArgc; ++src)
+    {
+        if (std::strncmp(aArgv[src], kMaxRatioFlag,
+                         sizeof(kMaxRatioFlag) - 1) == 0)
+        {
+            const char *text = aArgv[src] + sizeof(kMaxRatioFlag) - 1;
+            aMaxRatio = parse_max_ratio(text);
+            if (aMaxRatio == 0.0)
+            {
+                std::fprintf(stderr,
+                             "Invalid %s'%s': expected a positive number.\n",
+                             kMaxRatioFlag, text);
+                return false;
+            }
+        }
+        else
+        {
+            aArgv[dst++] = aArgv[src];
+        }
+    }
+    aArgc = dst;
+    return true;
+}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    double maxRatio = kDefaultMaxRatio;
+    if (!extract_max_ratio(argc, argv, maxRatio))
+    {
+        return 1;
+    }
+
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    ratio_reporter reporter;
+    ::benchmark::RunSpecifiedBenchmarks(&reporter);
+    ::benchmark::Shutdown();
+
+    std::printf("\nMaximum allowed strong/raw ratio: %.3f\n", maxRatio);
+    return reporter.check(maxRatio) ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "strong_type/simd.h"
+
+// Cost of overflow policies against unchecked plus: element-wise loops over
+// uint32 ids with every policy, and bulk SIMD transform with wrapping and
+// saturating addition of 8- and 16-bit values.
+
+namespace
+{
+template <typename T>
+using Unchecked =
+    strong::strong_type<struct UncheckedTag, T, strong::plus>;
+template <typename T>
+using Wrapping =
+    strong::strong_type<struct WrappingTag, T, strong::wrapping_plus>;
+template <typename T>
+using Saturating =
+    strong::strong_type<struct SaturatingTag, T, strong::saturating_plus>;
+template <typename T>
+using Checked =
+    strong::strong_type<struct CheckedTag, T, strong::checked_plus>;
+
+template <typename T>
+struct type_tag
+{
+    using type = T;
+};
+
+// Values use all bits but the top two, so that sums of uint32 values never
+// overflow and checked_plus never terminates the benchmark.
+template <typename StrongT>
+std::vector<StrongT> make_values(std::size_t aCount, std::uint32_t aSeed,
+                                 unsigned aShift)
+{
+    using T = strong::underlying_type<StrongT>;
+    std::vector<StrongT> values;
+    values.reserve(aCount);
+    std::uint32_t state = aSeed;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        state = state * 1664525u + 1013904223u;
+        values.emplace_back(static_cast<T>(state >> aShift));
+    }
+    return values;
+}
+
+template <typename StrongT>
+void BM_PolicyPlus(benchmark::State &aState, type_tag<StrongT>)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto lhs = make_values<StrongT>(count, 1, 2);
+    const auto rhs = make_values<StrongT>(count, 2, 2);
+    std::vector<StrongT> result(count);
+    for (auto _: aState)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result[i] = lhs[i] + rhs[i];
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+// Bulk addition with the policy of StrongT: wrapping op::add for plus and
+// op::saturating_add for saturating_plus.
+template <typename StrongT>
+void BM_PolicyTransform(benchmark::State &aState, type_tag<StrongT>)
+{
+    constexpr auto kOp = strong::has_op_v<StrongT, strong::saturating_plus>
+                             ? strong::simd::op::saturating_add
+                             : strong::simd::op::add;
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    // Full range values: about half of the sums overflow.
+    const auto lhs = make_values<StrongT>(count, 3, 8);
+    const auto rhs = make_values<StrongT>(count, 4, 8);
+    std::vector<StrongT> result(count);
+    for (auto _: aState)
+    {
+        strong::simd::transform<kOp>(lhs, rhs, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+template <typename StrongT>
+void BM_SaturatingLoop(benchmark::State &aState, type_tag<StrongT>)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto lhs = make_values<StrongT>(count, 3, 8);
+    const auto rhs = make_values<StrongT>(count, 4, 8);
+    std::vector<StrongT> result(count);
+    for (auto _: aState)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result[i] = lhs[i] + rhs[i];
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+constexpr std::int64_t kSmall = 1 << 10;
+constexpr std::int64_t kLarge = 1 << 20;
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_PolicyPlus, unchecked,
+                  type_tag<Unchecked<std::uint32_t>>{})
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_PolicyPlus, wrapping, type_tag<Wrapping<std::uint32_t>>{})
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_PolicyPlus, saturating,
+                  type_tag<Saturating<std::uint32_t>>{})
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_PolicyPlus, checked, type_tag<Checked<std::uint32_t>>{})
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_PolicyTransform, unchecked_u8,
+                  type_tag<Unchecked<std::uint8_t>>{})
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_PolicyTransform, saturating_u8,
+                  type_tag<Saturating<std::uint8_t>>{})
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_SaturatingLoop, saturating_u8,
+                  type_tag<Saturating<std::uint8_t>>{})
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_PolicyTransform, unchecked_i16,
+                  type_tag<Unchecked<std::int16_t>>{})
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_PolicyTransform, saturating_i16,
+                  type_tag<Saturating<std::int16_t>>{})
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_SaturatingLoop, saturating_i16,
+                  type_tag<Saturating<std::int16_t>>{})
+    ->Arg(kSmall)
+    ->Arg(kLarge);
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "strong_type/packed.h"
+
+// Extraction of the 16-bit generation of 64-bit handles: hand-written shift
+// and mask of raw words ("raw"), packed::get() in a loop ("strong") and
+// simd::unpack ("simd").
+
+namespace
+{
+using Slot = strong::strong_type<struct SlotTag, std::uint32_t>;
+using Generation = strong::strong_type<struct GenerationTag, std::uint16_t>;
+using Shard = strong::strong_type<struct ShardTag, std::uint16_t>;
+using Handle =
+    strong::packed<std::uint64_t, strong::field<Slot, 32>,
+                   strong::field<Generation, 16>, strong::field<Shard, 10>>;
+
+std::vector<std::uint64_t> make_words(std::size_t aCount)
+{
+    std::vector<std::uint64_t> words(aCount);
+    std::uint64_t state = 1;
+    for (auto &word: words)
+    {
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        word = state;
+    }
+    return words;
+}
+
+std::vector<Handle> make_handles(std::size_t aCount)
+{
+    std::vector<Handle> handles;
+    handles.reserve(aCount);
+    for (const auto word: make_words(aCount))
+    {
+        handles.push_back(Handle::from_word(word));
+    }
+    return handles;
+}
+
+void BM_UnpackRaw(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto words = make_words(count);
+    std::vector<std::uint16_t> result(count);
+    for (auto _: aState)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result[i] = static_cast<std::uint16_t>((words[i] >> 32) & 0xFFFFu);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+void BM_UnpackStrong(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto handles = make_handles(count);
+    std::vector<Generation> result(count);
+    for (auto _: aState)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result[i] = handles[i].get<Generation>();
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+void BM_UnpackSimd(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto handles = make_handles(count);
+    std::vector<Generation> result(count);
+    for (auto _: aState)
+    {
+        strong::simd::unpack<Generation>(handles, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+constexpr std::int64_t kSmall = 1 << 10;
+constexpr std::int64_t kLarge = 1 << 18;
+}  // namespace
+
+BENCHMARK(BM_UnpackRaw)
+    ->Name("ratio/BM_Unpack/raw")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK(BM_UnpackStrong)
+    ->Name("ratio/BM_Unpack/strong")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK(BM_UnpackSimd)->Name("BM_Unpack/simd")->Arg(kSmall)->Arg(kLarge);
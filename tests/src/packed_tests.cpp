@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "simd_test_support.h"
+#include "strong_type/packed.h"
+
+namespace
+{
+using simd_test::kSizes;
+using simd_test::kTargets;
+
+using Slot = strong::strong_type<struct SlotTag, std::uint32_t,
+                                 strong::comparisons>;
+using Generation = strong::strong_type<struct GenerationTag, std::uint16_t,
+                                       strong::comparisons>;
+using Shard =
+    strong::strong_type<struct ShardTag, std::uint16_t, strong::comparisons>;
+using Flag =
+    strong::strong_type<struct FlagTag, std::uint8_t, strong::comparisons>;
+using Epoch = strong::strong_type<struct EpochTag, std::uint64_t,
+                                  strong::comparisons>;
+
+using Handle =
+    strong::packed<std::uint64_t, strong::field<Slot, 32>,
+                   strong::field<Generation, 16>, strong::field<Shard, 10>>;
+using SmallHandle =
+    strong::packed<std::uint32_t, strong::field<Flag, 3>,
+                   strong::field<Generation, 12>, strong::field<Slot, 17>>;
+using Stamp = strong::packed<std::uint64_t, strong::field<Epoch, 64>>;
+
+template <typename PackedT>
+std::vector<PackedT> make_packed(std::size_t aCount, std::uint64_t aSeed)
+{
+    using Word = typename PackedT::word_type;
+    std::vector<PackedT> words;
+    words.reserve(aCount);
+    for (const std::uint64_t word: simd_test::make_words(aCount, aSeed))
+    {
+        words.push_back(PackedT::from_word(static_cast<Word>(word)));
+    }
+    return words;
+}
+
+template <typename StrongT, typename PackedT>
+void check_unpack()
+{
+    for (const auto target: kTargets)
+    {
+        if (!strong::simd::is_supported(target))
+        {
+            continue;
+        }
+        for (const auto size: kSizes)
+        {
+            const auto words = make_packed<PackedT>(size, size + 1);
+            std::vector<StrongT> out(size);
+            strong::simd::unpack<StrongT>(words, out, target);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(out[i], words[i].template get<StrongT>())
+                    << "target " << static_cast<int>(target) << ", size "
+                    << size << ", index " << i;
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST(PackedTests, LayoutIsComputedAtCompileTime)
+{
+    static_assert(sizeof(Handle) == sizeof(std::uint64_t));
+    static_assert(Handle::shift<Slot> == 0);
+    static_assert(Handle::shift<Generation> == 32);
+    static_assert(Handle::shift<Shard> == 48);
+    static_assert(Handle::mask<Generation> == 0x0000FFFF00000000u);
+    static_assert(Handle::mask<Shard> == 0x03FF000000000000u);
+    static_assert(SmallHandle::mask<Slot> == 0xFFFF8000u);
+    static_assert(Stamp::mask<Epoch> == ~std::uint64_t{0});
+}
+
+TEST(PackedTests, FieldsAreIndependent)
+{
+    constexpr Handle kHandle(Slot{0xDEADBEEF}, Generation{0x1234},
+                             Shard{0x2AB});
+    static_assert(kHandle.word() == 0x02AB1234DEADBEEFu);
+    static_assert(kHandle.get<Slot>() == Slot{0xDEADBEEF});
+    static_assert(kHandle.get<Generation>() == Generation{0x1234});
+    static_assert(kHandle.get<Shard>() == Shard{0x2AB});
+
+    Handle handle = kHandle;
+    handle.set(Generation{0xFFFF});
+    ASSERT_EQ(handle.get<Slot>(), Slot{0xDEADBEEF});
+    ASSERT_EQ(handle.get<Generation>(), Generation{0xFFFF});
+    ASSERT_EQ(handle.get<Shard>(), Shard{0x2AB});
+    handle.set(Generation{0x1234});
+    ASSERT_EQ(handle, kHandle);
+    handle.set(Shard{0});
+    ASSERT_NE(handle, kHandle);
+    ASSERT_EQ(handle.word(), 0x00001234DEADBEEFu);
+
+    // Bits above the fields are not touched by set() and ignored by get().
+    auto unused = Handle::from_word(0xFC00000000000000u);
+    unused.set(Shard{0x3FF});
+    ASSERT_EQ(unused.word(), ~std::uint64_t{0} << 48);
+    ASSERT_EQ(unused.get<Shard>(), Shard{0x3FF});
+
+    Stamp stamp(Epoch{~std::uint64_t{0}});
+    ASSERT_EQ(stamp.get<Epoch>(), Epoch{~std::uint64_t{0}});
+}
+
+TEST(PackedTests, UnpackMatchesGet)
+{
+    check_unpack<Slot, Handle>();
+    check_unpack<Generation, Handle>();
+    check_unpack<Shard, Handle>();
+    check_unpack<Flag, SmallHandle>();
+    check_unpack<Generation, SmallHandle>();
+    check_unpack<Slot, SmallHandle>();
+    check_unpack<Epoch, Stamp>();
+}
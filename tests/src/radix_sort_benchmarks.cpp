@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "strong_type/radix_sort.h"
+
+// Sorting of random strong ids (uint32) and timestamps (int64):
+// std::sort through strong::comparisons ("std_sort"), a reused
+// strong::radix_sorter ("radix") and one with 4 threads
+// ("radix_parallel"). Every iteration also copies the unsorted input,
+// which all variants pay.
+
+namespace
+{
+using UserId = strong::strong_type<struct UserIdTag, std::uint32_t,
+                                   strong::comparisons>;
+using Timestamp = strong::strong_type<struct TimestampTag, std::int64_t,
+                                      strong::comparisons>;
+
+enum class variant
+{
+    std_sort,
+    radix,
+    radix_parallel
+};
+
+template <typename StrongT>
+std::vector<StrongT> make_input(std::size_t aCount)
+{
+    using T = strong::underlying_type<StrongT>;
+    std::mt19937_64 random(aCount);
+    std::vector<StrongT> values;
+    values.reserve(aCount);
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        values.emplace_back(static_cast<T>(random()));
+    }
+    return values;
+}
+
+template <typename StrongT, variant V>
+void BM_Sort(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto input = make_input<StrongT>(count);
+    std::vector<StrongT> values(count);
+    strong::radix_sorter<StrongT> sorter(V == variant::radix_parallel ? 4
+                                                                      : 1);
+    for (auto _: aState)
+    {
+        std::copy(input.begin(), input.end(), values.begin());
+        if constexpr (V == variant::std_sort)
+        {
+            std::sort(values.begin(), values.end());
+        }
+        else
+        {
+            sorter.sort(values);
+        }
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+void sizes(benchmark::internal::Benchmark *aBenchmark)
+{
+    for (std::int64_t count = 1 << 10; count <= 1 << 22; count <<= 4)
+    {
+        aBenchmark->Arg(count);
+    }
+    aBenchmark->Unit(benchmark::kMicrosecond)->UseRealTime();
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Sort, UserId, variant::std_sort)
+    ->Name("BM_SortIds/std_sort")
+    ->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Sort, UserId, variant::radix)
+    ->Name("BM_SortIds/radix")
+    ->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Sort, UserId, variant::radix_parallel)
+    ->Name("BM_SortIds/radix_parallel")
+    ->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Sort, Timestamp, variant::std_sort)
+    ->Name("BM_SortTimestamps/std_sort")
+    ->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Sort, Timestamp, variant::radix)
+    ->Name("BM_SortTimestamps/radix")
+    ->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Sort, Timestamp, variant::radix_parallel)
+    ->Name("BM_SortTimestamps/radix_parallel")
+    ->Apply(sizes);
@@ -0,0 +1,258 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "strong_type/radix_sort.h"
+
+namespace
+{
+using UserId = strong::strong_type<struct UserIdTag, std::uint32_t,
+                                   strong::comparisons>;
+using Timestamp = strong::strong_type<struct TimestampTag, std::int64_t,
+                                      strong::comparisons>;
+using Level = strong::strong_type<struct LevelTag, std::int8_t,
+                                  strong::comparisons>;
+using Flag = strong::strong_type<struct FlagTag, bool, strong::comparisons>;
+
+// Priority in the low half, sequence number in the high half; sorted by
+// priority first, see radix_key<Job> below.
+using Job =
+    strong::strong_type<struct JobTag, std::uint32_t, strong::comparisons>;
+
+template <typename StrongT, typename Random>
+std::vector<StrongT> random_values(std::size_t aCount, Random &aRandom)
+{
+    using T = strong::underlying_type<StrongT>;
+    std::uniform_int_distribution<std::int64_t> distribution(
+        std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+    std::vector<StrongT> values;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        values.emplace_back(static_cast<T>(distribution(aRandom)));
+    }
+    return values;
+}
+}  // namespace
+
+TEST(RadixSortTests, Keys)
+{
+    static_assert(strong::is_radix_sortable_v<UserId>);
+    static_assert(!strong::is_radix_sortable_v<Flag>);
+    static_assert(!strong::is_radix_sortable_v<std::uint32_t>);
+    static_assert(
+        std::is_same_v<strong::radix_key<Timestamp>::type, std::uint64_t>);
+
+    std::mt19937_64 random(42);
+    auto ids = random_values<UserId>(10000, random);
+    auto expected = ids;
+    std::sort(expected.begin(), expected.end());
+    strong::radix_sort(ids);
+    ASSERT_EQ(ids, expected);
+}
+
+TEST(RadixSortTests, SignedKeys)
+{
+    std::mt19937_64 random(7);
+    auto timestamps = random_values<Timestamp>(5000, random);
+    timestamps.push_back(Timestamp{std::numeric_limits<std::int64_t>::min()});
+    timestamps.push_back(Timestamp{std::numeric_limits<std::int64_t>::max()});
+    timestamps.push_back(Timestamp{0});
+    timestamps.push_back(Timestamp{-1});
+    auto expected = timestamps;
+    std::sort(expected.begin(), expected.end());
+    strong::radix_sort(timestamps);
+    ASSERT_EQ(timestamps, expected);
+
+    std::array<Level, 5> levels{Level{3}, Level{-128}, Level{127}, Level{-1},
+                                Level{0}};
+    strong::radix_sort(levels);
+    ASSERT_TRUE(std::is_sorted(levels.begin(), levels.end()));
+    ASSERT_EQ(levels[0], Level{-128});
+}
+
+TEST(RadixSortTests, SmallAndSkippedPasses)
+{
+    std::vector<Timestamp> empty;
+    strong::radix_sort(empty);
+    ASSERT_TRUE(empty.empty());
+    std::vector<Timestamp> single{Timestamp{5}};
+    strong::radix_sort(single);
+    ASSERT_EQ(single[0], Timestamp{5});
+
+    // Only the lowest byte differs: one pass, result back in the input.
+    std::vector<Timestamp> small{Timestamp{3}, Timestamp{1}, Timestamp{2}};
+    strong::radix_sort(small);
+    ASSERT_EQ(small,
+              (std::vector<Timestamp>{Timestamp{1}, Timestamp{2},
+                                      Timestamp{3}}));
+
+    std::vector<UserId> equal(100, UserId{0x01020304});
+    strong::radix_sort(equal);
+    ASSERT_EQ(equal, std::vector<UserId>(100, UserId{0x01020304}));
+}
+
+TEST(RadixSortTests, KeyValuePairsAreStable)
+{
+    std::mt19937_64 random(3);
+    std::uniform_int_distribution<std::uint32_t> distribution(0, 50000);
+    std::vector<UserId> keys;
+    std::vector<std::string> values;
+    for (std::size_t i = 0; i < 3000; ++i)
+    {
+        keys.emplace_back(distribution(random));
+        values.push_back(std::to_string(i));
+    }
+    std::vector<std::size_t> order(keys.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&keys](std::size_t aLhs, std::size_t aRhs)
+                     { return keys[aLhs] < keys[aRhs]; });
+
+    strong::radix_sort(keys, values);
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        ASSERT_EQ(values[i], std::to_string(order[i]));
+        ASSERT_TRUE(i == 0 || keys[i - 1] <= keys[i]);
+    }
+}
+
+TEST(RadixSortTests, ParallelSorterReusesScratch)
+{
+    strong::radix_sorter<Timestamp, std::uint32_t> sorter(4);
+    ASSERT_EQ(sorter.threads(), 4u);
+    std::mt19937_64 random(11);
+    for (const std::size_t count: {std::size_t{1000}, std::size_t{1} << 18,
+                                   std::size_t{300001}})
+    {
+        auto keys = random_values<Timestamp>(count, random);
+        for (std::size_t i = 0; i < count; i += 3)
+        {
+            keys[i] = Timestamp{static_cast<std::int64_t>(i % 1000)};
+        }
+        std::vector<std::uint32_t> values(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            values[i] = static_cast<std::uint32_t>(i);
+        }
+        const auto original = keys;
+        auto expected = keys;
+        std::stable_sort(expected.begin(), expected.end());
+
+        sorter.sort(keys, values);
+        ASSERT_EQ(keys, expected);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(original[values[i]], keys[i]);
+            ASSERT_TRUE(i == 0 || keys[i - 1] != keys[i] ||
+                        values[i - 1] < values[i]);
+        }
+    }
+}
+
+namespace strong
+{
+template <>
+struct radix_key<Job>
+{
+    using type = std::uint32_t;
+
+    static type get(const Job &aValue) noexcept
+    {
+        return (aValue.get() >> 16) | (aValue.get() << 16);
+    }
+};
+}  // namespace strong
+
+TEST(RadixSortTests, ThrowOnCallingThreadJoinsWorkers)
+{
+    constexpr std::size_t kThreads = 4;
+    std::atomic<std::size_t> finished{0};
+    ASSERT_THROW(strong::details::radix_parallel(
+                     kThreads,
+                     [&finished](std::size_t aThread)
+                     {
+                         if (aThread == 0)
+                         {
+                             throw std::runtime_error("scatter failed");
+                         }
+                         ++finished;
+                     }),
+                 std::runtime_error);
+    ASSERT_EQ(finished.load(), kThreads - 1);
+}
+
+TEST(RadixSortTests, ThrowOnWorkerThreadIsRethrown)
+{
+    constexpr std::size_t kThreads = 4;
+    std::atomic<std::size_t> finished{0};
+    ASSERT_THROW(strong::details::radix_parallel(
+                     kThreads,
+                     [&finished](std::size_t aThread)
+                     {
+                         if (aThread == kThreads - 1)
+                         {
+                             throw std::runtime_error("scatter failed");
+                         }
+                         ++finished;
+                     }),
+                 std::runtime_error);
+    ASSERT_EQ(finished.load(), kThreads - 1);
+}
+
+namespace
+{
+// Value whose move assignment throws for the poisoned value.
+struct Poisoned
+{
+    static constexpr std::uint32_t kPoison = 0xdeadu;
+
+    std::uint32_t id = 0;
+
+    Poisoned() = default;
+    Poisoned(const Poisoned &) = default;
+    Poisoned &operator=(Poisoned &&aOther)
+    {
+        if (aOther.id == kPoison)
+        {
+            throw std::runtime_error("poisoned move");
+        }
+        id = aOther.id;
+        return *this;
+    }
+};
+}  // namespace
+
+TEST(RadixSortTests, ThrowingValueMoveOnWorkerThreadPropagates)
+{
+    constexpr std::size_t kThreads = 4;
+    const std::size_t count = kThreads * strong::details::kRadixMinPerThread;
+    std::mt19937_64 random(11);
+    auto keys = random_values<UserId>(count, random);
+    std::vector<Poisoned> values(count);
+    // The last element belongs to the chunk of the last worker thread.
+    values.back().id = Poisoned::kPoison;
+
+    strong::radix_sorter<UserId, Poisoned> sorter(kThreads);
+    ASSERT_THROW(sorter.sort(keys, values), std::runtime_error);
+}
+
+TEST(RadixSortTests, CustomKey)
+{
+    std::vector<Job> jobs{Job{0x00010002u}, Job{0x00000002u},
+                          Job{0x00020001u}, Job{0x00000001u}};
+    strong::radix_sort(jobs);
+    ASSERT_EQ(jobs, (std::vector<Job>{Job{0x00000001u}, Job{0x00020001u},
+                                      Job{0x00000002u}, Job{0x00010002u}}));
+}
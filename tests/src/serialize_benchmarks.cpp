@@ -0,0 +1,227 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "strong_type/serialize.h"
+
+// Columns of 1M timestamps (int64) and 1M ids (uint32) written to and read
+// from a local file, in bytes of values per second. Writing: values
+// unwrapped one by one into a buffer ("per_element"), strong::serialize
+// ("serialize"), strong::write_columns ("writev") and delta_varint encoded
+// timestamps ("delta_varint"). Reading, followed by a sum of all values:
+// read() and deserialize ("read"), mapped_file views ("mmap") and decoding
+// of delta_varint timestamps ("delta_varint"). The file stays in the page
+// cache.
+
+#if STRONG_TYPE_HAS_POSIX_IO
+namespace
+{
+using Timestamp = strong::strong_type<struct TimestampTag, std::int64_t,
+                                      strong::plus>;
+using UserId = strong::strong_type<struct UserIdTag, std::uint32_t,
+                                   strong::plus>;
+
+constexpr std::size_t kCount = std::size_t{1} << 20;
+constexpr std::int64_t kBytes =
+    static_cast<std::int64_t>(kCount * (sizeof(Timestamp) + sizeof(UserId)));
+
+enum class method
+{
+    per_element,
+    serialize,
+    writev,
+    delta_varint,
+    read,
+    mmap
+};
+
+struct columns
+{
+    std::vector<Timestamp> timestamps;
+    std::vector<UserId> ids;
+};
+
+const columns &data()
+{
+    static const columns result = []
+    {
+        columns values;
+        std::int64_t time = 1700000000000000;
+        for (std::size_t i = 0; i < kCount; ++i)
+        {
+            time += static_cast<std::int64_t>(i * 7919 % 1000);
+            values.timestamps.emplace_back(time);
+            values.ids.emplace_back(static_cast<std::uint32_t>(i * 40503));
+        }
+        return values;
+    }();
+    return result;
+}
+
+std::string file_path()
+{
+    return "strong_type_serialize_benchmark.bin";
+}
+
+void write_file(const std::vector<std::byte> &aBytes)
+{
+    const int fd = ::open(file_path().c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+                          0600);
+    std::size_t written = 0;
+    while (written < aBytes.size())
+    {
+        const ssize_t result = ::write(fd, aBytes.data() + written,
+                                       aBytes.size() - written);
+        if (result <= 0)
+        {
+            break;
+        }
+        written += static_cast<std::size_t>(result);
+    }
+    ::close(fd);
+}
+
+template <method M>
+void BM_WriteColumns(benchmark::State &aState)
+{
+    const columns &values = data();
+    std::vector<std::byte> buffer;
+    for (auto _: aState)
+    {
+        buffer.clear();
+        if constexpr (M == method::per_element)
+        {
+            for (const Timestamp &timestamp: values.timestamps)
+            {
+                const std::int64_t value = timestamp.get();
+                const auto *bytes = reinterpret_cast<const std::byte *>(&value);
+                buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+            }
+            for (const UserId &id: values.ids)
+            {
+                const std::uint32_t value = id.get();
+                const auto *bytes = reinterpret_cast<const std::byte *>(&value);
+                buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+            }
+            write_file(buffer);
+        }
+        else if constexpr (M == method::writev)
+        {
+            const int fd = ::open(file_path().c_str(),
+                                  O_WRONLY | O_CREAT | O_TRUNC, 0600);
+            benchmark::DoNotOptimize(
+                strong::write_columns(fd, values.timestamps, values.ids));
+            ::close(fd);
+        }
+        else
+        {
+            strong::serialize(values.timestamps, buffer,
+                              M == method::delta_varint
+                                  ? strong::encoding::delta_varint
+                                  : strong::encoding::raw);
+            strong::serialize(values.ids, buffer);
+            write_file(buffer);
+        }
+    }
+    aState.SetBytesProcessed(aState.iterations() * kBytes);
+    std::remove(file_path().c_str());
+}
+
+template <method M>
+void BM_ReadColumns(benchmark::State &aState)
+{
+    const columns &values = data();
+    std::vector<std::byte> buffer;
+    strong::serialize(values.timestamps, buffer,
+                      M == method::delta_varint
+                          ? strong::encoding::delta_varint
+                          : strong::encoding::raw);
+    strong::serialize(values.ids, buffer);
+    write_file(buffer);
+
+    std::vector<Timestamp> timestamps;
+    std::vector<UserId> ids;
+    for (auto _: aState)
+    {
+        Timestamp total{0};
+        const auto add = [&total](const auto &aTimestamps, const auto &aIds)
+        {
+            for (std::size_t i = 0; i < kCount; ++i)
+            {
+                total = total + aTimestamps[i] + Timestamp{aIds[i].get()};
+            }
+        };
+        if constexpr (M == method::read)
+        {
+            const int fd = ::open(file_path().c_str(), O_RDONLY);
+            struct stat status;
+            ::fstat(fd, &status);
+            buffer.resize(static_cast<std::size_t>(status.st_size));
+            benchmark::DoNotOptimize(
+                ::read(fd, buffer.data(), buffer.size()));
+            ::close(fd);
+            strong::column_reader reader(buffer);
+            reader.read(timestamps);
+            reader.read(ids);
+            add(timestamps, ids);
+        }
+        else
+        {
+            auto file = strong::mapped_file::open(file_path().c_str());
+            strong::column_reader reader(file->bytes());
+            strong::span<const UserId> idView;
+            if constexpr (M == method::mmap)
+            {
+                strong::span<const Timestamp> timestampView;
+                reader.read(timestampView);
+                reader.read(idView);
+                add(timestampView, idView);
+            }
+            else
+            {
+                reader.read(timestamps);
+                reader.read(idView);
+                add(timestamps, idView);
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    aState.SetBytesProcessed(aState.iterations() * kBytes);
+    std::remove(file_path().c_str());
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_WriteColumns, method::per_element)
+    ->Name("BM_WriteColumns/per_element")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_WriteColumns, method::serialize)
+    ->Name("BM_WriteColumns/serialize")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_WriteColumns, method::writev)
+    ->Name("BM_WriteColumns/writev")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_WriteColumns, method::delta_varint)
+    ->Name("BM_WriteColumns/delta_varint")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ReadColumns, method::read)
+    ->Name("BM_ReadColumns/read")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ReadColumns, method::mmap)
+    ->Name("BM_ReadColumns/mmap")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ReadColumns, method::delta_varint)
+    ->Name("BM_ReadColumns/delta_varint")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+#endif
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "strong_type/endian.h"
+#include "strong_type/serialize.h"
+
+namespace
+{
+using Sequence = strong::strong_type<struct SequenceTag, std::uint64_t,
+                                     strong::comparisons>;
+using Offset = strong::strong_type<struct OffsetTag, std::int32_t,
+                                   strong::comparisons>;
+using Level = strong::strong_type<struct LevelTag, std::uint8_t,
+                                  strong::comparisons>;
+using Price = strong::strong_type<struct PriceTag, double>;
+using NetworkId = strong::big_endian<Sequence>;
+
+std::vector<Sequence> make_sequence(std::size_t aCount)
+{
+    std::vector<Sequence> values;
+    std::uint64_t value = 1700000000000000000u;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        value += i % 7 == 0 ? 1000 : 3;
+        values.emplace_back(value);
+    }
+    return values;
+}
+
+template <typename StrongT>
+std::vector<StrongT> round_trip(const std::vector<StrongT> &aValues,
+                                strong::encoding aFormat)
+{
+    std::vector<std::byte> bytes;
+    strong::serialize(aValues, bytes, aFormat);
+    EXPECT_EQ(bytes.size() % strong::kColumnAlignment, 0u);
+    std::vector<StrongT> result;
+    const auto read = strong::deserialize<StrongT>(bytes, result);
+    EXPECT_EQ(read.ec, std::errc());
+    EXPECT_EQ(read.ptr, bytes.data() + bytes.size());
+    return result;
+}
+}  // namespace
+
+TEST(SerializeTests, RoundTrip)
+{
+    static_assert(strong::is_serializable_v<Price>);
+    static_assert(strong::is_serializable_v<NetworkId>);
+    static_assert(!strong::is_serializable_v<std::uint64_t>);
+    static_assert(strong::is_delta_encodable_v<Offset>);
+    static_assert(!strong::is_delta_encodable_v<Price>);
+
+    const auto sequence = make_sequence(1000);
+    ASSERT_EQ(round_trip(sequence, strong::encoding::raw), sequence);
+    ASSERT_EQ(round_trip(sequence, strong::encoding::delta_varint), sequence);
+
+    const std::vector<Offset> offsets{Offset{0}, Offset{-1}, Offset{5},
+                                      Offset{INT32_MIN}, Offset{INT32_MAX},
+                                      Offset{-70000}};
+    ASSERT_EQ(round_trip(offsets, strong::encoding::delta_varint), offsets);
+    const std::vector<Level> levels{Level{0}, Level{255}, Level{1},
+                                    Level{128}};
+    ASSERT_EQ(round_trip(levels, strong::encoding::delta_varint), levels);
+    ASSERT_TRUE(
+        round_trip(std::vector<Level>(), strong::encoding::raw).empty());
+
+    const std::vector<NetworkId> ids{NetworkId(Sequence{1}),
+                                     NetworkId(Sequence{2})};
+    const auto readIds = round_trip(ids, strong::encoding::raw);
+    ASSERT_EQ(readIds[1].load(), Sequence{2});
+}
+
+TEST(SerializeTests, DeltaEncodingIsCompact)
+{
+    const auto sequence = make_sequence(1000);
+    std::vector<std::byte> raw;
+    std::vector<std::byte> delta;
+    strong::serialize(sequence, raw);
+    strong::serialize(sequence, delta, strong::encoding::delta_varint);
+    ASSERT_EQ(raw.size(), sizeof(strong::column_header) + 8000);
+    // The first value takes 9 bytes, a delta of 1000 takes 2, of 3 one.
+    ASSERT_LT(delta.size(), sizeof(strong::column_header) + 1300);
+}
+
+TEST(SerializeTests, ViewsWithoutCopying)
+{
+    const auto sequence = make_sequence(100);
+    const std::vector<Offset> offsets{Offset{-3}, Offset{4}, Offset{5}};
+    std::vector<std::byte> bytes;
+    strong::serialize(sequence, bytes);
+    strong::serialize(offsets, bytes, strong::encoding::delta_varint);
+    strong::serialize(offsets, bytes);
+
+    strong::column_reader reader(bytes);
+    strong::span<const Sequence> view;
+    ASSERT_EQ(reader.read(view), std::errc());
+    ASSERT_EQ(view.size(), 100u);
+    ASSERT_EQ(static_cast<const void *>(view.data()),
+              bytes.data() + sizeof(strong::column_header));
+    ASSERT_EQ(view[99], sequence[99]);
+
+    // Delta columns are decoded, they can not be viewed.
+    strong::span<const Offset> offsetView;
+    ASSERT_EQ(reader.read(offsetView), std::errc::invalid_argument);
+    std::vector<Offset> decoded;
+    ASSERT_EQ(reader.read(decoded), std::errc());
+    ASSERT_EQ(decoded, offsets);
+    ASSERT_EQ(reader.read(offsetView), std::errc());
+    ASSERT_EQ(offsetView[0], Offset{-3});
+    ASSERT_TRUE(reader.at_end());
+}
+
+TEST(SerializeTests, RejectsInvalidColumns)
+{
+    const auto sequence = make_sequence(10);
+    std::vector<std::byte> bytes;
+    strong::serialize(sequence, bytes, strong::encoding::delta_varint);
+
+    std::vector<Offset> wrongType;
+    auto result = strong::deserialize<Offset>(bytes, wrongType);
+    ASSERT_EQ(result.ec, std::errc::invalid_argument);
+    ASSERT_EQ(result.ptr, bytes.data());
+
+    std::vector<Sequence> values;
+    const strong::span<const std::byte> all(bytes);
+    result = strong::deserialize<Sequence>(all.first(bytes.size() - 17),
+                                           values);
+    ASSERT_EQ(result.ec, std::errc::illegal_byte_sequence);
+    result = strong::deserialize<Sequence>(all.first(20), values);
+    ASSERT_EQ(result.ec, std::errc::illegal_byte_sequence);
+
+    // A varint that never ends.
+    std::vector<std::byte> corrupt = bytes;
+    const std::size_t payload = sizeof(strong::column_header);
+    for (std::size_t i = payload; i < payload + 11; ++i)
+    {
+        corrupt[i] = std::byte{0xff};
+    }
+    result = strong::deserialize<Sequence>(corrupt, values);
+    ASSERT_EQ(result.ec, std::errc::illegal_byte_sequence);
+
+    corrupt = bytes;
+    corrupt[0] = std::byte{0};
+    result = strong::deserialize<Sequence>(corrupt, values);
+    ASSERT_EQ(result.ec, std::errc::illegal_byte_sequence);
+}
+
+TEST(SerializeTests, RejectsCountsThatOverflowThePayloadSize)
+{
+    const auto sequence = make_sequence(2);
+    std::vector<std::byte> bytes;
+    strong::serialize(sequence, bytes);
+
+    // count * sizeof(Sequence) wraps around to the payload size.
+    strong::column_header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.count += std::uint64_t{1} << 61;
+    std::memcpy(bytes.data(), &header, sizeof(header));
+
+    std::vector<Sequence> values;
+    auto result = strong::deserialize<Sequence>(bytes, values);
+    ASSERT_EQ(result.ec, std::errc::illegal_byte_sequence);
+    ASSERT_TRUE(values.empty());
+    strong::span<const Sequence> view;
+    result = strong::view_column<Sequence>(bytes, view);
+    ASSERT_EQ(result.ec, std::errc::illegal_byte_sequence);
+    ASSERT_TRUE(view.empty());
+}
+
+#if STRONG_TYPE_HAS_POSIX_IO
+TEST(SerializeTests, MappedFile)
+{
+    const std::string path = ::testing::TempDir() + "strong_columns.bin";
+    const auto sequence = make_sequence(5000);
+    const std::vector<Price> prices{Price{1.5}, Price{2.25}, Price{-3.0}};
+    const std::vector<Level> levels{Level{1}, Level{2}, Level{3}};
+    {
+        const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+                              0600);
+        ASSERT_GE(fd, 0);
+        ASSERT_EQ(strong::write_columns(fd, sequence, levels, prices),
+                  std::errc());
+        ::close(fd);
+    }
+
+    auto file = strong::mapped_file::open(path.c_str());
+    ASSERT_TRUE(file.has_value());
+    strong::column_reader reader(file->bytes());
+    strong::span<const Sequence> mappedSequence;
+    strong::span<const Level> mappedLevels;
+    strong::span<const Price> mappedPrices;
+    ASSERT_EQ(reader.read(mappedSequence), std::errc());
+    ASSERT_EQ(reader.read(mappedLevels), std::errc());
+    ASSERT_EQ(reader.read(mappedPrices), std::errc());
+    ASSERT_TRUE(reader.at_end());
+    ASSERT_EQ(std::vector<Sequence>(mappedSequence.begin(),
+                                    mappedSequence.end()),
+              sequence);
+    ASSERT_EQ(mappedLevels[2], Level{3});
+    ASSERT_EQ(mappedPrices[1].get(), 2.25);
+
+    const std::byte *mapping = file->bytes().data();
+    const strong::mapped_file moved = std::move(*file);
+    ASSERT_EQ(moved.bytes().data(), mapping);
+    ASSERT_TRUE(file->bytes().empty());
+    std::remove(path.c_str());
+
+    ASSERT_FALSE(strong::mapped_file::open(path.c_str()).has_value());
+}
+#endif
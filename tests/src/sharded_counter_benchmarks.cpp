@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+
+#include "strong_type/sharded_counter.h"
+
+// Relaxed increments of one hot counter from 1 to 16 threads: std::atomic
+// fetch_add against strong::sharded_counter.
+
+namespace
+{
+using Requests =
+    strong::strong_type<struct RequestsTag, std::uint64_t, strong::plus>;
+
+constexpr int kIncrements = 1 << 12;
+
+std::atomic<std::uint64_t> gAtomic{0};
+strong::sharded_counter<Requests> gSharded;
+
+void BM_CounterIncrement(benchmark::State &aState, bool aSharded)
+{
+    for (auto _: aState)
+    {
+        if (aSharded)
+        {
+            for (int i = 0; i < kIncrements; ++i)
+            {
+                gSharded.add(Requests{1});
+            }
+        }
+        else
+        {
+            for (int i = 0; i < kIncrements; ++i)
+            {
+                gAtomic.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    if (aState.thread_index() == 0)
+    {
+        benchmark::DoNotOptimize(aSharded ? gSharded.snapshot().get()
+                                          : gAtomic.load());
+    }
+    aState.SetItemsProcessed(aState.iterations() * kIncrements);
+}
+
+void threads(benchmark::internal::Benchmark *aBenchmark)
+{
+    for (int count = 1; count <= 16; count *= 2)
+    {
+        aBenchmark->Threads(count);
+    }
+    aBenchmark->UseRealTime();
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_CounterIncrement, std_atomic, false)->Apply(threads);
+BENCHMARK_CAPTURE(BM_CounterIncrement, sharded, true)->Apply(threads);
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "strong_type/sharded_counter.h"
+
+namespace
+{
+using Requests = strong::strong_type<struct RequestsTag, std::uint64_t,
+                                     strong::plus, strong::comparisons>;
+using Bytes = strong::strong_type<struct BytesTag, std::int32_t,
+                                  strong::plus_assignment,
+                                  strong::comparisons>;
+}  // namespace
+
+TEST(ShardedCounterTests, ShardCountIsPowerOfTwo)
+{
+    ASSERT_EQ(strong::sharded_counter<Requests>(1).shard_count(), 1u);
+    ASSERT_EQ(strong::sharded_counter<Requests>(5).shard_count(), 8u);
+    ASSERT_EQ(strong::sharded_counter<Requests>(16).shard_count(), 16u);
+    const auto defaultCount =
+        strong::sharded_counter<Requests>::default_shard_count();
+    ASSERT_GE(defaultCount, 1u);
+    ASSERT_EQ(defaultCount & (defaultCount - 1), 0u);
+    ASSERT_EQ(strong::sharded_counter<Requests>().shard_count(), defaultCount);
+}
+
+TEST(ShardedCounterTests, SingleThread)
+{
+    strong::sharded_counter<Bytes> counter(4);
+    ASSERT_EQ(counter.snapshot(), Bytes{0});
+    counter.add(Bytes{10});
+    counter.add(Bytes{-3});
+    ASSERT_EQ(counter.snapshot(), Bytes{7});
+    counter.reset();
+    ASSERT_EQ(counter.snapshot(), Bytes{0});
+}
+
+TEST(ShardedCounterTests, ConcurrentIncrements)
+{
+    constexpr std::size_t kThreads = 8;
+    constexpr std::uint64_t kIncrements = 10000;
+    // Fewer shards than threads: some threads share a shard.
+    strong::sharded_counter<Requests> counter(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back(
+            [&counter]
+            {
+                for (std::uint64_t i = 0; i < kIncrements; ++i)
+                {
+                    counter.add(Requests{1});
+                }
+            });
+    }
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(counter.snapshot(), Requests{kThreads * kIncrements});
+}
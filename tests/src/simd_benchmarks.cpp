@@ -0,0 +1,210 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "strong_type/simd.h"
+
+// Bulk kernels of strong::simd against the element-wise loop over the same
+// strong types.
+
+namespace
+{
+template <typename T>
+using Number = strong::strong_type<
+    struct NumberTag, T, strong::plus, strong::bitwise_left_shift,
+    strong::comparisons, strong::multiplication>;
+
+template <typename T>
+struct type_tag
+{
+    using type = T;
+};
+
+template <typename StrongT>
+std::vector<StrongT> make_values(std::size_t aCount, std::uint32_t aSeed)
+{
+    using T = strong::underlying_type<StrongT>;
+    std::vector<StrongT> values;
+    values.reserve(aCount);
+    std::uint32_t state = aSeed;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        state = state * 1664525u + 1013904223u;
+        values.emplace_back(static_cast<T>(state >> 8));
+    }
+    return values;
+}
+
+void set_counters(benchmark::State &aState, std::size_t aBytesPerItem)
+{
+    const auto items = aState.iterations() * aState.range(0);
+    aState.SetItemsProcessed(items);
+    aState.SetBytesProcessed(items * static_cast<std::int64_t>(aBytesPerItem));
+}
+
+template <typename StrongT>
+void BM_Plus(benchmark::State &aState, type_tag<StrongT>, bool aSimd)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto lhs = make_values<StrongT>(count, 1);
+    const auto rhs = make_values<StrongT>(count, 2);
+    std::vector<StrongT> result(count);
+    for (auto _: aState)
+    {
+        if (aSimd)
+        {
+            strong::simd::transform<strong::simd::op::add>(lhs, rhs, result);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                result[i] = lhs[i] + rhs[i];
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters(aState, 3 * sizeof(StrongT));
+}
+
+template <typename StrongT>
+void BM_Min(benchmark::State &aState, type_tag<StrongT>, bool aSimd)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto lhs = make_values<StrongT>(count, 3);
+    const auto rhs = make_values<StrongT>(count, 4);
+    std::vector<StrongT> result(count);
+    for (auto _: aState)
+    {
+        if (aSimd)
+        {
+            strong::simd::transform<strong::simd::op::min>(lhs, rhs, result);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                result[i] = rhs[i] < lhs[i] ? rhs[i] : lhs[i];
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters(aState, 3 * sizeof(StrongT));
+}
+
+template <typename StrongT>
+void BM_ShiftLeft(benchmark::State &aState, type_tag<StrongT>, bool aSimd)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto in = make_values<StrongT>(count, 5);
+    std::vector<StrongT> result(count);
+    for (auto _: aState)
+    {
+        if (aSimd)
+        {
+            strong::simd::shift_left(in, 3, result);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                result[i] = in[i] << StrongT{3};
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters(aState, 2 * sizeof(StrongT));
+}
+
+template <typename StrongT>
+void BM_Sum(benchmark::State &aState, type_tag<StrongT>, bool aSimd)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto in = make_values<StrongT>(count, 6);
+    for (auto _: aState)
+    {
+        StrongT sum{0};
+        if (aSimd)
+        {
+            sum = strong::simd::reduce<strong::simd::reduction::sum>(in);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                sum = sum + in[i];
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(aState, sizeof(StrongT));
+}
+
+template <typename StrongT>
+void BM_Max(benchmark::State &aState, type_tag<StrongT>, bool aSimd)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto in = make_values<StrongT>(count, 7);
+    for (auto _: aState)
+    {
+        StrongT max = in[0];
+        if (aSimd)
+        {
+            max = strong::simd::reduce<strong::simd::reduction::max>(in);
+        }
+        else
+        {
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                max = max < in[i] ? in[i] : max;
+            }
+        }
+        benchmark::DoNotOptimize(max);
+    }
+    set_counters(aState, sizeof(StrongT));
+}
+
+constexpr std::int64_t kSmall = 1 << 10;
+constexpr std::int64_t kLarge = 1 << 20;
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_Plus, loop, type_tag<Number<std::uint32_t>>{}, false)
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_Plus, simd, type_tag<Number<std::uint32_t>>{}, true)
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_Min, loop, type_tag<Number<std::int16_t>>{}, false)
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_Min, simd, type_tag<Number<std::int16_t>>{}, true)
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_ShiftLeft, loop,
+                  type_tag<Number<std::uint32_t>>{}, false)
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_ShiftLeft, simd,
+                  type_tag<Number<std::uint32_t>>{}, true)
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_Sum, loop, type_tag<Number<std::uint64_t>>{}, false)
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_Sum, simd, type_tag<Number<std::uint64_t>>{}, true)
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_Max, loop, type_tag<Number<std::int32_t>>{}, false)
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_Max, simd, type_tag<Number<std::int32_t>>{}, true)
+    ->Arg(kSmall)
+    ->Arg(kLarge);
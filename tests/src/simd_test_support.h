@@ -0,0 +1,56 @@
+#ifndef strong_type_simd_test_support_h
+#define strong_type_simd_test_support_h
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "strong_type/simd.h"
+
+// Fixture shared by the tests of bulk operations that dispatch on
+// strong::simd::target: every target is compared with the scalar code on
+// the same pseudo-random inputs.
+namespace simd_test
+{
+// Tests skip the targets that the CPU does not support.
+inline constexpr std::array<strong::simd::target, 4> kTargets = {
+    strong::simd::target::scalar, strong::simd::target::sse2,
+    strong::simd::target::avx2, strong::simd::target::avx512};
+
+// Sizes cover empty ranges, ranges shorter than a vector and vector tails of
+// every instruction set and element size.
+inline constexpr std::array<std::size_t, 14> kSizes = {
+    0, 1, 3, 5, 7, 8, 16, 17, 31, 33, 64, 127, 128, 1000};
+
+// aCount pseudo-random 64-bit words, the same for the same aSeed.
+inline std::vector<std::uint64_t> make_words(std::size_t aCount,
+                                             std::uint64_t aSeed)
+{
+    std::vector<std::uint64_t> words;
+    words.reserve(aCount);
+    std::uint64_t state = aSeed;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        words.push_back(state ^ (state >> 29));
+    }
+    return words;
+}
+
+// aCount strong values with the low bits of make_words as underlying values.
+template <typename StrongT>
+std::vector<StrongT> make_values(std::size_t aCount, std::uint64_t aSeed)
+{
+    using T = strong::underlying_type<StrongT>;
+    std::vector<StrongT> values;
+    values.reserve(aCount);
+    for (const std::uint64_t word: make_words(aCount, aSeed))
+    {
+        values.emplace_back(static_cast<T>(word));
+    }
+    return values;
+}
+}  // namespace simd_test
+
+#endif /* strong_type_simd_test_support_h */
@@ -0,0 +1,295 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "simd_test_support.h"
+#include "strong_type/simd.h"
+
+namespace
+{
+using simd_test::kSizes;
+using simd_test::kTargets;
+using simd_test::make_values;
+
+template <typename T>
+using Number = strong::strong_type<
+    struct NumberTag, T, strong::plus, strong::minus, strong::multiplication,
+    strong::bitwise_and, strong::bitwise_or, strong::bitwise_xor,
+    strong::bitwise_left_shift, strong::bitwise_right_shift,
+    strong::comparisons>;
+
+// Saturating mixins replace plus and minus, so they go to a separate type.
+template <typename T>
+using Level =
+    strong::strong_type<struct LevelTag, T, strong::saturating_plus,
+                        strong::saturating_minus, strong::comparisons>;
+
+using Real = strong::strong_type<struct RealTag, double, strong::plus,
+                                 strong::multiplication, strong::comparisons>;
+
+template <strong::simd::op Op, typename StrongT>
+void check_transform()
+{
+    for (const auto target: kTargets)
+    {
+        if (!strong::simd::is_supported(target))
+        {
+            continue;
+        }
+        for (const auto size: kSizes)
+        {
+            const auto lhs = make_values<StrongT>(size, 1);
+            const auto rhs = make_values<StrongT>(size, 2);
+            std::vector<StrongT> out(size);
+            strong::simd::transform<Op>(lhs, rhs, out, target);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(out[i].get(), strong::simd::details::apply<Op>(
+                                            lhs[i].get(), rhs[i].get()))
+                    << "target " << static_cast<int>(target) << ", size "
+                    << size << ", index " << i;
+            }
+
+            const StrongT scalar = make_values<StrongT>(1, 3)[0];
+            strong::simd::transform<Op>(lhs, scalar, out, target);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(out[i].get(), strong::simd::details::apply<Op>(
+                                            lhs[i].get(), scalar.get()))
+                    << "target " << static_cast<int>(target) << ", size "
+                    << size << ", index " << i;
+            }
+        }
+    }
+}
+
+template <typename StrongT>
+void check_all_operations()
+{
+    check_transform<strong::simd::op::add, StrongT>();
+    check_transform<strong::simd::op::sub, StrongT>();
+    check_transform<strong::simd::op::mul, StrongT>();
+    check_transform<strong::simd::op::bit_and, StrongT>();
+    check_transform<strong::simd::op::bit_or, StrongT>();
+    check_transform<strong::simd::op::bit_xor, StrongT>();
+    check_transform<strong::simd::op::min, StrongT>();
+    check_transform<strong::simd::op::max, StrongT>();
+    using T = strong::underlying_type<StrongT>;
+    check_transform<strong::simd::op::saturating_add, Level<T>>();
+    check_transform<strong::simd::op::saturating_sub, Level<T>>();
+}
+
+template <typename StrongT>
+void check_shifts()
+{
+    using T = strong::underlying_type<StrongT>;
+    for (const auto target: kTargets)
+    {
+        if (!strong::simd::is_supported(target))
+        {
+            continue;
+        }
+        for (const auto size: kSizes)
+        {
+            const auto in = make_values<StrongT>(size, 4);
+            std::vector<StrongT> out(size);
+            for (unsigned count = 0; count < 8 * sizeof(T); count += 3)
+            {
+                strong::simd::shift_left(in, count, out, target);
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    ASSERT_EQ(out[i].get(), strong::simd::details::shift<true>(
+                                                in[i].get(), count));
+                }
+                strong::simd::shift_right(in, count, out, target);
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    ASSERT_EQ(out[i].get(),
+                              strong::simd::details::shift<false>(in[i].get(),
+                                                                  count));
+                }
+            }
+        }
+    }
+}
+
+template <strong::simd::reduction R, typename StrongT>
+void check_reduce()
+{
+    for (const auto target: kTargets)
+    {
+        if (!strong::simd::is_supported(target))
+        {
+            continue;
+        }
+        for (const auto size: kSizes)
+        {
+            if (size == 0 && R != strong::simd::reduction::sum)
+            {
+                continue;
+            }
+            const auto in = make_values<StrongT>(size, 5);
+            const auto expected =
+                strong::simd::details::reduce_scalar<R>(in.data(), in.size());
+            ASSERT_EQ(strong::simd::reduce<R>(in, target).get(),
+                      expected.get())
+                << "target " << static_cast<int>(target) << ", size " << size;
+        }
+    }
+}
+
+template <typename StrongT>
+void check_all_reductions()
+{
+    check_reduce<strong::simd::reduction::sum, StrongT>();
+    check_reduce<strong::simd::reduction::min, StrongT>();
+    check_reduce<strong::simd::reduction::max, StrongT>();
+}
+}  // namespace
+
+TEST(SimdTests, BestTargetIsSupported)
+{
+    ASSERT_TRUE(strong::simd::is_supported(strong::simd::best_target()));
+    ASSERT_TRUE(strong::simd::is_supported(strong::simd::target::scalar));
+}
+
+TEST(SimdTests, TransformUInt8)
+{
+    check_all_operations<Number<std::uint8_t>>();
+}
+
+TEST(SimdTests, TransformInt16)
+{
+    check_all_operations<Number<std::int16_t>>();
+}
+
+TEST(SimdTests, TransformUInt32)
+{
+    check_all_operations<Number<std::uint32_t>>();
+}
+
+TEST(SimdTests, TransformInt64)
+{
+    check_all_operations<Number<std::int64_t>>();
+}
+
+TEST(SimdTests, TransformInPlace)
+{
+    using Counter = Number<std::uint32_t>;
+    auto values = make_values<Counter>(100, 6);
+    const auto expected = values;
+    strong::simd::transform<strong::simd::op::add>(values, Counter{1}, values);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(values[i].get(), expected[i].get() + 1u);
+    }
+}
+
+TEST(SimdTests, TransformSaturatesAtBounds)
+{
+    using Sample = Level<std::int16_t>;
+    const std::vector<Sample> lhs(100, Sample{30000});
+    const std::vector<Sample> rhs(100, Sample{-30000});
+    std::vector<Sample> out(100);
+    for (const auto target: kTargets)
+    {
+        if (!strong::simd::is_supported(target))
+        {
+            continue;
+        }
+        strong::simd::transform<strong::simd::op::saturating_add>(
+            lhs, Sample{10000}, out, target);
+        ASSERT_EQ(out, std::vector<Sample>(100, Sample{32767}));
+        strong::simd::transform<strong::simd::op::saturating_sub>(
+            rhs, lhs, out, target);
+        ASSERT_EQ(out, std::vector<Sample>(100, Sample{-32768}));
+        strong::simd::transform<strong::simd::op::saturating_add>(
+            lhs, rhs, out, target);
+        ASSERT_EQ(out, std::vector<Sample>(100, Sample{0}));
+    }
+}
+
+TEST(SimdTests, TransformSubspan)
+{
+    using Counter = Number<std::int32_t>;
+    const auto lhs = make_values<Counter>(100, 7);
+    const auto rhs = make_values<Counter>(100, 8);
+    std::vector<Counter> out(100, Counter{0});
+    const strong::span<const Counter> lhsSpan(lhs);
+    const strong::span<const Counter> rhsSpan(rhs);
+    strong::simd::transform<strong::simd::op::max>(
+        lhsSpan.subspan(3, 90), rhsSpan.subspan(5, 90),
+        strong::span<Counter>(out).subspan(1, 90));
+    ASSERT_EQ(out[0].get(), 0);
+    for (std::size_t i = 0; i < 90; ++i)
+    {
+        ASSERT_EQ(out[i + 1], std::max(lhs[i + 3], rhs[i + 5]));
+    }
+    ASSERT_EQ(out[91].get(), 0);
+}
+
+TEST(SimdTests, TransformNonIntegral)
+{
+    const std::vector<Real> lhs = {Real{1.5}, Real{-2.0}, Real{3.25}};
+    const std::vector<Real> rhs = {Real{0.5}, Real{4.0}, Real{-1.0}};
+    std::vector<Real> out(3);
+    strong::simd::transform<strong::simd::op::add>(lhs, rhs, out);
+    ASSERT_DOUBLE_EQ(out[0].get(), 2.0);
+    ASSERT_DOUBLE_EQ(out[1].get(), 2.0);
+    ASSERT_DOUBLE_EQ(out[2].get(), 2.25);
+    strong::simd::transform<strong::simd::op::min>(lhs, rhs, out);
+    ASSERT_DOUBLE_EQ(out[0].get(), 0.5);
+    ASSERT_DOUBLE_EQ(out[1].get(), -2.0);
+    ASSERT_DOUBLE_EQ(out[2].get(), -1.0);
+}
+
+TEST(SimdTests, ShiftUInt8)
+{
+    check_shifts<Number<std::uint8_t>>();
+}
+
+TEST(SimdTests, ShiftInt16)
+{
+    check_shifts<Number<std::int16_t>>();
+}
+
+TEST(SimdTests, ShiftInt32)
+{
+    check_shifts<Number<std::int32_t>>();
+}
+
+TEST(SimdTests, ShiftUInt64)
+{
+    check_shifts<Number<std::uint64_t>>();
+}
+
+TEST(SimdTests, ReduceInt8)
+{
+    check_all_reductions<Number<std::int8_t>>();
+}
+
+TEST(SimdTests, ReduceUInt16)
+{
+    check_all_reductions<Number<std::uint16_t>>();
+}
+
+TEST(SimdTests, ReduceInt32)
+{
+    check_all_reductions<Number<std::int32_t>>();
+}
+
+TEST(SimdTests, ReduceUInt64)
+{
+    check_all_reductions<Number<std::uint64_t>>();
+}
+
+TEST(SimdTests, ReduceNonIntegral)
+{
+    const std::vector<Real> values = {Real{1.5}, Real{-2.0}, Real{3.25}};
+    using strong::simd::reduction;
+    ASSERT_DOUBLE_EQ(strong::simd::reduce<reduction::sum>(values).get(), 2.75);
+    ASSERT_DOUBLE_EQ(strong::simd::reduce<reduction::min>(values).get(), -2.0);
+    ASSERT_DOUBLE_EQ(strong::simd::reduce<reduction::max>(values).get(), 3.25);
+}
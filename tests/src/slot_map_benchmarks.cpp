@@ -0,0 +1,190 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "strong_type/hash.h"
+#include "strong_type/slot_map.h"
+
+// Object pools keyed by strong ids: std::unordered_map of heap-allocated
+// objects and strong::slot_map.
+
+namespace
+{
+using EntityId = strong::strong_type<struct EntityIdTag, std::uint64_t,
+                                     strong::comparisons, strong::hashable>;
+
+struct entity
+{
+    float position[3];
+    float velocity[3];
+    std::uint64_t flags;
+};
+
+entity make_entity(std::uint64_t aSeed)
+{
+    const auto value = static_cast<float>(aSeed);
+    return entity{{value, value, value}, {1.0f, 0.5f, 0.25f}, aSeed};
+}
+
+class unordered_pool
+{
+   public:
+    EntityId insert(const entity &aEntity)
+    {
+        const EntityId id{next_id_++};
+        entities_.emplace(id, std::make_unique<entity>(aEntity));
+        return id;
+    }
+
+    entity *find(EntityId aId)
+    {
+        const auto found = entities_.find(aId);
+        return found == entities_.end() ? nullptr : found->second.get();
+    }
+
+    void erase(EntityId aId) { entities_.erase(aId); }
+
+    template <typename F>
+    void for_each(F &&aFunction)
+    {
+        for (auto &[id, value]: entities_)
+        {
+            aFunction(*value);
+        }
+    }
+
+   private:
+    std::unordered_map<EntityId, std::unique_ptr<entity>> entities_;
+    std::uint64_t next_id_ = 1;
+};
+
+class slot_pool
+{
+   public:
+    EntityId insert(const entity &aEntity)
+    {
+        return entities_.insert(aEntity);
+    }
+
+    entity *find(EntityId aId) { return entities_.find(aId); }
+    void erase(EntityId aId) { entities_.erase(aId); }
+
+    template <typename F>
+    void for_each(F &&aFunction)
+    {
+        for (auto &value: entities_)
+        {
+            aFunction(value);
+        }
+    }
+
+   private:
+    strong::slot_map<EntityId, entity> entities_;
+};
+
+template <typename Pool>
+std::vector<EntityId> fill(Pool &aPool, std::size_t aCount)
+{
+    std::vector<EntityId> ids;
+    ids.reserve(aCount);
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        ids.push_back(aPool.insert(make_entity(i)));
+    }
+    return ids;
+}
+
+// Lookups of all live ids in random order.
+template <typename Pool>
+void BM_PoolFind(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    Pool pool;
+    auto ids = fill(pool, count);
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(42));
+    for (auto _: aState)
+    {
+        std::uint64_t sum = 0;
+        for (const auto id: ids)
+        {
+            sum += pool.find(id)->flags;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+// Erase of a random live object followed by an insert, in a steady state.
+template <typename Pool>
+void BM_PoolChurn(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    Pool pool;
+    auto ids = fill(pool, count);
+    std::mt19937 random(42);
+    std::uint64_t seed = count;
+    for (auto _: aState)
+    {
+        auto &id = ids[random() % count];
+        pool.erase(id);
+        id = pool.insert(make_entity(++seed));
+        benchmark::DoNotOptimize(id);
+    }
+    aState.SetItemsProcessed(aState.iterations());
+}
+
+// Update of every live object.
+template <typename Pool>
+void BM_PoolIterate(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    Pool pool;
+    fill(pool, count);
+    for (auto _: aState)
+    {
+        pool.for_each(
+            [](entity &aEntity)
+            {
+                for (int i = 0; i < 3; ++i)
+                {
+                    aEntity.position[i] += aEntity.velocity[i];
+                }
+            });
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+constexpr std::int64_t kSmall = 1 << 10;
+constexpr std::int64_t kLarge = 1 << 18;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PoolFind, unordered_pool)
+    ->Name("BM_PoolFind/unordered_map")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_PoolFind, slot_pool)
+    ->Name("BM_PoolFind/slot_map")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_PoolChurn, unordered_pool)
+    ->Name("BM_PoolChurn/unordered_map")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_PoolChurn, slot_pool)
+    ->Name("BM_PoolChurn/slot_map")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_PoolIterate, unordered_pool)
+    ->Name("BM_PoolIterate/unordered_map")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_PoolIterate, slot_pool)
+    ->Name("BM_PoolIterate/slot_map")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
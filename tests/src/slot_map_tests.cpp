@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "strong_type/slot_map.h"
+
+namespace
+{
+using EntityId = strong::strong_type<struct EntityIdTag, std::uint32_t,
+                                     strong::comparisons>;
+using ObjectId = strong::strong_type<struct ObjectIdTag, std::uint64_t,
+                                     strong::comparisons>;
+// Four generation bits, so that tests can wrap them around.
+using ShortLivedId = strong::strong_type<struct ShortLivedIdTag,
+                                         std::uint32_t, strong::comparisons>;
+// Four index bits: at most 15 values.
+using TinyId =
+    strong::strong_type<struct TinyIdTag, std::uint8_t, strong::comparisons>;
+
+struct throwing_value
+{
+    explicit throwing_value(int aValue) : value(aValue)
+    {
+        if (aValue < 0)
+        {
+            throw std::runtime_error("negative value");
+        }
+    }
+
+    int value;
+};
+
+template <typename Map, typename HandleT, typename = void>
+struct is_findable_with : std::false_type
+{
+};
+
+template <typename Map, typename HandleT>
+struct is_findable_with<Map, HandleT,
+                        std::void_t<decltype(std::declval<Map &>().find(
+                            std::declval<HandleT>()))>> : std::true_type
+{
+};
+}  // namespace
+
+template <>
+struct strong::slot_index_bits<ShortLivedId>
+    : std::integral_constant<unsigned, 28>
+{
+};
+
+TEST(SlotMapTests, EmptyMap)
+{
+    const strong::slot_map<EntityId, std::string> map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_FALSE(map.contains(EntityId{0}));
+    ASSERT_EQ(map.find(EntityId{0x00010000u}), nullptr);
+    ASSERT_EQ((strong::slot_map<EntityId, int>::max_size()), 0xFFFFu);
+}
+
+TEST(SlotMapTests, InsertFindErase)
+{
+    strong::slot_map<EntityId, std::string> map(4);
+    const EntityId a = map.emplace("a");
+    const EntityId b = map.emplace(2, 'b');
+    const EntityId c = map.insert(std::string("c"));
+    ASSERT_NE(a, b);
+    ASSERT_NE(b, c);
+    ASSERT_NE(a, EntityId{0});
+    ASSERT_EQ(map.size(), 3u);
+    ASSERT_EQ(map[a], "a");
+    ASSERT_EQ(map[b], "bb");
+    ASSERT_EQ(*map.find(c), "c");
+
+    ASSERT_TRUE(map.erase(a));
+    ASSERT_FALSE(map.erase(a));
+    ASSERT_FALSE(map.contains(a));
+    ASSERT_EQ(map.find(a), nullptr);
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(map[b], "bb");
+    ASSERT_EQ(map[c], "c");
+
+    // The slot of a is reused with a new generation.
+    const EntityId d = map.emplace("d");
+    ASSERT_NE(d, a);
+    ASSERT_FALSE(map.contains(a));
+    ASSERT_EQ(map[d], "d");
+}
+
+TEST(SlotMapTests, HandlesOfOtherMapsAreRejected)
+{
+    strong::slot_map<EntityId, int> entities;
+    strong::slot_map<ObjectId, int> objects;
+    static_assert(is_findable_with<decltype(entities), EntityId>::value,
+                  "slot_map must accept its handle type.");
+    static_assert(!is_findable_with<decltype(entities), ObjectId>::value,
+                  "slot_map must reject handles of other types.");
+    static_assert(!is_findable_with<decltype(entities), std::uint32_t>::value,
+                  "slot_map must reject raw integers.");
+    const ObjectId object = objects.emplace(1);
+    ASSERT_EQ(objects[object], 1);
+    ASSERT_FALSE(objects.contains(ObjectId{object.get() + 2}));
+}
+
+TEST(SlotMapTests, DenseIterationVisitsLiveValues)
+{
+    strong::slot_map<EntityId, int> map;
+    std::vector<EntityId> handles;
+    for (int i = 0; i < 10; ++i)
+    {
+        handles.push_back(map.emplace(i));
+    }
+    for (int i = 0; i < 10; i += 3)
+    {
+        map.erase(handles[static_cast<std::size_t>(i)]);
+    }
+    int sum = 0;
+    for (const int value: map)
+    {
+        sum += value;
+    }
+    ASSERT_EQ(sum, 1 + 2 + 4 + 5 + 7 + 8);
+    std::size_t visited = 0;
+    map.for_each(
+        [&](EntityId aHandle, int &aValue)
+        {
+            ASSERT_EQ(&map[aHandle], &aValue);
+            ++visited;
+        });
+    ASSERT_EQ(visited, map.size());
+}
+
+TEST(SlotMapTests, ClearInvalidatesHandles)
+{
+    strong::slot_map<EntityId, int> map;
+    const EntityId a = map.emplace(1);
+    const EntityId b = map.emplace(2);
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.contains(a));
+    ASSERT_FALSE(map.contains(b));
+    const EntityId c = map.emplace(3);
+    ASSERT_NE(c, a);
+    ASSERT_NE(c, b);
+    ASSERT_EQ(map[c], 3);
+}
+
+TEST(SlotMapTests, GenerationsWrapAround)
+{
+    strong::slot_map<ShortLivedId, int> map;
+    const ShortLivedId first = map.emplace(0);
+    map.erase(first);
+    // Four generation bits give eight generations of used slots.
+    for (int i = 1; i < 8; ++i)
+    {
+        const ShortLivedId handle = map.emplace(i);
+        ASSERT_NE(handle, first);
+        ASSERT_FALSE(map.contains(first));
+        map.erase(handle);
+    }
+    ASSERT_EQ(map.emplace(8), first);
+}
+
+TEST(SlotMapTests, MaxSizeIsEnforced)
+{
+    strong::slot_map<TinyId, int> map;
+    ASSERT_EQ(map.max_size(), 15u);
+    ASSERT_THROW(map.reserve(16), std::length_error);
+    std::vector<TinyId> handles;
+    for (int i = 0; i < 15; ++i)
+    {
+        handles.push_back(map.emplace(i));
+    }
+    ASSERT_THROW(map.emplace(15), std::length_error);
+    ASSERT_EQ(map.size(), 15u);
+    for (int i = 0; i < 15; ++i)
+    {
+        ASSERT_EQ(map[handles[i]], i);
+    }
+    map.erase(handles[3]);
+    const TinyId reused = map.emplace(15);
+    ASSERT_FALSE(map.contains(handles[3]));
+    ASSERT_EQ(map[reused], 15);
+}
+
+TEST(SlotMapTests, ThrowingEmplaceLeavesMapUnchanged)
+{
+    strong::slot_map<EntityId, throwing_value> map;
+    const EntityId a = map.emplace(1);
+    const EntityId b = map.emplace(2);
+    ASSERT_THROW(map.emplace(-1), std::runtime_error);
+    // Slot 2 with the first generation was not created.
+    ASSERT_FALSE(map.contains(EntityId{0x00010002u}));
+    map.erase(a);
+    ASSERT_THROW(map.emplace(-1), std::runtime_error);
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_FALSE(map.contains(a));
+    ASSERT_EQ(map[b].value, 2);
+
+    // The slot of a is still at the head of the free list, with the
+    // generation that erase gave it.
+    const EntityId c = map.emplace(3);
+    const EntityId d = map.emplace(4);
+    ASSERT_EQ(c.get() & 0xFFFFu, a.get() & 0xFFFFu);
+    ASSERT_EQ(c.get() >> 16, (a.get() >> 16) + 2);
+    ASSERT_FALSE(map.contains(a));
+    ASSERT_EQ(map[c].value, 3);
+    ASSERT_EQ(map[d].value, 4);
+    ASSERT_EQ(map.size(), 3u);
+}
+
+TEST(SlotMapTests, MatchesReference)
+{
+    strong::slot_map<ObjectId, std::uint64_t> map;
+    std::unordered_map<std::uint64_t, std::uint64_t> reference;
+    std::vector<ObjectId> live;
+    std::vector<ObjectId> stale;
+    std::mt19937_64 random(7);
+    for (std::uint64_t i = 0; i < 20000; ++i)
+    {
+        if (live.empty() || random() % 3 != 0)
+        {
+            const ObjectId handle = map.emplace(i);
+            ASSERT_TRUE(reference.emplace(handle.get(), i).second);
+            live.push_back(handle);
+        }
+        else
+        {
+            const std::size_t position = random() % live.size();
+            const ObjectId handle = live[position];
+            live[position] = live.back();
+            live.pop_back();
+            ASSERT_TRUE(map.erase(handle));
+            reference.erase(handle.get());
+            stale.push_back(handle);
+        }
+    }
+    ASSERT_EQ(map.size(), reference.size());
+    for (const ObjectId handle: live)
+    {
+        ASSERT_EQ(map[handle], reference[handle.get()]);
+    }
+    for (const ObjectId handle: stale)
+    {
+        ASSERT_FALSE(map.contains(handle));
+    }
+}
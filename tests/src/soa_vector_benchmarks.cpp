@@ -0,0 +1,162 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "strong_type/simd.h"
+#include "strong_type/soa_vector.h"
+
+// Scans of event records that read one field (sum of sizes) or two (sum of
+// sizes of one source): std::vector of structs ("aos"), soa_vector
+// columns in a plain loop ("soa") and through strong::simd::reduce
+// ("soa_simd").
+
+namespace
+{
+using EventId = strong::strong_type<struct EventIdTag, std::uint64_t,
+                                    strong::comparisons>;
+using Timestamp = strong::strong_type<struct TimestampTag, std::int64_t,
+                                      strong::comparisons>;
+using Size = strong::strong_type<struct SizeTag, std::uint32_t,
+                                 strong::comparisons, strong::plus>;
+using SourceId = strong::strong_type<struct SourceIdTag, std::uint32_t,
+                                     strong::comparisons>;
+
+struct event
+{
+    EventId id;
+    Timestamp timestamp;
+    Size size;
+    SourceId source;
+};
+
+using Events = strong::soa_vector<EventId, Timestamp, Size, SourceId>;
+
+enum class layout
+{
+    aos,
+    soa,
+    soa_simd
+};
+
+Size make_size(std::size_t aIndex)
+{
+    return Size{static_cast<std::uint32_t>(aIndex * 2654435761u % 1500)};
+}
+
+Timestamp make_timestamp(std::size_t aIndex)
+{
+    return Timestamp{static_cast<std::int64_t>(aIndex * 40503u % 100000)};
+}
+
+template <layout L>
+void BM_ScanSizes(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    std::vector<event> records;
+    Events table;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const event record{EventId{i}, make_timestamp(i), make_size(i),
+                           SourceId{static_cast<std::uint32_t>(i % 64)}};
+        records.push_back(record);
+        table.push_back(record.id, record.timestamp, record.size,
+                        record.source);
+    }
+    for (auto _: aState)
+    {
+        Size total{0};
+        if constexpr (L == layout::aos)
+        {
+            for (const auto &record: records)
+            {
+                total = total + record.size;
+            }
+        }
+        else if constexpr (L == layout::soa)
+        {
+            for (const Size size: table.col<SizeTag>())
+            {
+                total = total + size;
+            }
+        }
+        else
+        {
+            total = strong::simd::reduce<strong::simd::reduction::sum>(
+                table.col<SizeTag>());
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+// Size of a record of aSource, zero otherwise; a mask rather than a branch,
+// so that both layouts can vectorize.
+std::uint32_t size_of(SourceId aSource, SourceId aWanted, Size aSize)
+{
+    return aSize.get() & (0u - static_cast<std::uint32_t>(aSource == aWanted));
+}
+
+template <layout L>
+void BM_ScanSource(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    std::vector<event> records;
+    Events table;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const event record{EventId{i}, make_timestamp(i), make_size(i),
+                           SourceId{static_cast<std::uint32_t>(i % 64)}};
+        records.push_back(record);
+        table.push_back(record.id, record.timestamp, record.size,
+                        record.source);
+    }
+    const SourceId wanted{7};
+    for (auto _: aState)
+    {
+        std::uint32_t total = 0;
+        if constexpr (L == layout::aos)
+        {
+            for (const auto &record: records)
+            {
+                total += size_of(record.source, wanted, record.size);
+            }
+        }
+        else
+        {
+            const auto sources = table.col<SourceIdTag>();
+            const auto sizes = table.col<SizeTag>();
+            for (std::size_t i = 0; i < sources.size(); ++i)
+            {
+                total += size_of(sources[i], wanted, sizes[i]);
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+constexpr std::int64_t kSmall = 1 << 12;
+constexpr std::int64_t kLarge = 1 << 20;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ScanSizes, layout::aos)
+    ->Name("BM_ScanSizes/aos")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_ScanSizes, layout::soa)
+    ->Name("BM_ScanSizes/soa")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_ScanSizes, layout::soa_simd)
+    ->Name("BM_ScanSizes/soa_simd")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_ScanSource, layout::aos)
+    ->Name("BM_ScanSource/aos")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
+BENCHMARK_TEMPLATE(BM_ScanSource, layout::soa)
+    ->Name("BM_ScanSource/soa")
+    ->Arg(kSmall)
+    ->Arg(kLarge);
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+#include "strong_type/simd.h"
+#include "strong_type/soa_vector.h"
+
+namespace
+{
+using EventId = strong::strong_type<struct EventIdTag, std::uint64_t,
+                                    strong::comparisons>;
+using Timestamp = strong::strong_type<struct TimestampTag, std::int64_t,
+                                      strong::comparisons>;
+using Size = strong::strong_type<struct SizeTag, std::uint32_t,
+                                 strong::comparisons, strong::plus>;
+
+using Events = strong::soa_vector<EventId, Timestamp, Size>;
+
+// Value whose copies and value-initializations throw once the countdown
+// reaches zero.
+struct Fragile
+{
+    static inline int countdown = -1;
+
+    Fragile() { tick(); }
+    Fragile(const Fragile&) { tick(); }
+    Fragile& operator=(const Fragile&) = default;
+
+    static void tick()
+    {
+        if (countdown >= 0 && countdown-- == 0)
+        {
+            throw std::runtime_error("Fragile");
+        }
+    }
+};
+
+using Payload = strong::strong_type<struct PayloadTag, Fragile>;
+
+Events make_events(std::size_t aCount)
+{
+    Events events;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        events.push_back(EventId{i}, Timestamp{static_cast<std::int64_t>(i)},
+                         Size{static_cast<std::uint32_t>(i % 10)});
+    }
+    return events;
+}
+}  // namespace
+
+TEST(SoaVectorTests, ColumnsByTag)
+{
+    static_assert(std::is_same_v<Events::field_type<TimestampTag>, Timestamp>);
+    static_assert(std::is_same_v<decltype(std::declval<Events &>()
+                                              .col<SizeTag>()),
+                                 strong::span<Size>>);
+    static_assert(std::is_same_v<decltype(std::declval<const Events &>()
+                                              .col<SizeTag>()),
+                                 strong::span<const Size>>);
+    static_assert(strong::is_soa_vector_v<Events>);
+
+    Events events = make_events(100);
+    ASSERT_EQ(events.size(), 100u);
+    const auto sizes = events.col<SizeTag>();
+    ASSERT_EQ(sizes.size(), 100u);
+    ASSERT_EQ(sizes[13], Size{3});
+    ASSERT_EQ(&sizes[1], &sizes[0] + 1);
+    events.col<TimestampTag>()[5] = Timestamp{-5};
+    ASSERT_EQ(events[5].get<TimestampTag>(), Timestamp{-5});
+
+    ASSERT_EQ(strong::simd::reduce<strong::simd::reduction::sum>(sizes),
+              Size{450});
+    const Events &view = events;
+    ASSERT_EQ(strong::simd::reduce<strong::simd::reduction::min>(
+                  view.col<TimestampTag>()),
+              Timestamp{-5});
+}
+
+TEST(SoaVectorTests, RowProxies)
+{
+    Events events = make_events(3);
+    auto row = events[1];
+    ASSERT_EQ(row.index(), 1u);
+    row.get<SizeTag>() = Size{7};
+    ASSERT_EQ(events.col<SizeTag>()[1], Size{7});
+
+    const Events::value_type copy = events[1];
+    ASSERT_EQ(copy, std::make_tuple(EventId{1}, Timestamp{1}, Size{7}));
+
+    events[0] = events[2];
+    ASSERT_EQ(static_cast<Events::value_type>(events[0]),
+              std::make_tuple(EventId{2}, Timestamp{2}, Size{2}));
+    events[2] = std::make_tuple(EventId{9}, Timestamp{9}, Size{9});
+    ASSERT_EQ(events.back().get<EventIdTag>(), EventId{9});
+
+    const Events &view = events;
+    Events::const_reference readOnly = events[2];
+    static_assert(std::is_same_v<decltype(readOnly.get<SizeTag>()),
+                                 const Size &>);
+    ASSERT_EQ(readOnly.get<SizeTag>(), view[2].get<SizeTag>());
+
+    std::uint64_t sum = 0;
+    for (auto item: events)
+    {
+        sum += item.get<EventIdTag>().get();
+        item.get<SizeTag>() = Size{0};
+    }
+    ASSERT_EQ(sum, 2u + 1u + 9u);
+    for (const auto item: view)
+    {
+        ASSERT_EQ(item.get<SizeTag>(), Size{0});
+    }
+}
+
+TEST(SoaVectorTests, Modifiers)
+{
+    Events events;
+    ASSERT_TRUE(events.empty());
+    events.reserve(10);
+    events.push_back(std::make_tuple(EventId{1}, Timestamp{10}, Size{100}));
+    events.push_back(EventId{2}, Timestamp{20}, Size{200});
+    events.push_back(EventId{3}, Timestamp{30}, Size{300});
+
+    events.swap_remove(0);
+    ASSERT_EQ(events.size(), 2u);
+    ASSERT_EQ(events[0].get<EventIdTag>(), EventId{3});
+    ASSERT_EQ(events[0].get<SizeTag>(), Size{300});
+    events.swap_remove(1);
+    ASSERT_EQ(events.size(), 1u);
+    ASSERT_EQ(events.col<TimestampTag>()[0], Timestamp{30});
+
+    events.resize(4);
+    ASSERT_EQ(events.col<EventIdTag>().size(), 4u);
+    ASSERT_EQ(events[3].get<SizeTag>(), Size{0});
+    events.pop_back();
+    ASSERT_EQ(events.col<SizeTag>().size(), 3u);
+    events.clear();
+    ASSERT_TRUE(events.empty());
+    ASSERT_TRUE(events.col<TimestampTag>().empty());
+}
+
+TEST(SoaVectorTests, ThrowingRowLeavesColumnsEqual)
+{
+    using Records = strong::soa_vector<EventId, Payload>;
+    Records records;
+    // No reallocation copies payloads: only the new rows can throw.
+    records.reserve(8);
+    records.push_back(EventId{1}, Payload{Fragile{}});
+    const Payload payload{Fragile{}};
+
+    Fragile::countdown = 0;
+    ASSERT_THROW(records.push_back(EventId{2}, payload), std::runtime_error);
+    ASSERT_EQ(records.size(), 1u);
+    ASSERT_EQ(records.col<EventIdTag>().size(), 1u);
+    ASSERT_EQ(records.col<PayloadTag>().size(), 1u);
+    ASSERT_EQ(records.back().get<EventIdTag>(), EventId{1});
+
+    Fragile::countdown = 1;
+    ASSERT_THROW(records.resize(4), std::runtime_error);
+    ASSERT_EQ(records.col<EventIdTag>().size(), 1u);
+    ASSERT_EQ(records.col<PayloadTag>().size(), 1u);
+
+    Fragile::countdown = -1;
+    records.resize(4);
+    ASSERT_EQ(records.col<PayloadTag>().size(), 4u);
+}
@@ -0,0 +1,332 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "strong_type/index_vector.h"
+#include "strong_type/strong_type.h"
+
+namespace
+{
+using Number =
+    strong::strong_type<struct NumberTag, std::uint32_t, strong::plus,
+                        strong::comparisons, strong::multiplication>;
+
+using Pointer = strong::strong_type<
+    struct PointerTag, std::uint32_t const *, strong::pointer_plus_value,
+    strong::pointer_plus_assignment, strong::pointer_minus_pointer,
+    strong::indirection, strong::subscription>;
+
+using NodeId = strong::strong_type<struct NodeIdTag, std::uint32_t>;
+
+template <typename T>
+struct type_tag
+{
+    using type = T;
+};
+
+template <typename T>
+std::vector<T> make_values(std::size_t aCount, std::uint32_t aSeed)
+{
+    std::vector<T> values;
+    values.reserve(aCount);
+    std::uint32_t state = aSeed;
+    for (std::size_t i = 0; i < aCount; ++i)
+    {
+        state = state * 1664525u + 1013904223u;
+        values.emplace_back(state >> 8);
+    }
+    return values;
+}
+
+// Operands and result of binary kernels live in one allocation at fixed,
+// staggered offsets. Separate allocations let the heap decide whether the
+// arrays alias modulo 4 KiB, which made raw and strong runs differ for
+// reasons unrelated to the code being measured.
+template <typename T>
+class operands
+{
+   public:
+    operands(std::size_t aCount, std::uint32_t aSeed)
+        : count_(aCount), storage_(make_values<T>(3 * (aCount + kGap), aSeed))
+    {
+    }
+
+    const T *lhs() const noexcept { return storage_.data(); }
+    const T *rhs() const noexcept { return lhs() + count_ + kGap; }
+    T *result() noexcept { return storage_.data() + 2 * (count_ + kGap); }
+
+   private:
+    static constexpr std::size_t kGap = 16;
+
+    std::size_t count_;
+    std::vector<T> storage_;
+};
+
+void set_counters(benchmark::State &aState, std::size_t aBytesPerItem)
+{
+    const auto items = aState.iterations() * aState.range(0);
+    aState.SetItemsProcessed(items);
+    aState.SetBytesProcessed(items * static_cast<std::int64_t>(aBytesPerItem));
+}
+
+template <typename T>
+void BM_Plus(benchmark::State &aState, type_tag<T>)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    operands<T> data(count, 1);
+    const T *lhs = data.lhs();
+    const T *rhs = data.rhs();
+    T *result = data.result();
+    for (auto _: aState)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result[i] = lhs[i] + rhs[i];
+        }
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+    set_counters(aState, 3 * sizeof(T));
+}
+
+template <typename T>
+void BM_Multiplication(benchmark::State &aState, type_tag<T>)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    operands<T> data(count, 3);
+    const T *lhs = data.lhs();
+    const T *rhs = data.rhs();
+    T *result = data.result();
+    for (auto _: aState)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result[i] = lhs[i] * rhs[i];
+        }
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+    set_counters(aState, 3 * sizeof(T));
+}
+
+template <typename T>
+void BM_Comparisons(benchmark::State &aState, type_tag<T>)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const operands<T> data(count, 5);
+    const T *lhs = data.lhs();
+    const T *rhs = data.rhs();
+    for (auto _: aState)
+    {
+        std::size_t less = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            less += lhs[i] < rhs[i] ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(less);
+    }
+    set_counters(aState, 2 * sizeof(T));
+}
+
+template <typename P>
+void BM_Subscription(benchmark::State &aState, type_tag<P>)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto values = make_values<std::uint32_t>(count, 7);
+    P ptr{values.data()};
+    for (auto _: aState)
+    {
+        std::uint32_t sum = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sum += ptr[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(aState, sizeof(std::uint32_t));
+}
+
+template <typename P>
+void BM_Indirection(benchmark::State &aState, type_tag<P>)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto values = make_values<std::uint32_t>(count, 8);
+    for (auto _: aState)
+    {
+        std::uint32_t sum = 0;
+        P ptr{values.data()};
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sum += *ptr;
+            ptr += 1;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(aState, sizeof(std::uint32_t));
+}
+
+// Binary search written only in terms of pointer mixins: pointer + value,
+// pointer - pointer and indirection.
+template <typename P>
+P lower_bound(P aFirst, P aLast, std::uint32_t aValue)
+{
+    auto count = aLast - aFirst;
+    while (count > 0)
+    {
+        const auto half = count / 2;
+        const P middle = aFirst + half;
+        if (*middle < aValue)
+        {
+            aFirst = middle + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+    return aFirst;
+}
+
+template <typename P>
+void BM_PointerArithmetic(benchmark::State &aState, type_tag<P>)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    std::vector<std::uint32_t> values(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        values[i] = static_cast<std::uint32_t>(i * 2);
+    }
+    const auto needles = make_values<std::uint32_t>(1024, 9);
+    const auto range = static_cast<std::uint32_t>(2 * count);
+    const P first{values.data()};
+    const P last{values.data() + values.size()};
+    for (auto _: aState)
+    {
+        std::ptrdiff_t total = 0;
+        for (const auto needle: needles)
+        {
+            total += lower_bound(first, last, needle % range) - first;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    aState.SetItemsProcessed(aState.iterations() *
+                             static_cast<std::int64_t>(needles.size()));
+}
+
+// Random gather through an index array: raw indices into std::vector versus
+// NodeId indices into strong::index_vector. Indices are read by reference:
+// GCC does not vectorize a loop that copies single-member class by value (see
+// the assignment codegen known difference).
+template <typename Index, typename Container>
+void BM_IndexedGather(benchmark::State &aState, type_tag<Index>,
+                      type_tag<Container>)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    const auto values = make_values<std::uint32_t>(count, 10);
+    Container container(count);
+    std::vector<Index> indices;
+    indices.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto position = static_cast<std::uint32_t>(i);
+        container[Index{position}] = values[i];
+        indices.push_back(Index{values[i] % static_cast<std::uint32_t>(count)});
+    }
+    for (auto _: aState)
+    {
+        std::uint32_t sum = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sum += container[indices[i]];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(aState, sizeof(Index) + sizeof(std::uint32_t));
+}
+
+constexpr std::int64_t kSmall = 1 << 10;
+constexpr std::int64_t kMedium = 1 << 16;
+constexpr std::int64_t kLarge = 1 << 20;
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_Plus, raw, type_tag<std::uint32_t>{})
+    ->Name("ratio/BM_Plus/raw")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_Plus, strong, type_tag<Number>{})
+    ->Name("ratio/BM_Plus/strong")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_Multiplication, raw, type_tag<std::uint32_t>{})
+    ->Name("ratio/BM_Multiplication/raw")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_Multiplication, strong, type_tag<Number>{})
+    ->Name("ratio/BM_Multiplication/strong")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_Comparisons, raw, type_tag<std::uint32_t>{})
+    ->Name("ratio/BM_Comparisons/raw")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_Comparisons, strong, type_tag<Number>{})
+    ->Name("ratio/BM_Comparisons/strong")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_Subscription, raw, type_tag<std::uint32_t const *>{})
+    ->Name("ratio/BM_Subscription/raw")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_Subscription, strong, type_tag<Pointer>{})
+    ->Name("ratio/BM_Subscription/strong")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_Indirection, raw, type_tag<std::uint32_t const *>{})
+    ->Name("ratio/BM_Indirection/raw")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_Indirection, strong, type_tag<Pointer>{})
+    ->Name("ratio/BM_Indirection/strong")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_PointerArithmetic, raw,
+                  type_tag<std::uint32_t const *>{})
+    ->Name("ratio/BM_PointerArithmetic/raw")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_PointerArithmetic, strong, type_tag<Pointer>{})
+    ->Name("ratio/BM_PointerArithmetic/strong")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+
+BENCHMARK_CAPTURE(BM_IndexedGather, raw, type_tag<std::uint32_t>{},
+                  type_tag<std::vector<std::uint32_t>>{})
+    ->Name("ratio/BM_IndexedGather/raw")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
+BENCHMARK_CAPTURE(BM_IndexedGather, strong, type_tag<NodeId>{},
+                  type_tag<strong::index_vector<NodeId, std::uint32_t>>{})
+    ->Name("ratio/BM_IndexedGather/strong")
+    ->Arg(kSmall)
+    ->Arg(kMedium)
+    ->Arg(kLarge);
@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "strong_type/strong_type.h"
 
@@ -131,6 +136,30 @@ TEST(StrongTypeTests, Subscription)
     ASSERT_EQ(valArray.data(), valuePtr.get());
 }
 
+TEST(StrongTypeTests, IndirectionOfSmartPointer)
+{
+    using Shared = strong::strong_type<struct SharedTag, std::shared_ptr<int>,
+                                       strong::indirection>;
+    const Shared value{std::make_shared<int>(10)};
+    ASSERT_EQ(*value, 10);
+    *value = 20;
+    ASSERT_EQ(*value.get(), 20);
+}
+
+TEST(StrongTypeTests, SubscriptionOfIterator)
+{
+    using Iterator = strong::strong_type<struct IteratorTag,
+                                         std::vector<int>::iterator,
+                                         strong::indirection,
+                                         strong::subscription>;
+    std::vector<int> values{1, 2, 3, 4, 5};
+    const Iterator it{values.begin() + 1};
+    ASSERT_EQ(*it, 2);
+    ASSERT_EQ(it[3], 5);
+    it[0] = 7;
+    ASSERT_EQ(values[1], 7);
+}
+
 TEST(StrongTypeTests, ImplicitlyConvertibleTo)
 {
     using ImplicitlyConvertibleToUnderlying =
@@ -225,3 +254,195 @@ TEST(StrongTypeTests, PointerMinusAssignment)
     ptr -= kOffset;
     ASSERT_EQ(ptr.get(), valArray.data());
 }
+
+namespace
+{
+template <typename StrongT>
+constexpr bool has_layout_of_underlying_type()
+{
+    using T = strong::underlying_type<StrongT>;
+    return sizeof(StrongT) == sizeof(T) && alignof(StrongT) == alignof(T) &&
+           std::is_trivially_copyable_v<StrongT> ==
+               std::is_trivially_copyable_v<T> &&
+           std::is_trivially_destructible_v<StrongT> ==
+               std::is_trivially_destructible_v<T> &&
+           std::is_standard_layout_v<StrongT> == std::is_standard_layout_v<T>;
+}
+
+template <typename T>
+using AllArithmetic = strong::strong_type<
+    struct AllArithmeticTag, T, strong::assignment, strong::comparisons,
+    strong::convertible_to_bool, strong::plus, strong::plus_assignment,
+    strong::minus, strong::minus_assignment, strong::pre_increment,
+    strong::post_increment, strong::pre_decrement, strong::post_decrement,
+    strong::unary_plus, strong::modulo, strong::modulo_assignment,
+    strong::division, strong::division_assignment, strong::multiplication,
+    strong::multiplication_assignment, strong::bitwise_not,
+    strong::bitwise_and, strong::bitwise_and_assignment, strong::bitwise_or,
+    strong::bitwise_or_assignment, strong::bitwise_xor,
+    strong::bitwise_xor_assignment, strong::bitwise_left_shift,
+    strong::bitwise_left_shift_assignment, strong::bitwise_right_shift,
+    strong::bitwise_right_shift_assignment,
+    strong::implicitly_convertible_to_underlying>;
+
+using AllPointer = strong::strong_type<
+    struct AllPointerTag, uint8_t const *, strong::comparisons,
+    strong::indirection, strong::subscription, strong::pointer_plus_value,
+    strong::value_plus_pointer, strong::pointer_minus_value,
+    strong::pointer_minus_pointer, strong::pointer_plus_assignment,
+    strong::pointer_minus_assignment>;
+}  // namespace
+
+TEST(StrongTypeTests, LayoutWithoutOperations)
+{
+    static_assert(has_layout_of_underlying_type<
+                  strong::strong_type<struct Tag, uint8_t>>());
+    static_assert(has_layout_of_underlying_type<
+                  strong::strong_type<struct Tag, double>>());
+}
+
+TEST(StrongTypeTests, LayoutOfNestedStrongType)
+{
+    using Inner = strong::strong_type<struct InnerTag, int>;
+    static_assert(has_layout_of_underlying_type<
+                  strong::strong_type<struct OuterTag, Inner>>());
+    static_assert(has_layout_of_underlying_type<strong::strong_type<
+                      struct OuterTag, AllArithmetic<uint32_t>,
+                      strong::comparisons>>());
+    static_assert(has_layout_of_underlying_type<strong::strong_type<
+                      struct OuterTag,
+                      strong::strong_type<struct OuterTag, int>>>());
+}
+
+TEST(StrongTypeTests, LayoutWithAllOperations)
+{
+    static_assert(has_layout_of_underlying_type<AllArithmetic<uint8_t>>());
+    static_assert(has_layout_of_underlying_type<AllArithmetic<uint16_t>>());
+    static_assert(has_layout_of_underlying_type<AllArithmetic<uint32_t>>());
+    static_assert(has_layout_of_underlying_type<AllArithmetic<uint64_t>>());
+    static_assert(has_layout_of_underlying_type<AllPointer>());
+    static_assert(std::is_trivially_copyable_v<AllArithmetic<uint64_t>>);
+    static_assert(std::is_trivially_copyable_v<AllPointer>);
+}
+
+TEST(StrongTypeTests, LayoutOfNonTrivialUnderlyingType)
+{
+    using Name = strong::strong_type<struct NameTag, std::string,
+                                     strong::comparisons, strong::plus>;
+    static_assert(has_layout_of_underlying_type<Name>());
+    const Name name{std::string("name")};
+    ASSERT_EQ(name.get(), "name");
+}
+
+TEST(StrongTypeTests, MemcpyArrayOfStrongTypes)
+{
+    using Id = AllArithmetic<uint32_t>;
+    const std::vector<Id> source{Id{1}, Id{2}, Id{3}, Id{4}};
+    std::vector<Id> destination(source.size(), Id{0});
+    std::memcpy(destination.data(), source.data(), sizeof(Id) * source.size());
+    ASSERT_EQ(destination, source);
+}
+
+namespace
+{
+// Compares overflow builtins with portable checks on every pair of values.
+template <typename T>
+void check_portable_overflow()
+{
+    constexpr int kMin = std::numeric_limits<T>::min();
+    constexpr int kMax = std::numeric_limits<T>::max();
+    for (int lhs = kMin; lhs <= kMax; ++lhs)
+    {
+        for (int rhs = kMin; rhs <= kMax; ++rhs)
+        {
+            const auto a = static_cast<T>(lhs);
+            const auto b = static_cast<T>(rhs);
+            T expected{};
+            T actual{};
+            ASSERT_EQ(strong::details::add_overflow(a, b, expected),
+                      strong::details::add_overflow_portable(a, b, actual));
+            ASSERT_EQ(expected, actual);
+            ASSERT_EQ(strong::details::sub_overflow(a, b, expected),
+                      strong::details::sub_overflow_portable(a, b, actual));
+            ASSERT_EQ(expected, actual);
+            ASSERT_EQ(strong::details::mul_overflow(a, b, expected),
+                      strong::details::mul_overflow_portable(a, b, actual));
+            ASSERT_EQ(expected, actual);
+        }
+    }
+}
+}  // namespace
+
+TEST(StrongTypeTests, SaturatingArithmetic)
+{
+    using Offset =
+        strong::strong_type<struct OffsetTag, uint8_t, strong::saturating_plus,
+                            strong::saturating_minus,
+                            strong::saturating_multiplication>;
+    static_assert((Offset{200} + Offset{55}).get() == 255);
+    static_assert((Offset{200} + Offset{100}).get() == 255);
+    static_assert((Offset{5} - Offset{10}).get() == 0);
+    static_assert((Offset{20} * Offset{20}).get() == 255);
+    static_assert((Offset{15} * Offset{17}).get() == 255);
+
+    using Delta =
+        strong::strong_type<struct DeltaTag, int32_t, strong::saturating_plus,
+                            strong::saturating_minus,
+                            strong::saturating_multiplication>;
+    constexpr int32_t kMax = std::numeric_limits<int32_t>::max();
+    constexpr int32_t kMin = std::numeric_limits<int32_t>::min();
+    static_assert((Delta{kMax} + Delta{1}).get() == kMax);
+    static_assert((Delta{kMin} + Delta{-1}).get() == kMin);
+    static_assert((Delta{-5} + Delta{3}).get() == -2);
+    static_assert((Delta{kMin} - Delta{1}).get() == kMin);
+    static_assert((Delta{0} - Delta{kMin}).get() == kMax);
+    static_assert((Delta{-1} - Delta{kMax}).get() == kMin);
+    static_assert((Delta{kMin} * Delta{-1}).get() == kMax);
+    static_assert((Delta{kMax} * Delta{-2}).get() == kMin);
+    static_assert((Delta{-70000} * Delta{-70000}).get() == kMax);
+    static_assert((Delta{-7} * Delta{6}).get() == -42);
+}
+
+TEST(StrongTypeTests, WrappingArithmetic)
+{
+    using Sequence =
+        strong::strong_type<struct SequenceTag, uint16_t, strong::wrapping_plus,
+                            strong::wrapping_minus,
+                            strong::wrapping_multiplication>;
+    static_assert((Sequence{65535} + Sequence{2}).get() == 1);
+    static_assert((Sequence{1} - Sequence{2}).get() == 65535);
+    // uint16_t * uint16_t is computed in unsigned int, not in int.
+    static_assert((Sequence{65535} * Sequence{65535}).get() == 1);
+
+    using Signed =
+        strong::strong_type<struct SignedTag, int64_t, strong::wrapping_plus,
+                            strong::wrapping_minus,
+                            strong::wrapping_multiplication>;
+    constexpr int64_t kMax = std::numeric_limits<int64_t>::max();
+    constexpr int64_t kMin = std::numeric_limits<int64_t>::min();
+    static_assert((Signed{kMax} + Signed{1}).get() == kMin);
+    static_assert((Signed{kMin} - Signed{1}).get() == kMax);
+    static_assert((Signed{kMin} * Signed{-1}).get() == kMin);
+}
+
+TEST(StrongTypeTests, CheckedArithmetic)
+{
+    using Size =
+        strong::strong_type<struct SizeTag, uint32_t, strong::checked_plus,
+                            strong::checked_minus,
+                            strong::checked_multiplication>;
+    static_assert((Size{4000000000u} + Size{294967295u}).get() == 4294967295u);
+    static_assert((Size{10} - Size{10}).get() == 0);
+    static_assert((Size{65536} * Size{65535}).get() == 4294901760u);
+
+    const Size big{4000000000u};
+    ASSERT_DEATH(static_cast<void>(big + big), "");
+    ASSERT_DEATH(static_cast<void>(Size{1} - Size{2}), "");
+    ASSERT_DEATH(static_cast<void>(big * Size{2}), "");
+}
+
+TEST(StrongTypeTests, PortableOverflowChecks)
+{
+    check_portable_overflow<int8_t>();
+    check_portable_overflow<uint8_t>();
+}
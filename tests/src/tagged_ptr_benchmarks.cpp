@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "strong_type/tagged_ptr.h"
+
+// Push and pop of a Treiber stack whose head carries an ABA counter: a
+// hand-written std::atomic<std::uintptr_t> with the counter in the high 16
+// bits ("raw") and strong::atomic<strong::tagged_ptr> ("strong"). Both need
+// 16 free high pointer bits.
+
+#if STRONG_TYPE_POINTER_FREE_HIGH_BITS >= 16
+
+namespace
+{
+struct node
+{
+    std::atomic<node *> next{nullptr};
+};
+
+class raw_stack
+{
+    static constexpr unsigned kShift = 48;
+    static constexpr std::uintptr_t kPointerMask =
+        (std::uintptr_t{1} << kShift) - 1;
+
+   public:
+    void push(node *aNode) noexcept
+    {
+        std::uintptr_t head = head_.load(std::memory_order_relaxed);
+        std::uintptr_t desired;
+        do
+        {
+            aNode->next.store(reinterpret_cast<node *>(head & kPointerMask),
+                              std::memory_order_relaxed);
+            desired = reinterpret_cast<std::uintptr_t>(aNode) |
+                      ((head >> kShift) + 1) << kShift;
+        } while (!head_.compare_exchange_weak(head, desired,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+    }
+
+    node *pop() noexcept
+    {
+        std::uintptr_t head = head_.load(std::memory_order_acquire);
+        while ((head & kPointerMask) != 0)
+        {
+            node *top = reinterpret_cast<node *>(head & kPointerMask);
+            const std::uintptr_t desired =
+                reinterpret_cast<std::uintptr_t>(
+                    top->next.load(std::memory_order_relaxed)) |
+                ((head >> kShift) + 1) << kShift;
+            if (head_.compare_exchange_weak(head, desired,
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire))
+            {
+                return top;
+            }
+        }
+        return nullptr;
+    }
+
+   private:
+    std::atomic<std::uintptr_t> head_{0};
+};
+
+class strong_stack
+{
+    using ptr = strong::tagged_ptr<struct StackTag, node, 16>;
+
+   public:
+    void push(node *aNode) noexcept
+    {
+        ptr head = head_.load(std::memory_order_relaxed);
+        do
+        {
+            aNode->next.store(head.get(), std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(
+            head, ptr(aNode, head.tag() + 1), std::memory_order_release,
+            std::memory_order_relaxed));
+    }
+
+    node *pop() noexcept
+    {
+        ptr head = head_.load(std::memory_order_acquire);
+        while (head)
+        {
+            node *next = head->next.load(std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(head, ptr(next, head.tag() + 1),
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire))
+            {
+                return head.get();
+            }
+        }
+        return nullptr;
+    }
+
+   private:
+    strong::atomic<ptr> head_;
+};
+
+template <typename Stack>
+void BM_TaggedStack(benchmark::State &aState)
+{
+    const auto count = static_cast<std::size_t>(aState.range(0));
+    std::vector<node> nodes(count);
+    Stack stack;
+    for (auto &item: nodes)
+    {
+        stack.push(&item);
+    }
+    for (auto _: aState)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            node *item = stack.pop();
+            benchmark::DoNotOptimize(item);
+            stack.push(item);
+        }
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+
+constexpr std::int64_t kCount = 1 << 10;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_TaggedStack, raw_stack)
+    ->Name("ratio/BM_TaggedStack/raw")
+    ->Arg(kCount);
+BENCHMARK_TEMPLATE(BM_TaggedStack, strong_stack)
+    ->Name("ratio/BM_TaggedStack/strong")
+    ->Arg(kCount);
+#endif
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "strong_type/tagged_ptr.h"
+
+namespace
+{
+struct node
+{
+    std::atomic<node *> next{nullptr};
+    std::uint64_t value = 0;
+};
+
+// Tag only in the alignment bits, available everywhere.
+using MarkedPtr = strong::tagged_ptr<struct MarkedPtrTag, node, 2>;
+
+template <typename Ptr>
+void check_pointer_and_tag(node *aPointer, node *aOther)
+{
+    for (std::uintptr_t tag = 0; tag <= Ptr::max_tag; tag += 1 + tag / 2)
+    {
+        const Ptr ptr(aPointer, tag);
+        ASSERT_EQ(ptr.get(), aPointer);
+        ASSERT_EQ(ptr.tag(), tag);
+        ASSERT_EQ(ptr.with_tag(tag + 1).tag(), (tag + 1) & Ptr::max_tag);
+        ASSERT_EQ(ptr.with_pointer(aOther).get(), aOther);
+        ASSERT_EQ(ptr.with_pointer(aOther).tag(), tag);
+        ASSERT_EQ(Ptr::from_word(ptr.word()), ptr);
+    }
+    ASSERT_EQ(Ptr(aPointer, Ptr::max_tag + 1).tag(), 0u);
+}
+
+template <typename Ptr>
+void check_access(std::uintptr_t aTag)
+{
+    node nodes[4];
+    for (std::uint64_t i = 0; i < 4; ++i)
+    {
+        nodes[i].value = i * 10;
+    }
+    Ptr ptr(&nodes[0], aTag);
+    ASSERT_EQ((*ptr).value, 0u);
+    ASSERT_EQ(ptr->value, 0u);
+    ASSERT_EQ(ptr[2].value, 20u);
+    ptr += 3;
+    ASSERT_EQ(ptr->value, 30u);
+    ASSERT_EQ(ptr.tag(), aTag);
+    ptr -= 1;
+    ASSERT_EQ(ptr->value, 20u);
+    ASSERT_EQ((ptr - 2)->value, 0u);
+    ASSERT_EQ((ptr + 1)->value, 30u);
+    ASSERT_EQ((ptr + 1).tag(), aTag);
+    ASSERT_EQ(ptr - Ptr(&nodes[0]), 2);
+}
+
+#if STRONG_TYPE_POINTER_FREE_HIGH_BITS >= 16
+// Tag in the alignment bits and in the high bits, where pointers leave
+// 16 high bits free.
+using CountedPtr = strong::tagged_ptr<struct CountedPtrTag, node, 16>;
+
+// Treiber stack: every successful push and pop bumps the tag of the head, so
+// a pop that read a head which was popped and pushed back meanwhile fails
+// its CAS instead of installing a stale next pointer.
+class stack
+{
+   public:
+    void push(node *aNode) noexcept
+    {
+        CountedPtr head = head_.load(std::memory_order_relaxed);
+        do
+        {
+            aNode->next.store(head.get(), std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(
+            head, CountedPtr(aNode, head.tag() + 1),
+            std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    node *pop() noexcept
+    {
+        CountedPtr head = head_.load(std::memory_order_acquire);
+        while (head)
+        {
+            node *next = head->next.load(std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(head,
+                                            CountedPtr(next, head.tag() + 1),
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire))
+            {
+                return head.get();
+            }
+        }
+        return nullptr;
+    }
+
+   private:
+    strong::atomic<CountedPtr> head_;
+};
+#endif
+}  // namespace
+
+TEST(TaggedPtrTests, LayoutIsOneWord)
+{
+    static_assert(sizeof(MarkedPtr) == sizeof(node *));
+    static_assert(std::is_trivially_copyable_v<MarkedPtr>);
+    static_assert(strong::is_tagged_ptr_v<MarkedPtr>);
+    static_assert(!strong::is_tagged_ptr_v<node *>);
+    static_assert(MarkedPtr::max_tag == 3);
+    static_assert(strong::atomic<MarkedPtr>::is_always_lock_free);
+#if STRONG_TYPE_POINTER_FREE_HIGH_BITS >= 16
+    static_assert(sizeof(CountedPtr) == sizeof(node *));
+    static_assert(CountedPtr::max_tag == 0xFFFF);
+    static_assert(!std::is_same_v<MarkedPtr, CountedPtr>);
+    static_assert(strong::atomic<CountedPtr>::is_always_lock_free);
+#endif
+}
+
+TEST(TaggedPtrTests, PointerAndTagAreIndependent)
+{
+    node nodes[4];
+    const MarkedPtr null;
+    ASSERT_FALSE(null);
+    ASSERT_EQ(null.get(), nullptr);
+    ASSERT_EQ(null.tag(), 0u);
+
+    check_pointer_and_tag<MarkedPtr>(&nodes[1], &nodes[2]);
+    ASSERT_NE(MarkedPtr(&nodes[0], 1), MarkedPtr(&nodes[0], 2));
+    ASSERT_EQ(MarkedPtr(&nodes[0], 1), MarkedPtr(&nodes[0], 5));
+#if STRONG_TYPE_POINTER_FREE_HIGH_BITS >= 16
+    check_pointer_and_tag<CountedPtr>(&nodes[1], &nodes[2]);
+#endif
+}
+
+TEST(TaggedPtrTests, AccessMasksTag)
+{
+    check_access<MarkedPtr>(3);
+#if STRONG_TYPE_POINTER_FREE_HIGH_BITS >= 16
+    check_access<CountedPtr>(0xABCD);
+#endif
+}
+
+TEST(TaggedPtrTests, AtomicCompareExchange)
+{
+    node nodes[2];
+    strong::atomic<MarkedPtr> value(MarkedPtr(&nodes[0], 1));
+    MarkedPtr expected(&nodes[0], 0);
+    ASSERT_FALSE(value.compare_exchange_strong(expected,
+                                               MarkedPtr(&nodes[1], 2),
+                                               std::memory_order_relaxed,
+                                               std::memory_order_relaxed));
+    ASSERT_EQ(expected, MarkedPtr(&nodes[0], 1));
+    ASSERT_TRUE(value.compare_exchange_strong(expected,
+                                              MarkedPtr(&nodes[1], 2),
+                                              std::memory_order_relaxed,
+                                              std::memory_order_relaxed));
+    ASSERT_EQ(value.load(std::memory_order_relaxed), MarkedPtr(&nodes[1], 2));
+    ASSERT_EQ(value.exchange(MarkedPtr(), std::memory_order_relaxed),
+              MarkedPtr(&nodes[1], 2));
+    ASSERT_FALSE(value.load(std::memory_order_relaxed));
+}
+
+#if STRONG_TYPE_POINTER_FREE_HIGH_BITS >= 16
+TEST(TaggedPtrTests, LockFreeStack)
+{
+    constexpr std::size_t kThreads = 4;
+    constexpr std::size_t kNodesPerThread = 64;
+    constexpr int kRounds = 20000;
+    std::vector<node> nodes(kThreads * kNodesPerThread);
+    stack free_list;
+    for (auto &item: nodes)
+    {
+        free_list.push(&item);
+    }
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back(
+            [&free_list]
+            {
+                node *taken[8];
+                for (int round = 0; round < kRounds; ++round)
+                {
+                    std::size_t count = 0;
+                    for (; count < 8; ++count)
+                    {
+                        taken[count] = free_list.pop();
+                        if (taken[count] == nullptr)
+                        {
+                            break;
+                        }
+                        ++taken[count]->value;
+                    }
+                    while (count != 0)
+                    {
+                        free_list.push(taken[--count]);
+                    }
+                }
+            });
+    }
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+
+    // Every node is in the stack exactly once.
+    std::size_t count = 0;
+    std::uint64_t total = 0;
+    while (node *item = free_list.pop())
+    {
+        ++count;
+        total += item->value;
+        item->value = ~std::uint64_t{0};
+    }
+    ASSERT_EQ(count, nodes.size());
+    for (const auto &item: nodes)
+    {
+        ASSERT_EQ(item.value, ~std::uint64_t{0});
+    }
+    ASSERT_LE(total, std::uint64_t{kThreads} * kRounds * 8);
+}
+#endif
@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+#include "strong_type/tsc.h"
+
+// Cost of reading a clock: std::chrono clocks against tsc_clock, and the
+// raw counter intrinsic against tsc_clock::now() ("raw"/"strong", on x86).
+// BM_MeasureInterval times an empty region and converts it to nanoseconds,
+// the way a latency probe does.
+
+namespace
+{
+template <typename Clock>
+void BM_ClockNow(benchmark::State &aState)
+{
+    for (auto _: aState)
+    {
+        benchmark::DoNotOptimize(Clock::now());
+    }
+}
+
+struct tsc_ordered_clock
+{
+    static strong::tsc_timestamp now() noexcept
+    {
+        return strong::tsc_clock::now_ordered();
+    }
+};
+
+#if STRONG_TYPE_TSC_X86
+void BM_TscNowRaw(benchmark::State &aState)
+{
+    for (auto _: aState)
+    {
+        benchmark::DoNotOptimize(__rdtsc());
+    }
+}
+#endif
+
+template <typename Clock>
+void BM_MeasureInterval(benchmark::State &aState)
+{
+    // Calibrates outside of the measured loop.
+    static_cast<void>(strong::tsc_calibration::instance());
+    for (auto _: aState)
+    {
+        const auto start = Clock::now();
+        const auto end = Clock::now();
+        if constexpr (std::is_same_v<Clock, strong::tsc_clock>)
+        {
+            benchmark::DoNotOptimize(strong::tsc_cast(end - start));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end -
+                                                                     start));
+        }
+    }
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ClockNow, std::chrono::steady_clock)
+    ->Name("BM_ClockNow/steady_clock");
+BENCHMARK_TEMPLATE(BM_ClockNow, std::chrono::system_clock)
+    ->Name("BM_ClockNow/system_clock");
+BENCHMARK_TEMPLATE(BM_ClockNow, std::chrono::high_resolution_clock)
+    ->Name("BM_ClockNow/high_resolution_clock");
+BENCHMARK_TEMPLATE(BM_ClockNow, strong::tsc_clock)->Name("BM_ClockNow/tsc");
+BENCHMARK_TEMPLATE(BM_ClockNow, tsc_ordered_clock)
+    ->Name("BM_ClockNow/tsc_ordered");
+
+#if STRONG_TYPE_TSC_X86
+BENCHMARK(BM_TscNowRaw)->Name("ratio/BM_TscNow/raw");
+BENCHMARK_TEMPLATE(BM_ClockNow, strong::tsc_clock)
+    ->Name("ratio/BM_TscNow/strong");
+#endif
+
+BENCHMARK_TEMPLATE(BM_MeasureInterval, std::chrono::steady_clock)
+    ->Name("BM_MeasureInterval/steady_clock");
+BENCHMARK_TEMPLATE(BM_MeasureInterval, strong::tsc_clock)
+    ->Name("BM_MeasureInterval/tsc");
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+#include "strong_type/tsc.h"
+
+namespace
+{
+template <typename Lhs, typename Rhs, typename = void>
+struct is_addable : std::false_type
+{
+};
+
+template <typename Lhs, typename Rhs>
+struct is_addable<
+    Lhs, Rhs, std::void_t<decltype(std::declval<Lhs>() + std::declval<Rhs>())>>
+    : std::true_type
+{
+};
+
+// Calibration of a 3 GHz counter, taken at its reading 1000.
+strong::tsc_calibration three_gigahertz(
+    std::chrono::steady_clock::time_point aSteadyBase = {})
+{
+    return strong::tsc_calibration(3000000000u, strong::tsc_timestamp{1000},
+                                   aSteadyBase);
+}
+}  // namespace
+
+TEST(TscTests, TimestampArithmetic)
+{
+    constexpr strong::tsc_timestamp kStart{100};
+    constexpr strong::tsc_timestamp kEnd{350};
+    static_assert(std::is_same_v<decltype(kEnd - kStart),
+                                 strong::tsc_duration>);
+    static_assert((kEnd - kStart).get() == 250);
+    static_assert((kStart - kEnd).get() == -250);
+    static_assert(kStart + (kEnd - kStart) == kEnd);
+    static_assert(kEnd - (kEnd - kStart) == kStart);
+    static_assert(kStart < kEnd);
+
+    static_assert(!is_addable<strong::tsc_timestamp,
+                              strong::tsc_timestamp>::value);
+    static_assert(is_addable<strong::tsc_duration,
+                             strong::tsc_duration>::value);
+    static_assert(sizeof(strong::tsc_timestamp) == sizeof(std::uint64_t));
+}
+
+TEST(TscTests, ConvertsTicksToNanoseconds)
+{
+    const strong::tsc_calibration calibration = three_gigahertz();
+    ASSERT_EQ(calibration.ticks_per_second(), 3000000000u);
+    ASSERT_EQ(calibration.nanoseconds(strong::tsc_duration{0}), 0);
+    ASSERT_EQ(calibration.nanoseconds(strong::tsc_duration{3}), 1);
+    ASSERT_EQ(calibration.nanoseconds(strong::tsc_duration{3000000000}),
+              1000000000);
+    ASSERT_EQ(calibration.nanoseconds(strong::tsc_duration{-3000}), -1000);
+    // An hour of ticks: the fixed point fraction is off by less than 2 us.
+    const std::int64_t hour = 3600 * std::int64_t{1000000000};
+    ASSERT_NEAR(static_cast<double>(calibration.nanoseconds(
+                    strong::tsc_duration{3 * hour})),
+                static_cast<double>(hour), 2000.0);
+
+    ASSERT_EQ(calibration.ticks(std::chrono::nanoseconds(1000)).get(), 3000);
+    ASSERT_EQ(calibration.ticks(std::chrono::seconds(-2)).get(),
+              -6000000000);
+
+    // A 125 MHz counter: 8 ns per tick.
+    const strong::tsc_calibration slow(125000000u, strong::tsc_timestamp{0},
+                                       {});
+    ASSERT_EQ(slow.nanoseconds(strong::tsc_duration{1000}), 8000);
+    ASSERT_EQ(slow.ticks(std::chrono::microseconds(8)).get(), 1000);
+}
+
+TEST(TscTests, MapsTimestampsToSteadyClock)
+{
+    const auto base = std::chrono::steady_clock::time_point(
+        std::chrono::seconds(100));
+    const strong::tsc_calibration calibration = three_gigahertz(base);
+    ASSERT_EQ(calibration.to_steady(strong::tsc_timestamp{1000}), base);
+    ASSERT_EQ(calibration.to_steady(strong::tsc_timestamp{3001000}),
+              base + std::chrono::milliseconds(1));
+    ASSERT_EQ(calibration.to_steady(strong::tsc_timestamp{1}),
+              base - std::chrono::nanoseconds(333));
+}
+
+TEST(TscTests, ClockIsMonotonic)
+{
+    strong::tsc_timestamp previous = strong::tsc_clock::now_ordered();
+    for (int i = 0; i < 10000; ++i)
+    {
+        const strong::tsc_timestamp current = strong::tsc_clock::now_ordered();
+        ASSERT_LE(previous, current);
+        previous = current;
+    }
+}
+
+TEST(TscTests, CalibrationMatchesSteadyClock)
+{
+    ASSERT_GT(strong::tsc_calibration::instance().ticks_per_second(), 0u);
+
+    const auto steadyStart = std::chrono::steady_clock::now();
+    const strong::tsc_timestamp start = strong::tsc_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const strong::tsc_timestamp end = strong::tsc_clock::now_ordered();
+    const auto steadyEnd = std::chrono::steady_clock::now();
+
+    const auto measured = strong::tsc_cast(end - start);
+    const auto expected = steadyEnd - steadyStart;
+    // Both clocks measure the same sleep: they differ by the calibration
+    // error and the cost of the readings around the sleep.
+    ASSERT_LT(measured, expected * 1.02);
+    ASSERT_GT(measured, expected * 0.98 - std::chrono::microseconds(100));
+
+    ASSERT_EQ(strong::tsc_cast<std::chrono::milliseconds>(
+                  strong::tsc_ticks(std::chrono::milliseconds(5))),
+              std::chrono::milliseconds(5));
+    ASSERT_LT(strong::tsc_ticks(std::chrono::microseconds(1)),
+              strong::tsc_ticks(std::chrono::microseconds(2)));
+}
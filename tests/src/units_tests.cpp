@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+#include "strong_type/units.h"
+
+namespace
+{
+namespace u = strong::units;
+
+using Meters = u::quantity<u::unit<u::length>, double>;
+using Kilometers = u::quantity<u::unit<u::length, std::kilo>, double>;
+using SquareMeters =
+    u::quantity<u::unit<u::dimension<2, 0, 0, 0, 0>>, double>;
+using Seconds = u::quantity<u::unit<u::time>, double>;
+using MetersPerSecond =
+    u::quantity<u::unit<u::dimension<1, 0, -1, 0, 0>>, double>;
+
+using Bytes = u::quantity<u::unit<u::data>, std::uint64_t>;
+using Kilobytes = u::quantity<u::unit<u::data, std::kilo>, std::uint64_t>;
+using Nanoseconds = u::quantity<u::unit<u::time, std::nano>, std::uint64_t>;
+using Milliseconds =
+    u::quantity<u::unit<u::time, std::milli>, std::uint64_t>;
+using BytesPerSecond = u::quantity<u::unit<u::dimension<0, 0, -1, 1, 0>>,
+                                   std::uint64_t>;
+using Requests = u::quantity<u::unit<u::count>, std::uint64_t>;
+using Hertz = u::quantity<u::unit<u::dimension<0, 0, -1, 0, 0>>, double>;
+
+// Exact comparison of doubles that are exactly representable in the tests.
+constexpr bool equal(double aLhs, double aRhs)
+{
+    return !(aLhs < aRhs) && !(aRhs < aLhs);
+}
+}  // namespace
+
+TEST(UnitsTests, QuantitiesHaveLayoutOfUnderlyingType)
+{
+    static_assert(sizeof(Meters) == sizeof(double));
+    static_assert(sizeof(Bytes) == sizeof(std::uint64_t));
+    static_assert(std::is_trivially_copyable_v<Meters>);
+    static_assert(u::is_quantity_v<Meters>);
+    static_assert(!u::is_quantity_v<double>);
+    static_assert(
+        !u::is_quantity_v<strong::strong_type<struct PlainTag, double>>);
+}
+
+TEST(UnitsTests, MultiplicationAndDivisionDeriveUnits)
+{
+    constexpr auto area = Meters{3.0} * Meters{4.0};
+    static_assert(std::is_same_v<decltype(area), const SquareMeters>);
+    static_assert(equal(area.get(), 12.0));
+
+    constexpr auto speed = Meters{100.0} / Seconds{20.0};
+    static_assert(std::is_same_v<decltype(speed), const MetersPerSecond>);
+    static_assert(equal(speed.get(), 5.0));
+    static_assert(equal((speed * Seconds{2.0}).get(), 10.0));
+    static_assert(
+        std::is_same_v<decltype(speed * Seconds{2.0}), Meters>);
+
+    constexpr auto frequency = 1.0 / Seconds{0.5};
+    static_assert(std::is_same_v<decltype(frequency), const Hertz>);
+    static_assert(equal(frequency.get(), 2.0));
+
+    // Dimensions cancel out: the result is a plain number.
+    constexpr auto ratio = Meters{6.0} / Meters{3.0};
+    static_assert(std::is_same_v<decltype(ratio), const double>);
+    static_assert(equal(ratio, 2.0));
+    constexpr auto scaled = Kilometers{1.5} / Meters{500.0};
+    static_assert(equal(scaled, 3.0));
+}
+
+TEST(UnitsTests, IntegralRatioOfDifferentUnitsIsExact)
+{
+    static_assert(std::is_same_v<decltype(Kilobytes{1} / Bytes{1000}),
+                                 std::uint64_t>);
+    static_assert(Kilobytes{1} / Bytes{1000} == 1u);
+    static_assert(Bytes{1000} / Kilobytes{1} == 1u);
+    static_assert(Kilobytes{3} / Bytes{1500} == 2u);
+    static_assert(Milliseconds{1} / Nanoseconds{1000} == 1000u);
+    static_assert(Nanoseconds{5000000} / Milliseconds{2} == 2u);
+
+    volatile std::uint64_t kilobytes = 7;
+    volatile std::uint64_t bytes = 500;
+    const Kilobytes size{static_cast<std::uint64_t>(kilobytes)};
+    const Bytes chunk{static_cast<std::uint64_t>(bytes)};
+    ASSERT_EQ(size / chunk, 14u);
+}
+
+TEST(UnitsTests, ScalarOperationsKeepUnit)
+{
+    static_assert(std::is_same_v<decltype(Meters{2.0} * 3.0), Meters>);
+    static_assert(std::is_same_v<decltype(3.0 * Meters{2.0}), Meters>);
+    static_assert(std::is_same_v<decltype(Meters{2.0} / 4.0), Meters>);
+    static_assert(equal((Meters{2.0} * 3.0).get(), 6.0));
+    static_assert(equal((Meters{2.0} / 4.0).get(), 0.5));
+    static_assert(equal((Meters{2.0} + Meters{3.0}).get(), 5.0));
+    static_assert(equal((Meters{2.0} - Meters{3.0}).get(), -1.0));
+    static_assert(Meters{2.0} < Meters{3.0});
+}
+
+TEST(UnitsTests, ScaleConversionsAreFoldedAtCompileTime)
+{
+    static_assert(u::quantity_cast<Bytes>(Kilobytes{3}).get() == 3000u);
+    static_assert(u::quantity_cast<Kilobytes>(Bytes{2999}).get() == 2u);
+    static_assert(u::quantity_cast<Nanoseconds>(Milliseconds{7}).get() ==
+                  7000000u);
+    static_assert(
+        equal(u::quantity_cast<Meters>(Kilometers{1.25}).get(), 1250.0));
+
+    // 4 KB in 2 ms: the derived unit is KB/ms, that is 10^6 bytes per
+    // second.
+    constexpr auto rate = Kilobytes{4} / Milliseconds{2};
+    using Rate = std::remove_const_t<decltype(rate)>;
+    static_assert(
+        std::is_same_v<strong::tag_type<Rate>::ratio, std::ratio<1000000>>);
+    static_assert(u::quantity_cast<BytesPerSecond>(rate).get() == 2000000u);
+
+    constexpr auto requests = Requests{1000} / Nanoseconds{500};
+    static_assert(
+        std::is_same_v<strong::tag_type<decltype(requests)>::dimension,
+                       u::dimension<0, 0, -1, 0, 1>>);
+    static_assert(requests.get() == 2u);
+}
+
+TEST(UnitsTests, RunTimeValues)
+{
+    volatile std::uint64_t bytes = 123456789;
+    volatile std::uint64_t nanoseconds = 1000;
+    const Bytes size{static_cast<std::uint64_t>(bytes)};
+    const Nanoseconds elapsed{static_cast<std::uint64_t>(nanoseconds)};
+    const auto rate = u::quantity_cast<BytesPerSecond>(size / elapsed);
+    ASSERT_EQ(rate.get(), 123456000000000u);
+}